@@ -6,6 +6,32 @@ dnl Function to detect if libfsxfs dependencies are available
 AC_DEFUN([AX_LIBFSXFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsxfs/libfsxfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for the monotonic clock used in libfsxfs/libfsxfs_statistics.c
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Check for the direct IO functions in libfsxfs/libfsxfs_direct_io_handle.c
+  AC_CHECK_HEADERS([fcntl.h linux/fs.h sys/ioctl.h unistd.h])
+
+  AC_CHECK_FUNCS([posix_memalign pread])
+
+  AC_CHECK_DECLS(
+    [O_DIRECT],
+    [],
+    [],
+    [[#define _GNU_SOURCE 1
+#include <fcntl.h>]])
+
+  dnl Check for the io_uring system calls in libfsxfs/libfsxfs_io_uring.c
+  AC_CHECK_HEADERS([linux/io_uring.h sys/mman.h sys/syscall.h sys/uio.h])
+
+  AC_CHECK_FUNCS([mmap munmap syscall])
+
+  AC_CHECK_DECLS(
+    [__NR_io_uring_setup, __NR_io_uring_enter],
+    [],
+    [],
+    [[#include <sys/syscall.h>]])
 ])
 
 dnl Function to detect if fsxfstools dependencies are available
@@ -55,6 +55,9 @@ enum FSXFSINFO_MODES
 	FSXFSINFO_MODE_FILE_ENTRY_BY_IDENTIFIER,
 	FSXFSINFO_MODE_FILE_ENTRY_BY_PATH,
 	FSXFSINFO_MODE_FILE_SYSTEM_HIERARCHY,
+	FSXFSINFO_MODE_METADATA_EXPORT,
+	FSXFSINFO_MODE_QUOTA_USAGE,
+	FSXFSINFO_MODE_SPACE_USAGE,
 	FSXFSINFO_MODE_VOLUME
 };
 
@@ -74,7 +77,9 @@ void usage_fprint(
 	                 " File System (ext) volume.\n\n" );
 
 	fprintf( stream, "Usage: fsxfsinfo [ -B bodyfile ] [ -E inode_number ] [ -F file_entry ]\n"
-	                 "                 [ -o offset ] [ -dhHvV ] source\n\n" );
+	                 "                 [ -I index_file ] [ -M metadata_file ] [ -o offset ]\n"
+	                 "                 [ -dhHQSUvV ]\n"
+	                 "                 source\n\n" );
 
 	fprintf( stream, "\tsource: the source file or device\n\n" );
 
@@ -84,7 +89,13 @@ void usage_fprint(
 	fprintf( stream, "\t-F:     show information about a specific file entry path.\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-H:     shows the file system hierarchy\n" );
+	fprintf( stream, "\t-I:     use a sidecar index file for inode and path lookups, the\n"
+	                 "\t        index file is (re)built if missing or out of date\n" );
+	fprintf( stream, "\t-M:     export the inode metadata to a columnar metadata file\n" );
 	fprintf( stream, "\t-o:     specify the volume offset\n" );
+	fprintf( stream, "\t-Q:     shows the quota usage information\n" );
+	fprintf( stream, "\t-S:     print read, cache and timing statistics\n" );
+	fprintf( stream, "\t-U:     shows the space usage per owner, group, file type and size\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -145,6 +156,8 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_bodyfile              = NULL;
 	system_character_t *option_file_entry_identifier = NULL;
 	system_character_t *option_file_entry_path       = NULL;
+	system_character_t *option_index_file            = NULL;
+	system_character_t *option_metadata_file         = NULL;
 	system_character_t *option_volume_offset         = NULL;
 	system_character_t *source                       = NULL;
 	char *program                                    = "fsxfsinfo";
@@ -152,6 +165,7 @@ int main( int argc, char * const argv[] )
 	size_t string_length                             = 0;
 	uint64_t file_entry_identifier                   = 0;
 	uint8_t calculate_md5                            = 0;
+	uint8_t print_statistics                         = 0;
 	int option_mode                                  = FSXFSINFO_MODE_VOLUME;
 	int verbose                                      = 0;
 
@@ -188,7 +202,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fsxfstools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "B:dE:F:hHo:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "B:dE:F:hHI:M:o:QSUvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -238,11 +252,37 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'I':
+				option_index_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'M':
+				option_mode          = FSXFSINFO_MODE_METADATA_EXPORT;
+				option_metadata_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'Q':
+				option_mode = FSXFSINFO_MODE_QUOTA_USAGE;
+
+				break;
+
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
+			case (system_integer_t) 'U':
+				option_mode = FSXFSINFO_MODE_SPACE_USAGE;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -319,6 +359,34 @@ int main( int argc, char * const argv[] )
 			 fsxfsinfo_info_handle->volume_offset );
 		}
 	}
+	if( option_index_file != NULL )
+	{
+		if( info_handle_set_index_file(
+		     fsxfsinfo_info_handle,
+		     option_index_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set index file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_set_collect_statistics(
+		     fsxfsinfo_info_handle,
+		     1,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set collect statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_open_input(
 	     fsxfsinfo_info_handle,
 	     source,
@@ -430,6 +498,46 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 
+		case FSXFSINFO_MODE_METADATA_EXPORT:
+			if( info_handle_export_metadata(
+			     fsxfsinfo_info_handle,
+			     option_metadata_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to export metadata.\n" );
+
+				goto on_error;
+			}
+			break;
+
+		case FSXFSINFO_MODE_QUOTA_USAGE:
+			if( info_handle_quota_usage_fprint(
+			     fsxfsinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print quota usage information.\n" );
+
+				goto on_error;
+			}
+			break;
+
+		case FSXFSINFO_MODE_SPACE_USAGE:
+			if( info_handle_space_usage_fprint(
+			     fsxfsinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print space usage information.\n" );
+
+				goto on_error;
+			}
+			break;
+
 		case FSXFSINFO_MODE_VOLUME:
 		default:
 			if( info_handle_volume_fprint(
@@ -444,6 +552,19 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     fsxfsinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     fsxfsinfo_info_handle,
 	     &error ) != 0 )
@@ -492,6 +492,89 @@ int info_handle_set_volume_offset(
 	return( 1 );
 }
 
+/* Sets the sidecar index file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_index_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_index_file";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsxfs_volume_set_index_file_wide(
+	     info_handle->input_volume,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libfsxfs_volume_set_index_file(
+	     info_handle->input_volume,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets if statistics should be collected
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_collect_statistics(
+     info_handle_t *info_handle,
+     uint8_t collect_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_collect_statistics";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_set_collect_statistics(
+	     info_handle->input_volume,
+	     collect_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set collect statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -2435,6 +2518,367 @@ on_error:
 }
 
 
+/* Exports the inode metadata of the volume to a columnar metadata table file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_export_metadata(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_export_metadata";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsxfs_volume_export_metadata_wide(
+	     info_handle->input_volume,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libfsxfs_volume_export_metadata(
+	     info_handle->input_volume,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export metadata to: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Metadata exported to: %" PRIs_SYSTEM "\n\n",
+	 filename );
+
+	return( 1 );
+}
+
+/* Prints the quota usage information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_quota_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *quota_type_string = NULL;
+	static char *function         = "info_handle_quota_usage_fprint";
+	uint64_t number_of_blocks     = 0;
+	uint64_t number_of_inodes     = 0;
+	uint32_t identifier           = 0;
+	uint8_t quota_type            = 0;
+	int number_of_records         = 0;
+	int record_index              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_get_number_of_quota_records(
+	     info_handle->input_volume,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of quota records.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "X File System information:\n\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Quota usage:\n" );
+
+	if( number_of_records == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tN/A\n" );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tType\tIdentifier\tNumber of blocks\tNumber of inodes\n" );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libfsxfs_volume_get_quota_record_by_index(
+		     info_handle->input_volume,
+		     record_index,
+		     &quota_type,
+		     &identifier,
+		     &number_of_blocks,
+		     &number_of_inodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve quota record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		switch( quota_type )
+		{
+			case LIBFSXFS_QUOTA_TYPE_USER:
+				quota_type_string = "user";
+				break;
+
+			case LIBFSXFS_QUOTA_TYPE_PROJECT:
+				quota_type_string = "project";
+				break;
+
+			case LIBFSXFS_QUOTA_TYPE_GROUP:
+				quota_type_string = "group";
+				break;
+
+			default:
+				quota_type_string = "unknown";
+				break;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%s\t%" PRIu32 "\t\t%" PRIu64 "\t\t\t%" PRIu64 "\n",
+		 quota_type_string,
+		 identifier,
+		 number_of_blocks,
+		 number_of_inodes );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints the space usage information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_space_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *file_type_string = NULL;
+	static char *function        = "info_handle_space_usage_fprint";
+	uint64_t number_of_blocks    = 0;
+	uint64_t number_of_inodes    = 0;
+	uint32_t key                 = 0;
+	int entry_index              = 0;
+	int number_of_entries        = 0;
+	int usage_type               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "X File System information:\n\n" );
+
+	for( usage_type = LIBFSXFS_SPACE_USAGE_TYPE_OWNER;
+	     usage_type <= LIBFSXFS_SPACE_USAGE_TYPE_SIZE;
+	     usage_type++ )
+	{
+		if( libfsxfs_volume_get_number_of_space_usage_entries(
+		     info_handle->input_volume,
+		     usage_type,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of space usage entries.",
+			 function );
+
+			return( -1 );
+		}
+		switch( usage_type )
+		{
+			case LIBFSXFS_SPACE_USAGE_TYPE_OWNER:
+				fprintf(
+				 info_handle->notify_stream,
+				 "Space usage per owner:\n"
+				 "\tOwner identifier\tNumber of inodes\tNumber of blocks\n" );
+				break;
+
+			case LIBFSXFS_SPACE_USAGE_TYPE_GROUP:
+				fprintf(
+				 info_handle->notify_stream,
+				 "Space usage per group:\n"
+				 "\tGroup identifier\tNumber of inodes\tNumber of blocks\n" );
+				break;
+
+			case LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE:
+				fprintf(
+				 info_handle->notify_stream,
+				 "Space usage per file type:\n"
+				 "\tFile type\t\tNumber of inodes\tNumber of blocks\n" );
+				break;
+
+			case LIBFSXFS_SPACE_USAGE_TYPE_SIZE:
+				fprintf(
+				 info_handle->notify_stream,
+				 "Space usage per size:\n"
+				 "\tSize (bytes)\t\tNumber of inodes\tNumber of blocks\n" );
+				break;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libfsxfs_volume_get_space_usage_entry_by_index(
+			     info_handle->input_volume,
+			     usage_type,
+			     entry_index,
+			     &key,
+			     &number_of_inodes,
+			     &number_of_blocks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve space usage entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( usage_type == LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE )
+			{
+				switch( key )
+				{
+					case 0x1000:
+						file_type_string = "named pipe";
+						break;
+
+					case 0x2000:
+						file_type_string = "character device";
+						break;
+
+					case 0x4000:
+						file_type_string = "directory";
+						break;
+
+					case 0x6000:
+						file_type_string = "block device";
+						break;
+
+					case 0x8000:
+						file_type_string = "regular file";
+						break;
+
+					case 0xa000:
+						file_type_string = "symbolic link";
+						break;
+
+					case 0xc000:
+						file_type_string = "socket";
+						break;
+
+					default:
+						file_type_string = "unknown";
+						break;
+				}
+				fprintf(
+				 info_handle->notify_stream,
+				 "\t%-16s",
+				 file_type_string );
+			}
+			else if( usage_type == LIBFSXFS_SPACE_USAGE_TYPE_SIZE )
+			{
+				/* Size bucket N contains the sizes in the range [ 2^(N-1), 2^N )
+				 */
+				if( key == 0 )
+				{
+					fprintf(
+					 info_handle->notify_stream,
+					 "\t0\t\t" );
+				}
+				else
+				{
+					fprintf(
+					 info_handle->notify_stream,
+					 "\t%-16" PRIu64 "",
+					 (uint64_t) 1 << ( key - 1 ) );
+				}
+			}
+			else
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\t%-16" PRIu32 "",
+				 key );
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%-16" PRIu64 "\t%" PRIu64 "\n",
+			 number_of_inodes,
+			 number_of_blocks );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
 /* Prints the volume information
  * Returns 1 if successful or -1 on error
  */
@@ -2583,3 +3027,128 @@ on_error:
 	return( -1 );
 }
 
+
+/* Prints the read statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *read_category_names[ 7 ] = {
+		"Superblock",
+		"Inode",
+		"Inode B+ tree",
+		"Extent B+ tree",
+		"Directory",
+		"File data",
+		"Free space B+ tree" };
+
+	static char *function                = "info_handle_statistics_fprint";
+	uint64_t decode_time                 = 0;
+	uint64_t number_of_bytes_read        = 0;
+	uint64_t number_of_cache_hits        = 0;
+	uint64_t number_of_cache_misses      = 0;
+	uint64_t number_of_reads             = 0;
+	uint64_t read_time                   = 0;
+	int read_category                    = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Read statistics:\n" );
+
+	for( read_category = LIBFSXFS_READ_CATEGORY_SUPERBLOCK;
+	     read_category <= LIBFSXFS_READ_CATEGORY_FREE_SPACE_BTREE;
+	     read_category++ )
+	{
+		if( libfsxfs_volume_get_read_statistics(
+		     info_handle->input_volume,
+		     read_category,
+		     &number_of_reads,
+		     &number_of_bytes_read,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read statistics: %d.",
+			 function,
+			 read_category );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%-18s: %" PRIu64 " reads, %" PRIu64 " bytes\n",
+		 read_category_names[ read_category ],
+		 number_of_reads,
+		 number_of_bytes_read );
+	}
+	if( libfsxfs_volume_get_cache_statistics(
+	     info_handle->input_volume,
+	     &number_of_cache_hits,
+	     &number_of_cache_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCache hits\t\t: %" PRIu64 "\n",
+	 number_of_cache_hits );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCache misses\t\t: %" PRIu64 "\n",
+	 number_of_cache_misses );
+
+	if( libfsxfs_volume_get_time_statistics(
+	     info_handle->input_volume,
+	     &read_time,
+	     &decode_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tRead time\t\t: %" PRIu64 " ns\n",
+	 read_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tDecode time\t\t: %" PRIu64 " ns\n",
+	 decode_time );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
@@ -96,6 +96,16 @@ int info_handle_set_volume_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_index_file(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_set_collect_statistics(
+     info_handle_t *info_handle,
+     uint8_t collect_statistics,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -158,10 +168,27 @@ int info_handle_file_system_hierarchy_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_export_metadata(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_quota_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_space_usage_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,252 @@
+/*
+ * Free space information structures of the X File System (XFS)
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSXFS_FREE_SPACE_INFORMATION_H )
+#define _FSXFS_FREE_SPACE_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsxfs_free_space_information fsxfs_free_space_information_t;
+
+struct fsxfs_free_space_information
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* Number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* Free space block number B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_btree_root_block_number[ 4 ];
+
+	/* Free space block count B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t count_btree_root_block_number[ 4 ];
+
+	/* Reverse mapping B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t reverse_mapping_btree_root_block_number[ 4 ];
+
+	/* Free space block number B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_btree_depth[ 4 ];
+
+	/* Free space block count B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t count_btree_depth[ 4 ];
+
+	/* Reverse mapping B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t reverse_mapping_btree_depth[ 4 ];
+
+	/* Free list first index
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_first_index[ 4 ];
+
+	/* Free list last index
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_last_index[ 4 ];
+
+	/* Free list number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_number_of_blocks[ 4 ];
+
+	/* Number of free blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_free_blocks[ 4 ];
+
+	/* Longest free extent
+	 * Consists of 4 bytes
+	 */
+	uint8_t longest_free_extent[ 4 ];
+
+	/* Number of B+ tree blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_btree_blocks[ 4 ];
+};
+
+typedef struct fsxfs_free_space_information_v5 fsxfs_free_space_information_v5_t;
+
+struct fsxfs_free_space_information_v5
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 */
+	uint8_t signature[ 4 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* Number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* Free space block number B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_btree_root_block_number[ 4 ];
+
+	/* Free space block count B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t count_btree_root_block_number[ 4 ];
+
+	/* Reverse mapping B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t reverse_mapping_btree_root_block_number[ 4 ];
+
+	/* Free space block number B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_btree_depth[ 4 ];
+
+	/* Free space block count B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t count_btree_depth[ 4 ];
+
+	/* Reverse mapping B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t reverse_mapping_btree_depth[ 4 ];
+
+	/* Free list first index
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_first_index[ 4 ];
+
+	/* Free list last index
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_last_index[ 4 ];
+
+	/* Free list number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t free_list_number_of_blocks[ 4 ];
+
+	/* Number of free blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_free_blocks[ 4 ];
+
+	/* Longest free extent
+	 * Consists of 4 bytes
+	 */
+	uint8_t longest_free_extent[ 4 ];
+
+	/* Number of B+ tree blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_btree_blocks[ 4 ];
+
+	/* Block type identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t block_type_identifier[ 16 ];
+
+	/* Reverse mapping number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t reverse_mapping_number_of_blocks[ 4 ];
+
+	/* Reference count number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t reference_count_number_of_blocks[ 4 ];
+
+	/* Reference count B+ tree root block number
+	 * Consists of 4 bytes
+	 */
+	uint8_t reference_count_btree_root_block_number[ 4 ];
+
+	/* Reference count B+ tree depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t reference_count_btree_depth[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 14 x 8 bytes
+	 */
+	uint8_t unknown1[ 14 * 8 ];
+
+	/* Log sequence number
+	 * Consists of 8 bytes
+	 */
+	uint8_t log_sequence_number[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Unknown (padding)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown2[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSXFS_FREE_SPACE_INFORMATION_H ) */
+
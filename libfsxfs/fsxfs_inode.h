@@ -163,11 +163,10 @@ struct fsxfs_inode_v1
 	 */
 	uint8_t generation_number[ 4 ];
 
-/* TODO verify if this value exists */
-	/* Unknown
+	/* Next unlinked inode number
 	 * Consists of 4 bytes
 	 */
-	uint8_t unknown7[ 4 ];
+	uint8_t next_unlinked_inode_number[ 4 ];
 };
 
 typedef struct fsxfs_inode_v2 fsxfs_inode_v2_t;
@@ -314,10 +313,10 @@ struct fsxfs_inode_v2
 	 */
 	uint8_t generation_number[ 4 ];
 
-	/* Unknown
+	/* Next unlinked inode number
 	 * Consists of 4 bytes
 	 */
-	uint8_t unknown7[ 4 ];
+	uint8_t next_unlinked_inode_number[ 4 ];
 };
 
 typedef struct fsxfs_inode_v3 fsxfs_inode_v3_t;
@@ -464,10 +463,10 @@ struct fsxfs_inode_v3
 	 */
 	uint8_t generation_number[ 4 ];
 
-	/* Unknown
+	/* Next unlinked inode number
 	 * Consists of 4 bytes
 	 */
-	uint8_t unknown7[ 4 ];
+	uint8_t next_unlinked_inode_number[ 4 ];
 
 	/* Checksum
 	 * Consists of 4 bytes
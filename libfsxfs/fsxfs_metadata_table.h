@@ -0,0 +1,108 @@
+/*
+ * Metadata table export file structures
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSXFS_METADATA_TABLE_H )
+#define _FSXFS_METADATA_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The metadata table export file consists of:
+ * the file header
+ * an array of column descriptors, one per column
+ * the column data, one array of fixed-size values per column, each aligned to 8 bytes
+ * the string heap, that contains the UTF-8 encoded names with end-of-string characters
+ *
+ * All values are stored in little-endian so that the file can be memory mapped
+ * and the columns used as arrays on little-endian systems.
+ */
+
+typedef struct fsxfs_metadata_table_header fsxfs_metadata_table_header_t;
+
+struct fsxfs_metadata_table_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "FSXFSMDT"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Number of columns
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_columns[ 4 ];
+
+	/* Number of rows
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_rows[ 8 ];
+
+	/* String heap offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_heap_offset[ 8 ];
+
+	/* String heap size
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_heap_size[ 8 ];
+};
+
+typedef struct fsxfs_metadata_table_column_descriptor fsxfs_metadata_table_column_descriptor_t;
+
+struct fsxfs_metadata_table_column_descriptor
+{
+	/* Column type
+	 * Consists of 2 bytes
+	 */
+	uint8_t column_type[ 2 ];
+
+	/* Value size
+	 * Consists of 2 bytes
+	 */
+	uint8_t value_size[ 2 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* Column data offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_offset[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSXFS_METADATA_TABLE_H ) */
+
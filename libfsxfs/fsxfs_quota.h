@@ -0,0 +1,168 @@
+/*
+ * Quota structures of the X File System (XFS)
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSXFS_QUOTA_H )
+#define _FSXFS_QUOTA_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsxfs_quota_record fsxfs_quota_record_t;
+
+struct fsxfs_quota_record
+{
+	/* Signature
+	 * Consists of 2 bytes
+	 */
+	uint8_t signature[ 2 ];
+
+	/* Format version
+	 * Consists of 1 byte
+	 */
+	uint8_t format_version;
+
+	/* Quota type
+	 * Consists of 1 byte
+	 */
+	uint8_t quota_type;
+
+	/* Identifier
+	 * Contains an user, group or project identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* Block hard limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_hard_limit[ 8 ];
+
+	/* Block soft limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_soft_limit[ 8 ];
+
+	/* Inode hard limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t inode_hard_limit[ 8 ];
+
+	/* Inode soft limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t inode_soft_limit[ 8 ];
+
+	/* Number of blocks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_blocks[ 8 ];
+
+	/* Number of inodes
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_inodes[ 8 ];
+
+	/* Inode timer
+	 * Consists of 4 bytes
+	 */
+	uint8_t inode_timer[ 4 ];
+
+	/* Block timer
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_timer[ 4 ];
+
+	/* Inode warnings
+	 * Consists of 2 bytes
+	 */
+	uint8_t inode_warnings[ 2 ];
+
+	/* Block warnings
+	 * Consists of 2 bytes
+	 */
+	uint8_t block_warnings[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* Real-time block hard limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t realtime_block_hard_limit[ 8 ];
+
+	/* Real-time block soft limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t realtime_block_soft_limit[ 8 ];
+
+	/* Number of real-time blocks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_realtime_blocks[ 8 ];
+
+	/* Real-time block timer
+	 * Consists of 4 bytes
+	 */
+	uint8_t realtime_block_timer[ 4 ];
+
+	/* Real-time block warnings
+	 * Consists of 2 bytes
+	 */
+	uint8_t realtime_block_warnings[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown2[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown3[ 4 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Log sequence number
+	 * Consists of 8 bytes
+	 */
+	uint8_t log_sequence_number[ 8 ];
+
+	/* Block type identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t block_type_identifier[ 16 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSXFS_QUOTA_H ) */
+
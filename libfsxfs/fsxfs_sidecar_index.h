@@ -0,0 +1,174 @@
+/*
+ * Sidecar index file structures
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSXFS_SIDECAR_INDEX_H )
+#define _FSXFS_SIDECAR_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The sidecar index file consists of:
+ * the file header
+ * the inode chunks array, sorted by first inode number
+ * the directory entries array
+ * the directory entries hash table, an array of 32-bit directory entry numbers, aligned to 8 bytes
+ * the string heap, that contains the names of the directory entries with end-of-string characters
+ *
+ * All values are stored in little-endian so that the file can be used without
+ * decoding it first. A directory entry number is the directory entry index + 1
+ * where 0 represents an unused hash table slot.
+ */
+
+typedef struct fsxfs_sidecar_index_header fsxfs_sidecar_index_header_t;
+
+struct fsxfs_sidecar_index_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "FSXFSIDX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* File system identifier
+	 * Consists of 16 bytes
+	 * Contains a copy of the superblock file system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
+	/* Media size
+	 * Consists of 8 bytes
+	 */
+	uint8_t media_size[ 8 ];
+
+	/* Number of blocks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_blocks[ 8 ];
+
+	/* Number of inodes
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_inodes[ 8 ];
+
+	/* Number of free inodes
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_free_inodes[ 8 ];
+
+	/* Number of free data blocks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_free_data_blocks[ 8 ];
+
+	/* Number of inode chunks
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_inode_chunks[ 8 ];
+
+	/* Number of directory entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_directory_entries[ 8 ];
+
+	/* Number of hash table slots
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_hash_slots[ 8 ];
+
+	/* String heap size
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_heap_size[ 8 ];
+};
+
+typedef struct fsxfs_sidecar_index_inode_chunk fsxfs_sidecar_index_inode_chunk_t;
+
+struct fsxfs_sidecar_index_inode_chunk
+{
+	/* First (absolute) inode number
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_inode_number[ 8 ];
+
+	/* Free inodes bitmap
+	 * Consists of 8 bytes
+	 */
+	uint8_t free_inodes_bitmap[ 8 ];
+};
+
+typedef struct fsxfs_sidecar_index_directory_entry fsxfs_sidecar_index_directory_entry_t;
+
+struct fsxfs_sidecar_index_directory_entry
+{
+	/* Parent (directory) inode number
+	 * Consists of 8 bytes
+	 */
+	uint8_t parent_inode_number[ 8 ];
+
+	/* Inode number
+	 * Consists of 8 bytes
+	 */
+	uint8_t inode_number[ 8 ];
+
+	/* Name offset
+	 * Consists of 8 bytes
+	 * The offset is relative to the start of the string heap
+	 */
+	uint8_t name_offset[ 8 ];
+
+	/* Name size
+	 * Consists of 2 bytes
+	 * The size does not include the end-of-string character
+	 */
+	uint8_t name_size[ 2 ];
+
+	/* File type
+	 * Consists of 1 byte
+	 * Contains the directory entry file type value
+	 */
+	uint8_t file_type;
+
+	/* Unknown (reserved)
+	 * Consists of 5 bytes
+	 */
+	uint8_t unknown1[ 5 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSXFS_SIDECAR_INDEX_H ) */
+
@@ -497,6 +497,50 @@ struct fsxfs_superblock_v5
 	 * Consists of 4 bytes
 	 */
 	uint8_t secondary_feature_flags_copy[ 4 ];
+	/* Compatible feature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t compatible_feature_flags[ 4 ];
+
+	/* Read-only compatible feature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t read_only_compatible_feature_flags[ 4 ];
+
+	/* Incompatible feature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t incompatible_feature_flags[ 4 ];
+
+	/* Journal incompatible feature flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t journal_incompatible_feature_flags[ 4 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Sparse inode chunk alignment
+	 * Consists of 4 bytes
+	 */
+	uint8_t sparse_inode_chunk_alignment[ 4 ];
+
+	/* Project quota inode number
+	 * Consists of 8 bytes
+	 */
+	uint8_t project_quota_inode_number[ 8 ];
+
+	/* Journal sequence number
+	 * Consists of 8 bytes
+	 */
+	uint8_t journal_sequence_number[ 8 ];
+
+	/* Metadata file system identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t metadata_file_system_identifier[ 16 ];
 };
 
 #if defined( __cplusplus )
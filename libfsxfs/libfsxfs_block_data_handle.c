@@ -24,17 +24,476 @@
 #include <types.h>
 
 #include "libfsxfs_block_data_handle.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_io_engine.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libfdata.h"
+#include "libfsxfs_offset_index.h"
 #include "libfsxfs_unused.h"
 
+/* Creates a block data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_data_handle_initialize(
+     libfsxfs_block_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfsxfs_block_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfsxfs_block_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->io_handle    = io_handle;
+	( *data_handle )->inode_number = inode_number;
+
+	/* The read-ahead data covers a full stripe and at least 2 stripe units
+	 * so that a small read that straddles a stripe unit boundary fits
+	 */
+	if( io_handle->stripe_unit_size != 0 )
+	{
+		( *data_handle )->read_ahead_data_size = (size_t) io_handle->stripe_width;
+
+		if( ( *data_handle )->read_ahead_data_size < ( 2 * (size_t) io_handle->stripe_unit_size ) )
+		{
+			( *data_handle )->read_ahead_data_size = 2 * (size_t) io_handle->stripe_unit_size;
+		}
+	}
+	if( libfsxfs_offset_index_initialize(
+	     &( ( *data_handle )->offset_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create offset index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_data_handle_free(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_data_handle_free";
+	int result            = 1;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		/* The io_handle reference is freed elsewhere
+		 */
+		if( ( *data_handle )->read_ahead_data != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->read_ahead_data );
+		}
+		if( libfsxfs_offset_index_free(
+		     &( ( *data_handle )->offset_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free offset index.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( result );
+}
+
+/* Reads data at a specific offset from the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_block_data_handle_read_at_offset(
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function         = "libfsxfs_block_data_handle_read_at_offset";
+	size_t request_size           = 0;
+	ssize_t read_count            = 0;
+	uint64_t read_start_timestamp = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->io_handle->io_engine != NULL )
+	{
+		/* Requests are split on stripe unit boundaries so that the units
+		 * of a stripe are read concurrently
+		 */
+		request_size = data_handle->io_handle->stripe_unit_size;
+
+		if( request_size == 0 )
+		{
+			request_size = LIBFSXFS_IO_ENGINE_DEFAULT_REQUEST_SIZE;
+		}
+	}
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       data_handle->io_handle );
+
+	if( ( request_size != 0 )
+	 && ( data_size >= ( 2 * request_size ) ) )
+	{
+		read_count = libfsxfs_io_engine_read_buffer_at_offset(
+		              data_handle->io_handle->io_engine,
+		              file_io_handle,
+		              data,
+		              data_size,
+		              offset,
+		              request_size,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              data,
+		              data_size,
+		              offset,
+		              error );
+	}
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	/* File data is not decoded hence the decode start is the read end
+	 */
+	if( libfsxfs_io_handle_add_read(
+	     data_handle->io_handle,
+	     LIBFSXFS_READ_CATEGORY_FILE_DATA,
+	     offset,
+	     (size_t) read_count,
+	     data_handle->inode_number,
+	     read_start_timestamp,
+	     libfsxfs_io_handle_get_timestamp( data_handle->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Appends a segment to the offset index of the data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_block_data_handle_append_segment(
+     libfsxfs_block_data_handle_t *data_handle,
+     off64_t segment_offset,
+     size64_t segment_size,
+     uint32_t segment_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_block_data_handle_append_segment";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_offset_index_append_entry(
+	     data_handle->offset_index,
+	     segment_offset,
+	     segment_size,
+	     segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append offset index entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific logical offset into a buffer
+ * The segments are looked up in the offset index so that the cost of a seek
+ * does not depend on the number of segments
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_block_data_handle_read_buffer_at_offset(
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_offset_index_entry_t *entry = NULL;
+	static char *function                = "libfsxfs_block_data_handle_read_buffer_at_offset";
+	size64_t segment_remainder           = 0;
+	size_t buffer_offset                 = 0;
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	off64_t segment_offset               = 0;
+	int result                           = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = libfsxfs_offset_index_get_entry_at_offset(
+		          data_handle->offset_index,
+		          offset,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset index entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		segment_offset    = offset - entry->logical_offset;
+		segment_remainder = entry->size - (size64_t) segment_offset;
+		read_size         = buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > segment_remainder )
+		{
+			read_size = (size_t) segment_remainder;
+		}
+		data_handle->current_offset = entry->physical_offset + segment_offset;
+
+		read_count = libfsxfs_block_data_handle_read_segment_data(
+		              data_handle,
+		              file_io_handle,
+		              0,
+		              0,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              entry->range_flags,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+		offset        += (off64_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
 /* Reads data from the current offset into a buffer
+ * If the volume has a stripe geometry, reads smaller than the read-ahead data are
+ * served from a read-ahead buffer that starts on a stripe unit boundary
  * Callback for the cluster block data stream
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfsxfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle LIBFSXFS_ATTRIBUTE_UNUSED,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
@@ -44,14 +503,37 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
          uint8_t read_flags LIBFSXFS_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_block_data_handle_read_segment_data";
-	ssize_t read_count    = 0;
+	static char *function         = "libfsxfs_block_data_handle_read_segment_data";
+	size_t read_ahead_data_offset = 0;
+	ssize_t read_count            = 0;
+	off64_t read_ahead_offset     = 0;
 
-	LIBFSXFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( read_flags )
 
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( segment_data == NULL )
 	{
 		libcerror_error_set(
@@ -92,12 +574,21 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
 		}
 		read_count = (ssize_t) segment_data_size;
 	}
-	else
+	else if( ( data_handle->read_ahead_data_size == 0 )
+	      || ( ( segment_data_size + data_handle->io_handle->stripe_unit_size ) > data_handle->read_ahead_data_size ) )
 	{
-		read_count = libbfio_handle_read_buffer(
+		/* Large reads bypass the read-ahead data
+		 *
+		 * The segment data is read at the offset tracked by the data handle
+		 * so that reads of different data streams sharing the file IO handle
+		 * cannot interleave between a seek and a read
+		 */
+		read_count = libfsxfs_block_data_handle_read_at_offset(
+		              data_handle,
 		              file_io_handle,
 		              segment_data,
 		              segment_data_size,
+		              data_handle->current_offset,
 		              error );
 
 		if( read_count < 0 )
@@ -112,6 +603,97 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
 			return( -1 );
 		}
 	}
+	else
+	{
+		/* The read-ahead data is only allocated when first needed since a data handle
+		 * is created for every data stream
+		 */
+		if( data_handle->read_ahead_data == NULL )
+		{
+			data_handle->read_ahead_data = (uint8_t *) memory_allocate(
+			                                            sizeof( uint8_t ) * data_handle->read_ahead_data_size );
+
+			if( data_handle->read_ahead_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read-ahead data.",
+				 function );
+
+				return( -1 );
+			}
+			data_handle->read_ahead_data_offset = 0;
+			data_handle->read_ahead_data_count  = 0;
+		}
+		if( ( data_handle->current_offset < data_handle->read_ahead_data_offset )
+		 || ( (size64_t) ( data_handle->current_offset + segment_data_size ) > (size64_t) ( data_handle->read_ahead_data_offset + data_handle->read_ahead_data_count ) ) )
+		{
+			read_ahead_offset = data_handle->current_offset - ( data_handle->current_offset % data_handle->io_handle->stripe_unit_size );
+
+			data_handle->read_ahead_data_offset = read_ahead_offset;
+			data_handle->read_ahead_data_count  = 0;
+
+			read_count = libfsxfs_block_data_handle_read_at_offset(
+			              data_handle,
+			              file_io_handle,
+			              data_handle->read_ahead_data,
+			              data_handle->read_ahead_data_size,
+			              read_ahead_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read read-ahead data.",
+				 function );
+
+				return( -1 );
+			}
+			data_handle->read_ahead_data_count = (size_t) read_count;
+		}
+		read_ahead_data_offset = (size_t) ( data_handle->current_offset - data_handle->read_ahead_data_offset );
+
+		if( read_ahead_data_offset >= data_handle->read_ahead_data_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) ( data_handle->read_ahead_data_count - read_ahead_data_offset );
+
+		if( read_count > (ssize_t) segment_data_size )
+		{
+			read_count = (ssize_t) segment_data_size;
+		}
+		if( memory_copy(
+		     segment_data,
+		     &( data_handle->read_ahead_data[ read_ahead_data_offset ] ),
+		     (size_t) read_count ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	data_handle->current_offset += read_count;
+
 	return( read_count );
 }
 
@@ -120,8 +702,8 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libfsxfs_block_data_handle_seek_segment_offset(
-         intptr_t *data_handle LIBFSXFS_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
          int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
          off64_t segment_offset,
@@ -129,38 +711,34 @@ off64_t libfsxfs_block_data_handle_seek_segment_offset(
 {
 	static char *function = "libfsxfs_block_data_handle_seek_segment_offset";
 
-	LIBFSXFS_UNREFERENCED_PARAMETER( data_handle )
+	LIBFSXFS_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
 
-	if( segment_offset < 0 )
+	if( data_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     segment_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( segment_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek segment offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 segment_offset,
-		 segment_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	data_handle->current_offset = segment_offset;
+
 	return( segment_offset );
 }
 
@@ -29,13 +29,84 @@
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libfdata.h"
+#include "libfsxfs_offset_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libfsxfs_block_data_handle libfsxfs_block_data_handle_t;
+
+struct libfsxfs_block_data_handle
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The stripe aligned read-ahead data
+	 */
+	uint8_t *read_ahead_data;
+
+	/* The read-ahead data size, where 0 represents read-ahead is disabled
+	 */
+	size_t read_ahead_data_size;
+
+	/* The offset of the read-ahead data
+	 */
+	off64_t read_ahead_data_offset;
+
+	/* The number of bytes in the read-ahead data
+	 */
+	size_t read_ahead_data_count;
+
+	/* The offset index of the segments
+	 */
+	libfsxfs_offset_index_t *offset_index;
+};
+
+int libfsxfs_block_data_handle_initialize(
+     libfsxfs_block_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_block_data_handle_free(
+     libfsxfs_block_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_block_data_handle_read_at_offset(
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libfsxfs_block_data_handle_append_segment(
+     libfsxfs_block_data_handle_t *data_handle,
+     off64_t segment_offset,
+     size64_t segment_size,
+     uint32_t segment_flags,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_block_data_handle_read_buffer_at_offset(
+         libfsxfs_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 ssize_t libfsxfs_block_data_handle_read_segment_data(
-         intptr_t *data_handle,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -46,7 +117,7 @@ ssize_t libfsxfs_block_data_handle_read_segment_data(
          libcerror_error_t **error );
 
 off64_t libfsxfs_block_data_handle_seek_segment_offset(
-         intptr_t *data_handle,
+         libfsxfs_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -610,6 +610,10 @@ int libfsxfs_block_directory_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			if( directory_entry != NULL )
+			{
+				directory_entry->file_type = data[ data_offset ];
+			}
 			data_offset++;
 		}
 		if( alignment_padding_size > 0 )
@@ -721,11 +725,14 @@ int libfsxfs_block_directory_read_file_io_handle(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     uint64_t inode_number,
      libcdata_array_t *entries_array,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_block_directory_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function           = "libfsxfs_block_directory_read_file_io_handle";
+	ssize_t read_count              = 0;
+	uint64_t decode_start_timestamp = 0;
+	uint64_t read_start_timestamp   = 0;
 
 	if( block_directory == NULL )
 	{
@@ -759,6 +766,9 @@ int libfsxfs_block_directory_read_file_io_handle(
 		 file_offset );
 	}
 #endif
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       io_handle );
+
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              block_directory->data,
@@ -779,6 +789,9 @@ int libfsxfs_block_directory_read_file_io_handle(
 
 		return( -1 );
 	}
+	decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                         io_handle );
+
 	if( libfsxfs_block_directory_read_data(
 	     block_directory,
 	     io_handle,
@@ -798,6 +811,25 @@ int libfsxfs_block_directory_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsxfs_io_handle_add_read(
+	     io_handle,
+	     LIBFSXFS_READ_CATEGORY_DIRECTORY,
+	     file_offset,
+	     block_directory->data_size,
+	     inode_number,
+	     read_start_timestamp,
+	     decode_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
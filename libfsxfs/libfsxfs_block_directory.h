@@ -79,6 +79,7 @@ int libfsxfs_block_directory_read_file_io_handle(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     uint64_t inode_number,
      libcdata_array_t *entries_array,
      libcerror_error_t **error );
 
@@ -345,6 +345,7 @@ on_error:
 }
 
 /* Reads the B+ tree block from a Basic File IO (bfio) handle
+ * The read category is the type of B+ tree the block is part of
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_btree_block_read_file_io_handle(
@@ -352,10 +353,14 @@ int libfsxfs_btree_block_read_file_io_handle(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     int read_category,
+     uint64_t inode_number,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_btree_block_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function           = "libfsxfs_btree_block_read_file_io_handle";
+	ssize_t read_count              = 0;
+	uint64_t decode_start_timestamp = 0;
+	uint64_t read_start_timestamp   = 0;
 
 	if( btree_block == NULL )
 	{
@@ -389,6 +394,9 @@ int libfsxfs_btree_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       io_handle );
+
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              btree_block->data,
@@ -409,6 +417,9 @@ int libfsxfs_btree_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                         io_handle );
+
 	if( libfsxfs_btree_block_read_data(
 	     btree_block,
 	     io_handle,
@@ -427,6 +438,25 @@ int libfsxfs_btree_block_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsxfs_io_handle_add_read(
+	     io_handle,
+	     read_category,
+	     file_offset,
+	     btree_block->data_size,
+	     inode_number,
+	     read_start_timestamp,
+	     decode_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
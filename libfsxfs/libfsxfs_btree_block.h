@@ -85,6 +85,8 @@ int libfsxfs_btree_block_read_file_io_handle(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     int read_category,
+     uint64_t inode_number,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -31,6 +31,8 @@
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libfdata.h"
+#include "libfsxfs_space_map.h"
+#include "libfsxfs_unallocated_data_handle.h"
 
 /* Creates data data stream from a buffer of data
  * Make sure the value data_stream is referencing, is set to NULL
@@ -136,6 +138,8 @@ on_error:
 
 /* Creates data data stream from extents
  * Make sure the value data_stream is referencing, is set to NULL
+ * If block_data_handle is set it references the block data handle of the data stream,
+ * which remains managed by the data stream
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_data_stream_initialize_from_extents(
@@ -143,18 +147,21 @@ int libfsxfs_data_stream_initialize_from_extents(
      libfsxfs_io_handle_t *io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     libfsxfs_block_data_handle_t **block_data_handle,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	libfsxfs_extent_t *extent           = NULL;
-	static char *function               = "libfsxfs_data_stream_initialize_from_extents";
-	size64_t data_segment_size          = 0;
-	off64_t data_segment_offset         = 0;
-	uint64_t relative_block_number      = 0;
-	int allocation_group_index          = 0;
-	int extent_index                    = 0;
-	int number_of_extents               = 0;
-	int segment_index                   = 0;
+	libfdata_stream_t *safe_data_stream            = NULL;
+	libfsxfs_block_data_handle_t *data_handle      = NULL;
+	libfsxfs_block_data_handle_t *safe_data_handle = NULL;
+	libfsxfs_extent_t *extent                      = NULL;
+	static char *function                          = "libfsxfs_data_stream_initialize_from_extents";
+	size64_t data_segment_size                     = 0;
+	off64_t data_segment_offset                    = 0;
+	uint64_t relative_block_number                 = 0;
+	int allocation_group_index                     = 0;
+	int extent_index                               = 0;
+	int number_of_extents                          = 0;
+	int segment_index                              = 0;
 
 	if( data_stream == NULL )
 	{
@@ -200,16 +207,42 @@ int libfsxfs_data_stream_initialize_from_extents(
 
 		return( -1 );
 	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_block_data_handle_initialize(
+	     &data_handle,
+	     io_handle,
+	     inode->inode_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block data handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
-	     NULL,
-	     NULL,
+	     (intptr_t *) data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_block_data_handle_free,
 	     NULL,
 	     NULL,
 	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_block_data_handle_read_segment_data,
 	     NULL,
 	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_block_data_handle_seek_segment_offset,
-	     0,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -221,6 +254,11 @@ int libfsxfs_data_stream_initialize_from_extents(
 
 		goto on_error;
 	}
+	/* The data handle is managed by the data stream
+	 */
+	safe_data_handle = data_handle;
+	data_handle = NULL;
+
 	if( libfsxfs_inode_get_number_of_extents(
 	     inode,
 	     &number_of_extents,
@@ -312,6 +350,23 @@ int libfsxfs_data_stream_initialize_from_extents(
 
 			goto on_error;
 		}
+		if( libfsxfs_block_data_handle_append_segment(
+		     safe_data_handle,
+		     data_segment_offset,
+		     data_segment_size,
+		     extent->range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent: %d block data handle segment.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
 	}
 	if( libfdata_stream_set_mapped_size(
 	     safe_data_stream,
@@ -329,6 +384,133 @@ int libfsxfs_data_stream_initialize_from_extents(
 	}
 	*data_stream = safe_data_stream;
 
+	if( block_data_handle != NULL )
+	{
+		*block_data_handle = safe_data_handle;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &safe_data_stream,
+		 NULL );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_block_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates an unallocated data stream from the free extents of a space map
+ * The free extents are mapped in volume offset order
+ * Make sure the value data_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_data_stream_initialize_from_space_map(
+     libfdata_stream_t **data_stream,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_space_map_t *space_map,
+     libcerror_error_t **error )
+{
+	libfdata_stream_t *safe_data_stream             = NULL;
+	libfsxfs_space_map_extent_t *free_extent        = NULL;
+	libfsxfs_unallocated_data_handle_t *data_handle = NULL;
+	static char *function                           = "libfsxfs_data_stream_initialize_from_space_map";
+	int extent_index                                = 0;
+	int segment_index                               = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_unallocated_data_handle_initialize(
+	     &data_handle,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unallocated data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_stream_initialize(
+	     &safe_data_stream,
+	     (intptr_t *) data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_unallocated_data_handle_free,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_unallocated_data_handle_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_unallocated_data_handle_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
+		 function );
+
+		goto on_error;
+	}
+	data_handle = NULL;
+
+	for( extent_index = 0;
+	     extent_index < space_map->number_of_free_extents;
+	     extent_index++ )
+	{
+		free_extent = &( space_map->free_extents[ extent_index ] );
+
+		if( libfdata_stream_append_segment(
+		     safe_data_stream,
+		     &segment_index,
+		     0,
+		     free_extent->offset,
+		     free_extent->size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append free extent: %d data stream segment.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	*data_stream = safe_data_stream;
+
 	return( 1 );
 
 on_error:
@@ -338,11 +520,19 @@ on_error:
 		 &safe_data_stream,
 		 NULL );
 	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_unallocated_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
 	return( -1 );
 }
 
 /* Creates a data stream
  * Make sure the value data_stream is referencing, is set to NULL
+ * If block_data_handle is set it references the block data handle of the data stream
+ * or NULL if the data is not stored in extents
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_data_stream_initialize(
@@ -350,6 +540,7 @@ int libfsxfs_data_stream_initialize(
      libfsxfs_io_handle_t *io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     libfsxfs_block_data_handle_t **block_data_handle,
      libcerror_error_t **error )
 {
 	libfdata_stream_t *safe_data_stream = NULL;
@@ -391,6 +582,10 @@ int libfsxfs_data_stream_initialize(
 
 		return( -1 );
 	}
+	if( block_data_handle != NULL )
+	{
+		*block_data_handle = NULL;
+	}
 	if( ( data_size == 0 )
 	 || ( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA ) )
 	{
@@ -407,6 +602,7 @@ int libfsxfs_data_stream_initialize(
 		          io_handle,
 		          inode,
 		          data_size,
+		          block_data_handle,
 		          error );
 	}
 	if( result != 1 )
@@ -418,6 +614,10 @@ int libfsxfs_data_stream_initialize(
 		 "%s: unable to create data stream.",
 		 function );
 
+		if( block_data_handle != NULL )
+		{
+			*block_data_handle = NULL;
+		}
 		goto on_error;
 	}
 	*data_stream = safe_data_stream;
@@ -25,11 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_block_data_handle.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libfdata.h"
+#include "libfsxfs_space_map.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -46,6 +48,13 @@ int libfsxfs_data_stream_initialize_from_extents(
      libfsxfs_io_handle_t *io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     libfsxfs_block_data_handle_t **block_data_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_data_stream_initialize_from_space_map(
+     libfdata_stream_t **data_stream,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_space_map_t *space_map,
      libcerror_error_t **error );
 
 int libfsxfs_data_stream_initialize(
@@ -53,6 +62,7 @@ int libfsxfs_data_stream_initialize(
      libfsxfs_io_handle_t *io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     libfsxfs_block_data_handle_t **block_data_handle,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
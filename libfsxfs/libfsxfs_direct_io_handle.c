@@ -0,0 +1,1299 @@
+/*
+ * Direct (unbuffered) IO handle functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by glibc for _GNU_SOURCE
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_unused.h"
+
+#if defined( HAVE_LIBFSXFS_DIRECT_IO )
+
+/* Creates a direct IO handle
+ * Make sure the value direct_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_initialize(
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_initialize";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*direct_io_handle = memory_allocate_structure(
+	                     libfsxfs_direct_io_handle_t );
+
+	if( *direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create direct IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *direct_io_handle,
+	     0,
+	     sizeof( libfsxfs_direct_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear direct IO handle.",
+		 function );
+
+		memory_free(
+		 *direct_io_handle );
+
+		*direct_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *direct_io_handle )->file_descriptor = -1;
+	( *direct_io_handle )->alignment       = LIBFSXFS_DIRECT_IO_DEFAULT_SECTOR_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *direct_io_handle != NULL )
+	{
+		memory_free(
+		 *direct_io_handle );
+
+		*direct_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_free(
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_free";
+	int result            = 1;
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *direct_io_handle != NULL )
+	{
+		if( ( *direct_io_handle )->file_descriptor != -1 )
+		{
+			if( libfsxfs_direct_io_handle_close(
+			     *direct_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close direct IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *direct_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *direct_io_handle )->name );
+		}
+		memory_free(
+		 *direct_io_handle );
+
+		*direct_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct IO handle
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_clone(
+     libfsxfs_direct_io_handle_t **destination_direct_io_handle,
+     libfsxfs_direct_io_handle_t *source_direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_clone";
+
+	if( destination_direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_direct_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination direct IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_direct_io_handle == NULL )
+	{
+		*destination_direct_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libfsxfs_direct_io_handle_initialize(
+	     destination_direct_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination direct IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_direct_io_handle->name != NULL )
+	{
+		if( libfsxfs_direct_io_handle_set_name(
+		     *destination_direct_io_handle,
+		     source_direct_io_handle->name,
+		     source_direct_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination direct IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *destination_direct_io_handle )->sector_size = source_direct_io_handle->sector_size;
+
+	return( 1 );
+
+on_error:
+	if( *destination_direct_io_handle != NULL )
+	{
+		libfsxfs_direct_io_handle_free(
+		 destination_direct_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_set_name(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_set_name";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->name != NULL )
+	{
+		memory_free(
+		 direct_io_handle->name );
+
+		direct_io_handle->name      = NULL;
+		direct_io_handle->name_size = 0;
+	}
+	direct_io_handle->name = narrow_string_allocate(
+	                          name_length + 1 );
+
+	if( direct_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     direct_io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 direct_io_handle->name );
+
+		direct_io_handle->name = NULL;
+
+		return( -1 );
+	}
+	direct_io_handle->name[ name_length ] = 0;
+
+	direct_io_handle->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+/* Sets the sector size of the file system
+ * The reads are aligned to the largest of the device and file system sector size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_set_sector_size(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     uint32_t sector_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_set_sector_size";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size < 512 )
+	 || ( sector_size > LIBFSXFS_DIRECT_IO_MAXIMUM_SECTOR_SIZE )
+	 || ( ( sector_size & ( sector_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	direct_io_handle->sector_size = sector_size;
+
+	if( direct_io_handle->file_descriptor != -1 )
+	{
+		/* The buffers remain valid since their offsets are aligned
+		 * to the device sector size
+		 */
+		direct_io_handle->alignment = sector_size;
+
+		if( direct_io_handle->alignment < direct_io_handle->device_sector_size )
+		{
+			direct_io_handle->alignment = direct_io_handle->device_sector_size;
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the direct IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_open(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_open";
+	off64_t end_offset    = 0;
+	int buffer_index      = 0;
+
+#if defined( BLKSSZGET )
+	int device_sector_size = 0;
+#endif
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid direct IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	direct_io_handle->file_descriptor = open(
+	                                     direct_io_handle->name,
+	                                     O_RDONLY | O_DIRECT );
+
+	if( direct_io_handle->file_descriptor == -1 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s for direct IO.",
+		 function,
+		 direct_io_handle->name );
+
+		goto on_error;
+	}
+	/* The size of a block device is not provided by fstat
+	 */
+	end_offset = lseek(
+	              direct_io_handle->file_descriptor,
+	              0,
+	              SEEK_END );
+
+	if( end_offset == -1 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 direct_io_handle->name );
+
+		goto on_error;
+	}
+	direct_io_handle->size           = (size64_t) end_offset;
+	direct_io_handle->current_offset = 0;
+
+	/* Files that are not a block device are assumed to require
+	 * the minimum sector size alignment
+	 */
+	direct_io_handle->device_sector_size = 512;
+
+#if defined( BLKSSZGET )
+	if( ioctl(
+	     direct_io_handle->file_descriptor,
+	     BLKSSZGET,
+	     &device_sector_size ) == 0 )
+	{
+		if( ( device_sector_size >= 512 )
+		 && ( device_sector_size <= LIBFSXFS_DIRECT_IO_MAXIMUM_SECTOR_SIZE )
+		 && ( ( device_sector_size & ( device_sector_size - 1 ) ) == 0 ) )
+		{
+			direct_io_handle->device_sector_size = (uint32_t) device_sector_size;
+		}
+	}
+#endif
+	/* The file system sector size is not known before the superblock has been read
+	 */
+	if( direct_io_handle->sector_size != 0 )
+	{
+		direct_io_handle->alignment = direct_io_handle->sector_size;
+	}
+	else
+	{
+		direct_io_handle->alignment = LIBFSXFS_DIRECT_IO_DEFAULT_SECTOR_SIZE;
+	}
+	if( direct_io_handle->alignment < direct_io_handle->device_sector_size )
+	{
+		direct_io_handle->alignment = direct_io_handle->device_sector_size;
+	}
+	/* The buffers are aligned to the maximum sector size so that
+	 * they remain usable when the alignment changes
+	 */
+	for( buffer_index = 0;
+	     buffer_index < LIBFSXFS_DIRECT_IO_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( posix_memalign(
+		     (void **) &( direct_io_handle->buffers[ buffer_index ].data ),
+		     LIBFSXFS_DIRECT_IO_MAXIMUM_SECTOR_SIZE,
+		     LIBFSXFS_DIRECT_IO_BUFFER_SIZE ) != 0 )
+		{
+			direct_io_handle->buffers[ buffer_index ].data = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		direct_io_handle->buffers[ buffer_index ].offset     = 0;
+		direct_io_handle->buffers[ buffer_index ].data_count = 0;
+	}
+	direct_io_handle->next_buffer_index = 0;
+
+	return( 1 );
+
+on_error:
+	if( direct_io_handle->file_descriptor != -1 )
+	{
+		libfsxfs_direct_io_handle_close(
+		 direct_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the direct IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_close(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_close";
+	int buffer_index      = 0;
+	int result            = 0;
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     direct_io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 direct_io_handle->name );
+
+		result = -1;
+	}
+	direct_io_handle->file_descriptor = -1;
+	direct_io_handle->current_offset  = 0;
+	direct_io_handle->size            = 0;
+
+	/* The buffers are allocated by posix_memalign and hence freed by free
+	 */
+	for( buffer_index = 0;
+	     buffer_index < LIBFSXFS_DIRECT_IO_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( direct_io_handle->buffers[ buffer_index ].data != NULL )
+		{
+			free(
+			 direct_io_handle->buffers[ buffer_index ].data );
+
+			direct_io_handle->buffers[ buffer_index ].data = NULL;
+		}
+		direct_io_handle->buffers[ buffer_index ].offset     = 0;
+		direct_io_handle->buffers[ buffer_index ].data_count = 0;
+	}
+	return( result );
+}
+
+/* Reads aligned data at a specific offset
+ * The offset, size and buffer must be aligned to the alignment of the direct IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_direct_io_handle_read_aligned(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_read_aligned";
+	ssize_t read_count    = 0;
+	size_t buffer_offset  = 0;
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( offset % direct_io_handle->alignment ) != 0 )
+	 || ( ( size % direct_io_handle->alignment ) != 0 )
+	 || ( ( (intptr_t) buffer % direct_io_handle->alignment ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read - not aligned.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		read_count = pread(
+		              direct_io_handle->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset,
+		              offset + buffer_offset );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read: %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 size - buffer_offset,
+			 offset + buffer_offset,
+			 offset + buffer_offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+
+		/* A partial read that is not aligned can only occur at the end of the data
+		 */
+		if( ( buffer_offset % direct_io_handle->alignment ) != 0 )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads a buffer from the current offset
+ * Reads are issued with sector aligned offsets and sizes into sector aligned buffers,
+ * either directly into the buffer, if it is suitably aligned, or via the buffer pool
+ * Callback for the libbfio handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_direct_io_handle_read_buffer(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	libfsxfs_direct_io_buffer_t *direct_io_buffer = NULL;
+	static char *function                         = "libfsxfs_direct_io_handle_read_buffer";
+	size_t buffer_offset                          = 0;
+	size_t data_offset                            = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	off64_t aligned_offset                        = 0;
+	int buffer_index                              = 0;
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) direct_io_handle->current_offset >= direct_io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( direct_io_handle->size - direct_io_handle->current_offset ) )
+	{
+		size = (size_t) ( direct_io_handle->size - direct_io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		read_size = size - buffer_offset;
+
+		if( ( ( direct_io_handle->current_offset % direct_io_handle->alignment ) == 0 )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % direct_io_handle->alignment ) == 0 )
+		 && ( read_size >= LIBFSXFS_DIRECT_IO_BUFFER_SIZE ) )
+		{
+			/* Large aligned reads bypass the buffer pool
+			 */
+			read_size -= read_size % direct_io_handle->alignment;
+
+			read_count = libfsxfs_direct_io_handle_read_aligned(
+			              direct_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              direct_io_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			direct_io_buffer = NULL;
+
+			for( buffer_index = 0;
+			     buffer_index < LIBFSXFS_DIRECT_IO_NUMBER_OF_BUFFERS;
+			     buffer_index++ )
+			{
+				if( ( direct_io_handle->current_offset >= direct_io_handle->buffers[ buffer_index ].offset )
+				 && ( direct_io_handle->current_offset < (off64_t) ( direct_io_handle->buffers[ buffer_index ].offset + direct_io_handle->buffers[ buffer_index ].data_count ) ) )
+				{
+					direct_io_buffer = &( direct_io_handle->buffers[ buffer_index ] );
+
+					break;
+				}
+			}
+			if( direct_io_buffer == NULL )
+			{
+				direct_io_buffer = &( direct_io_handle->buffers[ direct_io_handle->next_buffer_index ] );
+
+				direct_io_handle->next_buffer_index++;
+
+				if( direct_io_handle->next_buffer_index >= LIBFSXFS_DIRECT_IO_NUMBER_OF_BUFFERS )
+				{
+					direct_io_handle->next_buffer_index = 0;
+				}
+				aligned_offset = direct_io_handle->current_offset - ( direct_io_handle->current_offset % direct_io_handle->alignment );
+
+				direct_io_buffer->offset     = aligned_offset;
+				direct_io_buffer->data_count = 0;
+
+				read_count = libfsxfs_direct_io_handle_read_aligned(
+				              direct_io_handle,
+				              direct_io_buffer->data,
+				              LIBFSXFS_DIRECT_IO_BUFFER_SIZE,
+				              aligned_offset,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read buffer: %d.",
+					 function,
+					 buffer_index );
+
+					return( -1 );
+				}
+				direct_io_buffer->data_count = (size_t) read_count;
+
+				if( direct_io_handle->current_offset >= (off64_t) ( direct_io_buffer->offset + direct_io_buffer->data_count ) )
+				{
+					break;
+				}
+			}
+			data_offset = (size_t) ( direct_io_handle->current_offset - direct_io_buffer->offset );
+			read_count  = (ssize_t) ( direct_io_buffer->data_count - data_offset );
+
+			if( read_count > (ssize_t) read_size )
+			{
+				read_count = (ssize_t) read_size;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( direct_io_buffer->data[ data_offset ] ),
+			     (size_t) read_count ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy buffer data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		direct_io_handle->current_offset += read_count;
+		buffer_offset                    += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer at the current offset
+ * Callback for the libbfio handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libfsxfs_direct_io_handle_write_buffer(
+         libfsxfs_direct_io_handle_t *direct_io_handle LIBFSXFS_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer LIBFSXFS_ATTRIBUTE_UNUSED,
+         size_t size LIBFSXFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_write_buffer";
+
+	LIBFSXFS_UNREFERENCED_PARAMETER( direct_io_handle )
+	LIBFSXFS_UNREFERENCED_PARAMETER( buffer )
+	LIBFSXFS_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset
+ * Callback for the libbfio handle
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsxfs_direct_io_handle_seek_offset(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_seek_offset";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += direct_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) direct_io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	direct_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Determines if the file exists
+ * Callback for the libbfio handle
+ * Returns 1 if the file exists, 0 if not or -1 on error
+ */
+int libfsxfs_direct_io_handle_exists(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_exists";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( access(
+	     direct_io_handle->name,
+	     F_OK ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the direct IO handle is open
+ * Callback for the libbfio handle
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libfsxfs_direct_io_handle_is_open(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_is_open";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size
+ * Callback for the libbfio handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_handle_get_size(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_direct_io_handle_get_size";
+
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid direct IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = direct_io_handle->size;
+
+	return( 1 );
+}
+
+/* Creates a file IO handle that uses direct IO
+ * The direct IO handle is managed by the file IO handle and remains valid until it is freed
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_direct_io_file_initialize(
+     libbfio_handle_t **file_io_handle,
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libfsxfs_direct_io_handle_t *safe_direct_io_handle = NULL;
+	static char *function                              = "libfsxfs_direct_io_file_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_direct_io_handle_initialize(
+	     &safe_direct_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create direct IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_direct_io_handle_set_name(
+	     safe_direct_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in direct IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) safe_direct_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_direct_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsxfs_direct_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) &libfsxfs_direct_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfsxfs_direct_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) &libfsxfs_direct_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) &libfsxfs_direct_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) &libfsxfs_direct_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfsxfs_direct_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfsxfs_direct_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) &libfsxfs_direct_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*direct_io_handle = safe_direct_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_direct_io_handle != NULL )
+	{
+		libfsxfs_direct_io_handle_free(
+		 &safe_direct_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_DIRECT_IO ) */
+
@@ -0,0 +1,188 @@
+/*
+ * Direct (unbuffered) IO handle functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DIRECT_IO_HANDLE_H )
+#define _LIBFSXFS_DIRECT_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( HAVE_DECL_O_DIRECT ) && ( HAVE_DECL_O_DIRECT == 1 ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H ) && defined( HAVE_POSIX_MEMALIGN ) && defined( HAVE_PREAD ) && !defined( WINAPI )
+#define HAVE_LIBFSXFS_DIRECT_IO		1
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSXFS_DIRECT_IO )
+
+typedef struct libfsxfs_direct_io_buffer libfsxfs_direct_io_buffer_t;
+
+struct libfsxfs_direct_io_buffer
+{
+	/* The aligned data
+	 */
+	uint8_t *data;
+
+	/* The offset of the data
+	 */
+	off64_t offset;
+
+	/* The number of bytes in the data
+	 */
+	size_t data_count;
+};
+
+typedef struct libfsxfs_direct_io_handle libfsxfs_direct_io_handle_t;
+
+struct libfsxfs_direct_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The sector size of the device
+	 */
+	uint32_t device_sector_size;
+
+	/* The sector size of the file system
+	 */
+	uint32_t sector_size;
+
+	/* The alignment of the offset, size and data of a read
+	 */
+	uint32_t alignment;
+
+	/* The buffer pool
+	 */
+	libfsxfs_direct_io_buffer_t buffers[ LIBFSXFS_DIRECT_IO_NUMBER_OF_BUFFERS ];
+
+	/* The index of the buffer to reuse next
+	 */
+	int next_buffer_index;
+};
+
+int libfsxfs_direct_io_handle_initialize(
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_free(
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_clone(
+     libfsxfs_direct_io_handle_t **destination_direct_io_handle,
+     libfsxfs_direct_io_handle_t *source_direct_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_set_name(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_set_sector_size(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     uint32_t sector_size,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_open(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_close(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_direct_io_handle_read_aligned(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_direct_io_handle_read_buffer(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_direct_io_handle_write_buffer(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libfsxfs_direct_io_handle_seek_offset(
+         libfsxfs_direct_io_handle_t *direct_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_exists(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_is_open(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_handle_get_size(
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libfsxfs_direct_io_file_initialize(
+     libbfio_handle_t **file_io_handle,
+     libfsxfs_direct_io_handle_t **direct_io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_DIRECT_IO ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECT_IO_HANDLE_H ) */
+
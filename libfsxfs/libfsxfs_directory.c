@@ -194,6 +194,7 @@ int libfsxfs_directory_read_file_io_handle(
 	uint64_t relative_block_number              = 0;
 	int allocation_group_index                  = 0;
 	int extent_index                            = 0;
+	int number_of_entries                       = 0;
 	int number_of_extents                       = 0;
 
 	if( directory == NULL )
@@ -412,6 +413,36 @@ int libfsxfs_directory_read_file_io_handle(
 
 				while( extent_size > 0 )
 				{
+					if( libcdata_array_get_number_of_entries(
+					     directory->entries_array,
+					     &number_of_entries,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve number of entries.",
+						 function );
+
+						goto on_error;
+					}
+					if( libfsxfs_io_handle_update_progress(
+					     io_handle,
+					     LIBFSXFS_PROGRESS_TYPE_DIRECTORY_ENTRIES,
+					     inode->inode_number,
+					     (uint64_t) number_of_entries,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to update progress.",
+						 function );
+
+						goto on_error;
+					}
 					if( libfsxfs_block_directory_initialize(
 					     &block_directory,
 					     io_handle->block_size,
@@ -431,6 +462,7 @@ int libfsxfs_directory_read_file_io_handle(
 					     io_handle,
 					     file_io_handle,
 					     block_directory_offset,
+					     inode->inode_number,
 					     directory->entries_array,
 					     error ) != 1 )
 					{
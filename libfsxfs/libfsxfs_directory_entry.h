@@ -46,6 +46,11 @@ struct libfsxfs_directory_entry
 	/* Name size
 	 */
 	uint8_t name_size;
+
+	/* File type
+	 * Contains 0 if the directory does not record the file type
+	 */
+	uint8_t file_type;
 };
 
 int libfsxfs_directory_entry_initialize(
@@ -66,6 +71,11 @@ int libfsxfs_directory_entry_get_inode_number(
      uint64_t *inode_number,
      libcerror_error_t **error );
 
+int libfsxfs_directory_entry_get_file_type(
+     libfsxfs_directory_entry_t *directory_entry,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
 int libfsxfs_directory_entry_get_utf8_name_size(
      libfsxfs_directory_entry_t *directory_entry,
      size_t *utf8_string_size,
@@ -409,6 +409,8 @@ int libfsxfs_directory_table_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			directory_entry->file_type = data[ data_offset ];
+
 			data_offset++;
 		}
 		if( directory_table->header->inode_number_data_size == 4 )
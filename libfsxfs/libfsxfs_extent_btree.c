@@ -29,7 +29,9 @@
 #include "libfsxfs_extent.h"
 #include "libfsxfs_extent_btree.h"
 #include "libfsxfs_extents.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 
@@ -39,6 +41,7 @@
  */
 int libfsxfs_extent_btree_initialize(
      libfsxfs_extent_btree_t **extent_btree,
+     uint64_t inode_number,
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_extent_btree_initialize";
@@ -93,6 +96,8 @@ int libfsxfs_extent_btree_initialize(
 
 		goto on_error;
 	}
+	( *extent_btree )->inode_number = inode_number;
+
 	return( 1 );
 
 on_error:
@@ -557,6 +562,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 	uint64_t relative_block_number      = 0;
 	int allocation_group_index          = 0;
 	int compare_result                  = 0;
+	int number_of_extents               = 0;
 
 	if( extent_btree == NULL )
 	{
@@ -625,6 +631,36 @@ int libfsxfs_extent_btree_get_extents_from_node(
 
 	btree_block_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
 
+	if( libcdata_array_get_number_of_entries(
+	     extents_array,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_io_handle_update_progress(
+	     io_handle,
+	     LIBFSXFS_PROGRESS_TYPE_EXTENTS,
+	     extent_btree->inode_number,
+	     (uint64_t) number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update progress.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfsxfs_btree_block_initialize(
 	     &btree_block,
 	     io_handle->block_size,
@@ -645,6 +681,8 @@ int libfsxfs_extent_btree_get_extents_from_node(
 	     io_handle,
 	     file_io_handle,
 	     btree_block_offset,
+	     LIBFSXFS_READ_CATEGORY_EXTENT_BTREE,
+	     extent_btree->inode_number,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
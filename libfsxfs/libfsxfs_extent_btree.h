@@ -41,10 +41,15 @@ struct libfsxfs_extent_btree
 	/* B+ tree maximum depth
 	 */
 	uint32_t maximum_depth;
+
+	/* The inode number of the owner
+	 */
+	uint64_t inode_number;
 };
 
 int libfsxfs_extent_btree_initialize(
      libfsxfs_extent_btree_t **extent_btree,
+     uint64_t inode_number,
      libcerror_error_t **error );
 
 int libfsxfs_extent_btree_free(
@@ -23,12 +23,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_block_data_handle.h"
 #include "libfsxfs_data_stream.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
@@ -36,6 +38,8 @@
 #include "libfsxfs_libfdata.h"
 #include "libfsxfs_libfdatetime.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_read_batch.h"
+#include "libfsxfs_read_queue.h"
 #include "libfsxfs_types.h"
 
 /* Creates a file entry
@@ -141,6 +145,7 @@ int libfsxfs_file_entry_initialize(
 		     io_handle,
 		     inode,
 		     internal_file_entry->data_size,
+		     &( internal_file_entry->block_data_handle ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -391,6 +396,104 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the sub directory entry for the specific index
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsxfs_directory_entry_t **sub_directory_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_get_sub_directory_entry_by_index";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory == NULL )
+	{
+		if( libfsxfs_io_handle_add_cache_lookup(
+		     internal_file_entry->io_handle,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsxfs_internal_file_entry_get_directory(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory for inode: %" PRIu64 ".",
+			 function,
+			 internal_file_entry->inode_number );
+
+			return( -1 );
+		}
+	}
+	else if( libfsxfs_io_handle_add_cache_lookup(
+	          internal_file_entry->io_handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add cache lookup statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_directory_get_entry_by_index(
+	     internal_file_entry->directory,
+	     sub_file_entry_index,
+	     sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determines the symbolic link data
  * Returns 1 if successful or -1 on error
  */
@@ -1462,9 +1565,23 @@ int libfsxfs_file_entry_get_utf8_symbolic_link_target_size(
 #endif
 	if( internal_file_entry->symbolic_link_data == NULL )
 	{
-		if( libfsxfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
+		if( libfsxfs_io_handle_add_cache_lookup(
+		     internal_file_entry->io_handle,
+		     0,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_internal_file_entry_get_symbolic_link_data(
+		          internal_file_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1476,6 +1593,20 @@ int libfsxfs_file_entry_get_utf8_symbolic_link_target_size(
 			result = -1;
 		}
 	}
+	else if( libfsxfs_io_handle_add_cache_lookup(
+	          internal_file_entry->io_handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add cache lookup statistics.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		result = libuna_utf8_string_size_from_utf8_stream(
@@ -1558,9 +1689,23 @@ int libfsxfs_file_entry_get_utf8_symbolic_link_target(
 #endif
 	if( internal_file_entry->symbolic_link_data == NULL )
 	{
-		if( libfsxfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
+		if( libfsxfs_io_handle_add_cache_lookup(
+		     internal_file_entry->io_handle,
+		     0,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_internal_file_entry_get_symbolic_link_data(
+		          internal_file_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1572,6 +1717,20 @@ int libfsxfs_file_entry_get_utf8_symbolic_link_target(
 			result = -1;
 		}
 	}
+	else if( libfsxfs_io_handle_add_cache_lookup(
+	          internal_file_entry->io_handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add cache lookup statistics.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		result = libuna_utf8_string_copy_from_utf8_stream(
@@ -1648,7 +1807,7 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1656,7 +1815,7 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1664,9 +1823,23 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 #endif
 	if( internal_file_entry->directory == NULL )
 	{
-		if( libfsxfs_internal_file_entry_get_directory(
-		     internal_file_entry,
+		if( libfsxfs_io_handle_add_cache_lookup(
+		     internal_file_entry->io_handle,
+		     0,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_internal_file_entry_get_directory(
+		          internal_file_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1679,6 +1852,20 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 			result = -1;
 		}
 	}
+	else if( libfsxfs_io_handle_add_cache_lookup(
+	          internal_file_entry->io_handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add cache lookup statistics.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_file_entry->directory != NULL )
 	{
 		if( libfsxfs_directory_get_number_of_entries(
@@ -1697,7 +1884,7 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 		}
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1705,7 +1892,7 @@ int libfsxfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1782,9 +1969,23 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 #endif
 	if( internal_file_entry->directory == NULL )
 	{
-		if( libfsxfs_internal_file_entry_get_directory(
-		     internal_file_entry,
+		if( libfsxfs_io_handle_add_cache_lookup(
+		     internal_file_entry->io_handle,
+		     0,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_internal_file_entry_get_directory(
+		          internal_file_entry,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1797,6 +1998,20 @@ int libfsxfs_file_entry_get_sub_file_entry_by_index(
 			result = -1;
 		}
 	}
+	else if( libfsxfs_io_handle_add_cache_lookup(
+	          internal_file_entry->io_handle,
+	          1,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add cache lookup statistics.",
+		 function );
+
+		result = -1;
+	}
 	if( result != -1 )
 	{
 		if( libfsxfs_directory_get_entry_by_index(
@@ -2071,18 +2286,20 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
-/* Reads data at the current offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the inode number of the sub file entry for the specific index
+ * The inode of the sub file entry is not read
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_get_sub_file_entry_inode_number_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_inode_number_by_index";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -2097,28 +2314,6 @@ ssize_t libfsxfs_file_entry_read_buffer(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( internal_file_entry->inode == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
@@ -2134,24 +2329,39 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
-
-	if( read_count < 0 )
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
-		read_count = -1;
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_inode_number(
+		          sub_directory_entry,
+		          inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2168,22 +2378,23 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the file type of the sub file entry for the specific index
+ * The file type is only available if the directory records it, the inode of the sub file entry is not read
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer_at_offset(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *file_type,
+     libcerror_error_t **error )
 {
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_get_sub_file_entry_file_type_by_index";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -2198,20 +2409,1081 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( internal_file_entry->inode == NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
-	{
-		libcerror_error_set(
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_file_type(
+		          sub_directory_entry,
+		          file_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file type of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of the sub file entry for the specific index
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_utf8_sub_file_entry_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_utf8_sub_file_entry_name_size_by_index";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_utf8_name_size(
+		          sub_directory_entry,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name of the sub file entry for the specific index
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_utf8_sub_file_entry_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_utf8_sub_file_entry_name_by_index";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_utf8_name(
+		          sub_directory_entry,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name of the sub file entry for the specific index
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_utf16_sub_file_entry_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_utf16_sub_file_entry_name_size_by_index";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_utf16_name_size(
+		          sub_directory_entry,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 name size of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name of the sub file entry for the specific index
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_get_utf16_sub_file_entry_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *sub_directory_entry     = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_get_utf16_sub_file_entry_name_by_index";
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+	     internal_file_entry,
+	     sub_file_entry_index,
+	     &sub_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub directory entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_directory_entry_get_utf16_name(
+		          sub_directory_entry,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 name of sub directory entry: %d.",
+			 function,
+			 sub_file_entry_index );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at the current offset from the data stream
+ * The data is read in chunks so that abort can be checked and progress reported in between
+ * Data stored in extents is read via the offset index of the block data handle
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_internal_file_entry_read_buffer_from_data_stream(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_read_buffer_from_data_stream";
+	size_t buffer_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_size = buffer_size - buffer_offset;
+
+		if( read_size > (size_t) LIBFSXFS_MAXIMUM_READ_CHUNK_SIZE )
+		{
+			read_size = (size_t) LIBFSXFS_MAXIMUM_READ_CHUNK_SIZE;
+		}
+		if( internal_file_entry->block_data_handle != NULL )
+		{
+			if( (size64_t) internal_file_entry->current_offset >= internal_file_entry->data_size )
+			{
+				break;
+			}
+			if( (size64_t) read_size > ( internal_file_entry->data_size - internal_file_entry->current_offset ) )
+			{
+				read_size = (size_t) ( internal_file_entry->data_size - internal_file_entry->current_offset );
+			}
+			read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+			              internal_file_entry->block_data_handle,
+			              internal_file_entry->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              internal_file_entry->current_offset,
+			              error );
+
+			if( read_count > 0 )
+			{
+				internal_file_entry->current_offset += (off64_t) read_count;
+			}
+		}
+		else
+		{
+			read_count = libfdata_stream_read_buffer(
+			              internal_file_entry->data_stream,
+			              (intptr_t *) internal_file_entry->file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              0,
+			              error );
+		}
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+
+		if( libfsxfs_io_handle_update_progress(
+		     internal_file_entry->io_handle,
+		     LIBFSXFS_PROGRESS_TYPE_DATA,
+		     internal_file_entry->inode_number,
+		     (uint64_t) buffer_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Seeks a certain offset in the data
+ * For data stored in extents the offset is tracked by the file entry and the segment
+ * is looked up in the offset index of the block data handle when the data is read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsxfs_internal_file_entry_seek_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_file_entry_seek_offset";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->block_data_handle == NULL )
+	{
+		offset = libfdata_stream_seek_offset(
+		          internal_file_entry->data_stream,
+		          offset,
+		          whence,
+		          error );
+
+		if( offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data stream.",
+			 function );
+
+			return( -1 );
+		}
+		return( offset );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file_entry->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_file_entry->data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry->current_offset = offset;
+
+	return( offset );
+}
+
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfsxfs_internal_file_entry_read_buffer_from_data_stream(
+	              internal_file_entry,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer_at_offset(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_file_entry_seek_offset(
+	     internal_file_entry,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in data stream.",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfsxfs_internal_file_entry_read_buffer_from_data_stream(
+		              internal_file_entry,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Submits an asynchronous read of data at a specific offset
+ * The read is queued on the volume and performed by libfsxfs_volume_poll_reads or
+ * libfsxfs_volume_wait_reads, which call the callback with the number of bytes read
+ * or -1 on error. The file entry and buffer must remain valid until the callback is called.
+ * Pending reads are cancelled, with a read count of -1, when the volume is closed.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_read_async(
+     libfsxfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            intptr_t *callback_data,
+            libfsxfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_async";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle->read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - invalid IO handle - missing read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_read_queue_push_request(
+	     internal_file_entry->io_handle->read_queue,
+	     file_entry,
+	     (uint8_t *) buffer,
+	     buffer_size,
+	     offset,
+	     callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push request onto read queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads multiple ranges of data
+ * The ranges are resolved into reads on the volume, which are sorted by their offset
+ * and merged when adjacent, and read in a single batch. The number of bytes read of
+ * every range is stored in read_counts, where -1 represents a range that could not
+ * be read. Reading a range does not change the current offset.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_entry_read_ranges(
+     libfsxfs_file_entry_t *file_entry,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *range_error                      = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsxfs_read_batch_t *read_batch                   = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_ranges";
+	int range_index                                     = 0;
+	int result                                          = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
@@ -2220,8 +3492,84 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		read_counts[ range_index ] = -1;
+	}
+	if( libfsxfs_read_batch_initialize(
+	     &read_batch,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2229,34 +3577,53 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
+		libfsxfs_read_batch_free(
+		 &read_batch,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              0,
-	              error );
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( libfsxfs_read_batch_add_range(
+		     read_batch,
+		     internal_file_entry->inode,
+		     internal_file_entry->data_size,
+		     (uint8_t *) buffers[ range_index ],
+		     buffer_sizes[ range_index ],
+		     offsets[ range_index ],
+		     &( read_counts[ range_index ] ),
+		     &range_error ) != 1 )
+		{
+			/* A range that cannot be resolved fails on its own
+			 */
+			read_counts[ range_index ] = -1;
 
-	if( read_count < 0 )
+			libcerror_error_free(
+			 &range_error );
+		}
+	}
+	if( libfsxfs_read_batch_flush(
+	     read_batch,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
+		 "%s: unable to read batch.",
 		 function );
 
-		read_count = -1;
+		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2264,13 +3631,35 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
 #endif
-	return( read_count );
+	if( libfsxfs_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			read_counts[ range_index ] = -1;
+		}
+	}
+	return( result );
 }
 
 /* Seeks a certain offset in the data
@@ -2335,8 +3724,8 @@ off64_t libfsxfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_file_entry->data_stream,
+	offset = libfsxfs_internal_file_entry_seek_offset(
+	          internal_file_entry,
 	          offset,
 	          whence,
 	          error );
@@ -2432,10 +3821,28 @@ int libfsxfs_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_get_offset(
-	     internal_file_entry->data_stream,
-	     offset,
-	     error ) != 1 )
+	if( internal_file_entry->block_data_handle != NULL )
+	{
+		if( offset == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid offset.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*offset = internal_file_entry->current_offset;
+		}
+	}
+	else if( libfdata_stream_get_offset(
+	          internal_file_entry->data_stream,
+	          offset,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_block_data_handle.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_extern.h"
@@ -81,6 +82,15 @@ struct libfsxfs_internal_file_entry
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The block data handle of the data stream, which is managed by the data stream
+	 * or NULL if the data is not stored in extents
+	 */
+	libfsxfs_block_data_handle_t *block_data_handle;
+
+	/* The current offset of the data, used when the block data handle is set
+	 */
+	off64_t current_offset;
+
 	/* The symbolic link data
 	 */
 	uint8_t *symbolic_link_data;
@@ -115,6 +125,12 @@ int libfsxfs_internal_file_entry_get_directory(
      libfsxfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_file_entry_get_sub_directory_entry_by_index(
+     libfsxfs_internal_file_entry_t *internal_file_entry,
+     int sub_file_entry_index,
+     libfsxfs_directory_entry_t **sub_directory_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_internal_file_entry_get_symbolic_link_data(
      libfsxfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
@@ -248,6 +264,62 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_inode_number_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *file_type,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_utf8_sub_file_entry_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_utf8_sub_file_entry_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_utf16_sub_file_entry_name_size_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_get_utf16_sub_file_entry_name_by_index(
+     libfsxfs_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_internal_file_entry_read_buffer_from_data_stream(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+off64_t libfsxfs_internal_file_entry_seek_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 ssize_t libfsxfs_file_entry_read_buffer(
          libfsxfs_file_entry_t *file_entry,
@@ -263,6 +335,30 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_read_async(
+     libfsxfs_file_entry_t *file_entry,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            intptr_t *callback_data,
+            libfsxfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_read_ranges(
+     libfsxfs_file_entry_t *file_entry,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 off64_t libfsxfs_file_entry_seek_offset(
          libfsxfs_file_entry_t *file_entry,
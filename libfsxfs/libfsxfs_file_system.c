@@ -28,6 +28,7 @@
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_allocation_map.h"
 #include "libfsxfs_inode_btree.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_libbfio.h"
@@ -35,6 +36,7 @@
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_sidecar_index.h"
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
@@ -202,6 +204,38 @@ int libfsxfs_file_system_free(
 
 			result = -1;
 		}
+		if( ( *file_system )->sidecar_index != NULL )
+		{
+			if( libfsxfs_sidecar_index_free(
+			     &( ( *file_system )->sidecar_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sidecar index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_system )->inode_allocation_map != NULL )
+		{
+			if( libfsxfs_inode_allocation_map_free(
+			     &( ( *file_system )->inode_allocation_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode allocation map.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *file_system );
 
@@ -265,10 +299,12 @@ int libfsxfs_file_system_get_inode_by_number(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *safe_inode = NULL;
-	static char *function        = "libfsxfs_file_system_get_inode_by_number";
-	off64_t file_offset          = 0;
-	int result                   = 0;
+	libfsxfs_inode_t *safe_inode    = NULL;
+	static char *function           = "libfsxfs_file_system_get_inode_by_number";
+	off64_t file_offset             = 0;
+	uint64_t allocation_group_index = 0;
+	uint64_t relative_inode_number  = 0;
+	int result                      = 0;
 
 	if( file_system == NULL )
 	{
@@ -315,14 +351,45 @@ int libfsxfs_file_system_get_inode_by_number(
 
 		return( -1 );
 	}
-	result = libfsxfs_inode_btree_get_inode_by_number(
-	          file_system->inode_btree,
-	          io_handle,
-	          file_io_handle,
-	          inode_number,
-	          &file_offset,
-	          error );
+	/* The inode allocation map and the sidecar index allow to determine
+	 * if the inode is allocated without reading the inode B+ tree
+	 */
+	if( ( file_system->inode_allocation_map != NULL )
+	 || ( file_system->sidecar_index != NULL ) )
+	{
+		if( file_system->inode_allocation_map != NULL )
+		{
+			result = libfsxfs_inode_allocation_map_is_inode_allocated(
+			          file_system->inode_allocation_map,
+			          inode_number,
+			          error );
+		}
+		else
+		{
+			result = libfsxfs_sidecar_index_has_inode(
+			          file_system->sidecar_index,
+			          inode_number,
+			          error );
+		}
+		if( result == 1 )
+		{
+			allocation_group_index = inode_number >> io_handle->number_of_relative_inode_number_bits;
+			relative_inode_number  = inode_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_inode_number_bits ) - 1 );
 
+			file_offset = ( (off64_t) ( allocation_group_index * io_handle->allocation_group_size ) * io_handle->block_size )
+			            + ( (off64_t) relative_inode_number * io_handle->inode_size );
+		}
+	}
+	else
+	{
+		result = libfsxfs_inode_btree_get_inode_by_number(
+		          file_system->inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          inode_number,
+		          &file_offset,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -366,6 +433,7 @@ int libfsxfs_file_system_get_inode_by_number(
 		     io_handle,
 		     file_io_handle,
 		     file_offset,
+		     inode_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -408,16 +476,17 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	libfsxfs_inode_t *safe_inode                     = NULL;
-	const uint8_t *utf8_string_segment               = NULL;
-	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf8_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf8_string_index                         = 0;
-	size_t utf8_string_segment_length                = 0;
-	uint64_t safe_inode_number                       = 0;
-	int result                                       = 0;
+	libfsxfs_directory_t *directory                   = NULL;
+	libfsxfs_directory_entry_t *index_directory_entry = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry  = NULL;
+	libfsxfs_inode_t *safe_inode                      = NULL;
+	const uint8_t *utf8_string_segment                = NULL;
+	static char *function                             = "libfsxfs_file_system_get_directory_entry_by_utf8_path";
+	libuna_unicode_character_t unicode_character      = 0;
+	size_t utf8_string_index                          = 0;
+	size_t utf8_string_segment_length                 = 0;
+	uint64_t safe_inode_number                        = 0;
+	int result                                        = 0;
 
 	if( file_system == NULL )
 	{
@@ -503,6 +572,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 
 		goto on_error;
 	}
+	if( file_system->sidecar_index != NULL )
+	{
+		if( libfsxfs_directory_entry_initialize(
+		     &index_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( ( utf8_string_length == 0 )
 	 || ( utf8_string_length == 1 ) )
 	{
@@ -510,51 +595,54 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	else while( utf8_string_index < utf8_string_length )
 	{
-		if( directory != NULL )
+		if( file_system->sidecar_index == NULL )
 		{
-			if( libfsxfs_directory_free(
+			if( directory != NULL )
+			{
+				if( libfsxfs_directory_free(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfsxfs_directory_initialize(
 			     &directory,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
+			if( libfsxfs_directory_read_file_io_handle(
+			     directory,
+			     io_handle,
+			     file_io_handle,
+			     safe_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory from inode: %" PRIu64 ".",
+				 function,
+				 safe_inode_number );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
 		utf8_string_segment_length = utf8_string_index;
@@ -591,6 +679,18 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 		{
 			result = 0;
 		}
+		else if( file_system->sidecar_index != NULL )
+		{
+			result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+			          file_system->sidecar_index,
+			          safe_inode_number,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          index_directory_entry,
+			          error );
+
+			safe_directory_entry = index_directory_entry;
+		}
 		else
 		{
 			result = libfsxfs_directory_get_entry_by_utf8_name(
@@ -718,12 +818,40 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 			goto on_error;
 		}
 	}
+	if( index_directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &index_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index directory entry.",
+			 function );
+
+			safe_directory_entry = NULL;
+
+			goto on_error;
+		}
+	}
 	*inode_number = safe_inode_number;
 	*inode        = safe_inode;
 
 	return( result );
 
 on_error:
+	if( index_directory_entry != NULL )
+	{
+		if( safe_directory_entry == index_directory_entry )
+		{
+			safe_directory_entry = NULL;
+		}
+		libfsxfs_directory_entry_free(
+		 &index_directory_entry,
+		 NULL );
+	}
 	if( safe_directory_entry != NULL )
 	{
 		libfsxfs_directory_entry_free(
@@ -759,16 +887,20 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
-	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
-	libfsxfs_inode_t *safe_inode                     = NULL;
-	const uint16_t *utf16_string_segment             = NULL;
-	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf16_path";
-	libuna_unicode_character_t unicode_character     = 0;
-	size_t utf16_string_index                        = 0;
-	size_t utf16_string_segment_length               = 0;
-	uint64_t safe_inode_number                       = 0;
-	int result                                       = 0;
+	libfsxfs_directory_t *directory                   = NULL;
+	libfsxfs_directory_entry_t *index_directory_entry = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry  = NULL;
+	libfsxfs_inode_t *safe_inode                      = NULL;
+	const uint16_t *utf16_string_segment              = NULL;
+	static char *function                             = "libfsxfs_file_system_get_directory_entry_by_utf16_path";
+	uint8_t utf8_name[ 256 ];
+
+	libuna_unicode_character_t unicode_character      = 0;
+	size_t utf16_string_index                         = 0;
+	size_t utf16_string_segment_length                = 0;
+	size_t utf8_name_size                             = 0;
+	uint64_t safe_inode_number                        = 0;
+	int result                                        = 0;
 
 	if( file_system == NULL )
 	{
@@ -854,6 +986,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 
 		goto on_error;
 	}
+	if( file_system->sidecar_index != NULL )
+	{
+		if( libfsxfs_directory_entry_initialize(
+		     &index_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( ( utf16_string_length == 0 )
 	 || ( utf16_string_length == 1 ) )
 	{
@@ -861,51 +1009,54 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	else while( utf16_string_index < utf16_string_length )
 	{
-		if( directory != NULL )
+		if( file_system->sidecar_index == NULL )
 		{
-			if( libfsxfs_directory_free(
+			if( directory != NULL )
+			{
+				if( libfsxfs_directory_free(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfsxfs_directory_initialize(
 			     &directory,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
+			if( libfsxfs_directory_read_file_io_handle(
+			     directory,
+			     io_handle,
+			     file_io_handle,
+			     safe_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory from inode: %" PRIu64 ".",
+				 function,
+				 safe_inode_number );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
 		utf16_string_segment_length = utf16_string_index;
@@ -942,6 +1093,57 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 		{
 			result = 0;
 		}
+		else if( file_system->sidecar_index != NULL )
+		{
+			/* The sidecar index stores the names UTF-8 encoded
+			 */
+			if( libuna_utf8_string_size_from_utf16(
+			     utf16_string_segment,
+			     utf16_string_segment_length,
+			     &utf8_name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 name size.",
+				 function );
+
+				goto on_error;
+			}
+			if( utf8_name_size > 256 )
+			{
+				result = 0;
+			}
+			else
+			{
+				if( libuna_utf8_string_copy_from_utf16(
+				     utf8_name,
+				     256,
+				     utf16_string_segment,
+				     utf16_string_segment_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy UTF-16 name to UTF-8.",
+					 function );
+
+					goto on_error;
+				}
+				result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+				          file_system->sidecar_index,
+				          safe_inode_number,
+				          utf8_name,
+				          utf8_name_size,
+				          index_directory_entry,
+				          error );
+			}
+			safe_directory_entry = index_directory_entry;
+		}
 		else
 		{
 			result = libfsxfs_directory_get_entry_by_utf16_name(
@@ -1069,12 +1271,40 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 			goto on_error;
 		}
 	}
+	if( index_directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_free(
+		     &index_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index directory entry.",
+			 function );
+
+			safe_directory_entry = NULL;
+
+			goto on_error;
+		}
+	}
 	*inode_number = safe_inode_number;
 	*inode        = safe_inode;
 
 	return( result );
 
 on_error:
+	if( index_directory_entry != NULL )
+	{
+		if( safe_directory_entry == index_directory_entry )
+		{
+			safe_directory_entry = NULL;
+		}
+		libfsxfs_directory_entry_free(
+		 &index_directory_entry,
+		 NULL );
+	}
 	if( safe_directory_entry != NULL )
 	{
 		libfsxfs_directory_entry_free(
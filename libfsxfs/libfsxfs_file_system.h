@@ -27,10 +27,12 @@
 
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_allocation_map.h"
 #include "libfsxfs_inode_btree.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_sidecar_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,6 +46,14 @@ struct libfsxfs_file_system
 	 */
 	libfsxfs_inode_btree_t *inode_btree;
 
+	/* The sidecar index
+	 */
+	libfsxfs_sidecar_index_t *sidecar_index;
+
+	/* The inode allocation map
+	 */
+	libfsxfs_inode_allocation_map_t *inode_allocation_map;
+
 	/* The root directory inode number
 	 */
 	uint64_t root_directory_inode_number;
@@ -0,0 +1,679 @@
+/*
+ * Free space B+ tree functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_btree_block.h"
+#include "libfsxfs_btree_header.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_free_space_btree.h"
+#include "libfsxfs_free_space_information.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_space_map.h"
+
+/* Creates a free space B+ tree
+ * Make sure the value free_space_btree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_btree_initialize(
+     libfsxfs_free_space_btree_t **free_space_btree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_free_space_btree_initialize";
+
+	if( free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *free_space_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid free space B+ tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*free_space_btree = memory_allocate_structure(
+	                     libfsxfs_free_space_btree_t );
+
+	if( *free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free space B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *free_space_btree,
+	     0,
+	     sizeof( libfsxfs_free_space_btree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear free space B+ tree.",
+		 function );
+
+		memory_free(
+		 *free_space_btree );
+
+		*free_space_btree = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *free_space_btree )->free_space_information_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free space information array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *free_space_btree != NULL )
+	{
+		memory_free(
+		 *free_space_btree );
+
+		*free_space_btree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a free space B+ tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_btree_free(
+     libfsxfs_free_space_btree_t **free_space_btree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_free_space_btree_free";
+	int result            = 1;
+
+	if( free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *free_space_btree != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *free_space_btree )->free_space_information_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_free_space_information_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free free space information array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *free_space_btree );
+
+		*free_space_btree = NULL;
+	}
+	return( result );
+}
+
+/* Reads the free space information
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_btree_read_free_space_information(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_free_space_information_t *free_space_information = NULL;
+	static char *function                                     = "libfsxfs_free_space_btree_read_free_space_information";
+	int entry_index                                           = 0;
+
+	if( free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_free_space_information_initialize(
+	     &free_space_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free space information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_free_space_information_read_file_io_handle(
+	     free_space_information,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read free space information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     free_space_btree->free_space_information_array,
+	     &entry_index,
+	     (intptr_t *) free_space_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append free space information to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( free_space_information != NULL )
+	{
+		libfsxfs_free_space_information_free(
+		 &free_space_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the free extents from the free space B+ tree node
+ * The free extents are appended to the space map in order of their block number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_btree_get_extents_from_node(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_space_map_t *space_map,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_free_space_btree_get_extents_from_node";
+	off64_t btree_block_offset          = 0;
+	size_t number_of_key_value_pairs    = 0;
+	size_t records_data_offset          = 0;
+	uint32_t number_of_blocks           = 0;
+	uint32_t relative_sub_block_number  = 0;
+	uint32_t start_block_number         = 0;
+	uint16_t record_index               = 0;
+	int compare_result                  = 0;
+
+	if( free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+
+	if( libfsxfs_btree_block_initialize(
+	     &btree_block,
+	     io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     btree_block,
+	     io_handle,
+	     file_io_handle,
+	     btree_block_offset,
+	     LIBFSXFS_READ_CATEGORY_FREE_SPACE_BTREE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read free space B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "AB3B",
+		                  4 );
+	}
+	else
+	{
+		compare_result = memory_compare(
+		                  btree_block->header->signature,
+		                  "ABTB",
+		                  4 );
+	}
+	if( compare_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid block signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( btree_block->header->level == 0 )
+	{
+		if( (size_t) btree_block->header->number_of_records > ( btree_block->records_data_size / 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < btree_block->header->number_of_records;
+		     record_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( btree_block->records_data[ records_data_offset ] ),
+			 start_block_number );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( btree_block->records_data[ records_data_offset + 4 ] ),
+			 number_of_blocks );
+
+			records_data_offset += 8;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: record: %03" PRIu16 " start block number\t: %" PRIu32 "\n",
+				 function,
+				 record_index,
+				 start_block_number );
+
+				libcnotify_printf(
+				 "%s: record: %03" PRIu16 " number of blocks\t: %" PRIu32 "\n",
+				 function,
+				 record_index,
+				 number_of_blocks );
+			}
+#endif
+			if( number_of_blocks == 0 )
+			{
+				continue;
+			}
+			if( libfsxfs_space_map_append_free_extent(
+			     space_map,
+			     (off64_t) ( allocation_group_block_number + start_block_number ) * io_handle->block_size,
+			     (size64_t) number_of_blocks * io_handle->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append free extent: %" PRIu16 " to space map.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		/* The branch node contains 8 byte keys followed by 4 byte sub node block numbers
+		 */
+		number_of_key_value_pairs = btree_block->records_data_size / 12;
+
+		if( (size_t) btree_block->header->number_of_records > number_of_key_value_pairs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < btree_block->header->number_of_records;
+		     record_index++ )
+		{
+			records_data_offset = ( number_of_key_value_pairs * 8 ) + ( (size_t) record_index * 4 );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( btree_block->records_data[ records_data_offset ] ),
+			 relative_sub_block_number );
+
+			if( libfsxfs_free_space_btree_get_extents_from_node(
+			     free_space_btree,
+			     io_handle,
+			     file_io_handle,
+			     allocation_group_block_number,
+			     relative_sub_block_number,
+			     space_map,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extents from sub node: %" PRIu32 ".",
+				 function,
+				 relative_sub_block_number );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfsxfs_btree_block_free(
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the free extents of a specific allocation group
+ * The free extents are appended to the space map and the remainder of the allocation group is mapped as allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_btree_get_extents(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_space_map_t *space_map,
+     libcerror_error_t **error )
+{
+	libfsxfs_free_space_information_t *free_space_information = NULL;
+	static char *function                                     = "libfsxfs_free_space_btree_get_extents";
+	uint64_t allocation_group_block_number                    = 0;
+
+	if( free_space_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     free_space_btree->free_space_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &free_space_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve free space information: %d.",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	if( free_space_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing free space information.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_space_information->number_of_blocks > io_handle->allocation_group_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid free space information - number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	if( libfsxfs_free_space_btree_get_extents_from_node(
+	     free_space_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_block_number,
+	     free_space_information->block_btree_root_block_number,
+	     space_map,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extents from root node: %" PRIu32 ".",
+		 function,
+		 free_space_information->block_btree_root_block_number );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_map_extend(
+	     space_map,
+	     (off64_t) ( allocation_group_block_number + free_space_information->number_of_blocks ) * io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to extend space map to end of allocation group: %d.",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,86 @@
+/*
+ * Free space B+ tree functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_FREE_SPACE_BTREE_H )
+#define _LIBFSXFS_FREE_SPACE_BTREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_free_space_information.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_space_map.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_free_space_btree libfsxfs_free_space_btree_t;
+
+struct libfsxfs_free_space_btree
+{
+	/* Free space information array
+	 */
+	libcdata_array_t *free_space_information_array;
+};
+
+int libfsxfs_free_space_btree_initialize(
+     libfsxfs_free_space_btree_t **free_space_btree,
+     libcerror_error_t **error );
+
+int libfsxfs_free_space_btree_free(
+     libfsxfs_free_space_btree_t **free_space_btree,
+     libcerror_error_t **error );
+
+int libfsxfs_free_space_btree_read_free_space_information(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_free_space_btree_get_extents_from_node(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libfsxfs_space_map_t *space_map,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_free_space_btree_get_extents(
+     libfsxfs_free_space_btree_t *free_space_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libfsxfs_space_map_t *space_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_FREE_SPACE_BTREE_H ) */
+
@@ -0,0 +1,595 @@
+/*
+ * Free space information functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_debug.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_free_space_information.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libfguid.h"
+
+#include "fsxfs_free_space_information.h"
+
+/* Creates free space information
+ * Make sure the value free_space_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_information_initialize(
+     libfsxfs_free_space_information_t **free_space_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_free_space_information_initialize";
+
+	if( free_space_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *free_space_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid free space information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*free_space_information = memory_allocate_structure(
+	                           libfsxfs_free_space_information_t );
+
+	if( *free_space_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free space information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *free_space_information,
+	     0,
+	     sizeof( libfsxfs_free_space_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear free space information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *free_space_information != NULL )
+	{
+		memory_free(
+		 *free_space_information );
+
+		*free_space_information = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees free space information
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_information_free(
+     libfsxfs_free_space_information_t **free_space_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_free_space_information_free";
+
+	if( free_space_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *free_space_information != NULL )
+	{
+		memory_free(
+		 *free_space_information );
+
+		*free_space_information = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the free space information data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_information_read_data(
+     libfsxfs_free_space_information_t *free_space_information,
+     libfsxfs_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libfsxfs_free_space_information_read_data";
+	size_t free_space_information_data_size = 0;
+	uint32_t format_version                 = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                    = 0;
+	uint32_t value_32bit                    = 0;
+#endif
+
+	if( free_space_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free space information.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->format_version >= 5 )
+	{
+		free_space_information_data_size = sizeof( fsxfs_free_space_information_v5_t );
+	}
+	else
+	{
+		free_space_information_data_size = sizeof( fsxfs_free_space_information_t );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < free_space_information_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: free space information data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 free_space_information_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( memory_compare(
+	     ( (fsxfs_free_space_information_t *) data )->signature,
+	     "XAGF",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->number_of_blocks,
+	 free_space_information->number_of_blocks );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->block_btree_root_block_number,
+	 free_space_information->block_btree_root_block_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->count_btree_root_block_number,
+	 free_space_information->count_btree_root_block_number );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->block_btree_depth,
+	 free_space_information->block_btree_depth );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->count_btree_depth,
+	 free_space_information->count_btree_depth );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_free_space_information_t *) data )->number_of_free_blocks,
+	 free_space_information->number_of_free_blocks );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t\t: %c%c%c%c\n",
+		 function,
+		 ( (fsxfs_free_space_information_t *) data )->signature[ 0 ],
+		 ( (fsxfs_free_space_information_t *) data )->signature[ 1 ],
+		 ( (fsxfs_free_space_information_t *) data )->signature[ 2 ],
+		 ( (fsxfs_free_space_information_t *) data )->signature[ 3 ] );
+
+		libcnotify_printf(
+		 "%s: format version\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->sequence_number,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: sequence number\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: number of blocks\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->number_of_blocks );
+
+		libcnotify_printf(
+		 "%s: block number B+ tree root block number\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->block_btree_root_block_number );
+
+		libcnotify_printf(
+		 "%s: block count B+ tree root block number\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->count_btree_root_block_number );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->reverse_mapping_btree_root_block_number,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: reverse mapping B+ tree root block number\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: block number B+ tree depth\t\t\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->block_btree_depth );
+
+		libcnotify_printf(
+		 "%s: block count B+ tree depth\t\t\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->count_btree_depth );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->reverse_mapping_btree_depth,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: reverse mapping B+ tree depth\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->free_list_first_index,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: free list first index\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->free_list_last_index,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: free list last index\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->free_list_number_of_blocks,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: free list number of blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: number of free blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 free_space_information->number_of_free_blocks );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->longest_free_extent,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: longest free extent\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_free_space_information_t *) data )->number_of_btree_blocks,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: number of B+ tree blocks\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( free_space_information->block_btree_depth == 0 )
+	 || ( free_space_information->block_btree_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number B+ tree depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->format_version >= 5 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfsxfs_debug_print_guid_value(
+			     function,
+			     "block type identifier\t\t\t",
+			     ( (fsxfs_free_space_information_v5_t *) data )->block_type_identifier,
+			     16,
+			     LIBFGUID_ENDIAN_BIG,
+			     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print GUID value.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->reverse_mapping_number_of_blocks,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: reverse mapping number of blocks\t\t: %" PRIu32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->reference_count_number_of_blocks,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: reference count number of blocks\t\t: %" PRIu32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->reference_count_btree_root_block_number,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: reference count B+ tree root block number\t: %" PRIu32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->reference_count_btree_depth,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: reference count B+ tree depth\t\t: %" PRIu32 "\n",
+			 function,
+			 value_32bit );
+
+			libcnotify_printf(
+			 "%s: unknown1:\n",
+			 function );
+			libcnotify_print_data(
+			 ( (fsxfs_free_space_information_v5_t *) data )->unknown1,
+			 14 * 8,
+			 0 );
+
+			byte_stream_copy_to_uint64_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->log_sequence_number,
+			 value_64bit );
+			libcnotify_printf(
+			 "%s: log sequence number\t\t\t: %" PRIu64 "\n",
+			 function,
+			 value_64bit );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->checksum,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_free_space_information_v5_t *) data )->unknown2,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: unknown2\t\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the free space information from a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_free_space_information_read_file_io_handle(
+     libfsxfs_free_space_information_t *free_space_information,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t data[ 512 ];
+
+	static char *function           = "libfsxfs_free_space_information_read_file_io_handle";
+	ssize_t read_count              = 0;
+	uint64_t decode_start_timestamp = 0;
+	uint64_t read_start_timestamp   = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading free space information at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       io_handle );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              512,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read free space information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                         io_handle );
+
+	if( libfsxfs_free_space_information_read_data(
+	     free_space_information,
+	     io_handle,
+	     data,
+	     512,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read free space information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( libfsxfs_io_handle_add_read(
+	     io_handle,
+	     LIBFSXFS_READ_CATEGORY_SUPERBLOCK,
+	     file_offset,
+	     512,
+	     0,
+	     read_start_timestamp,
+	     decode_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -117,20 +117,6 @@ int libfsxfs_inode_initialize(
 
 		return( -1 );
 	}
-	( *inode )->data = (uint8_t *) memory_allocate(
-	                                sizeof( uint8_t ) * inode_size );
-
-	if( ( *inode )->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create inode data.",
-		 function );
-
-		goto on_error;
-	}
 	( *inode )->data_size = inode_size;
 
 	return( 1 );
@@ -169,10 +155,10 @@ int libfsxfs_inode_free(
 	}
 	if( *inode != NULL )
 	{
-		if( ( *inode )->data != NULL )
+		if( ( *inode )->inline_data != NULL )
 		{
 			memory_free(
-			 ( *inode )->data );
+			 ( *inode )->inline_data );
 		}
 		if( ( *inode )->data_extents_array != NULL )
 		{
@@ -386,6 +372,10 @@ int libfsxfs_inode_read_data(
 
 	inode->attributes_fork_offset = (uint16_t) ( (fsxfs_inode_v1_t *) data )->attributes_fork_offset * 8;
 
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_v1_t *) data )->next_unlinked_inode_number,
+	 inode->next_unlinked_inode_number );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -603,13 +593,10 @@ int libfsxfs_inode_read_data(
 		 function,
 		 value_32bit );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_inode_v3_t *) data )->unknown7,
-		 value_32bit );
 		libcnotify_printf(
-		 "%s: unknown7\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 "%s: next unlinked inode number\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 value_32bit );
+		 inode->next_unlinked_inode_number );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -765,19 +752,24 @@ int libfsxfs_inode_read_data(
 	return( 1 );
 }
 
-/* Reads the inode from a Basic File IO (bfio) handle
+/* Reads the inode from data that was read from a specific offset
+ * The data is only needed while decoding, the data fork is read into the inode
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_read_file_io_handle(
+int libfsxfs_inode_read_buffer(
      libfsxfs_inode_t *inode,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
      off64_t file_offset,
+     uint64_t inode_number,
+     uint64_t read_start_timestamp,
      libcerror_error_t **error )
 {
 	libfsxfs_extent_btree_t *extent_btree = NULL;
-	static char *function                 = "libfsxfs_inode_read_file_io_handle";
-	ssize_t read_count                    = 0;
+	static char *function                 = "libfsxfs_inode_read_buffer";
+	uint64_t decode_start_timestamp       = 0;
 	uint64_t number_of_blocks             = 0;
 	uint8_t add_sparse_extents            = 0;
 
@@ -792,51 +784,48 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
+	if( inode->inline_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - inline data value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( io_handle == NULL )
 	{
-		libcnotify_printf(
-		 "%s: reading inode at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              inode->data,
-	              inode->data_size,
-	              file_offset,
-	              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	if( read_count != (ssize_t) inode->data_size )
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
+	inode->inode_number = inode_number;
+
+	decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                         io_handle );
+
 	if( libfsxfs_inode_read_data(
 	     inode,
-	     inode->data,
-	     inode->data_size,
+	     data,
+	     data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -848,7 +837,26 @@ int libfsxfs_inode_read_file_io_handle(
 		 file_offset,
 		 file_offset );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libfsxfs_io_handle_add_read(
+	     io_handle,
+	     LIBFSXFS_READ_CATEGORY_INODE,
+	     file_offset,
+	     inode->data_size,
+	     inode->inode_number,
+	     read_start_timestamp,
+	     decode_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		goto on_error;
 	}
 	number_of_blocks = inode->size / io_handle->block_size;
 
@@ -871,7 +879,7 @@ int libfsxfs_inode_read_file_io_handle(
 			 "%s: invalid inline data size value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -880,12 +888,42 @@ int libfsxfs_inode_read_file_io_handle(
 			 "%s: inline data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( inode->data[ inode->data_fork_offset ] ),
+			 &( data[ inode->data_fork_offset ] ),
 			 (size_t) inode->size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
-		inode->inline_data = &( inode->data[ inode->data_fork_offset ] );
+		if( inode->size > 0 )
+		{
+			inode->inline_data = (uint8_t *) memory_allocate(
+			                                  sizeof( uint8_t ) * (size_t) inode->size );
+
+			if( inode->inline_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create inline data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     inode->inline_data,
+			     &( data[ inode->data_fork_offset ] ),
+			     (size_t) inode->size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy inline data.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 	else if( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
 	{
@@ -907,7 +945,7 @@ int libfsxfs_inode_read_file_io_handle(
 		     inode->data_extents_array,
 		     number_of_blocks,
 		     inode->number_of_data_extents,
-		     &( inode->data[ inode->data_fork_offset ] ),
+		     &( data[ inode->data_fork_offset ] ),
 		     inode->data_fork_size,
 		     add_sparse_extents,
 		     error ) != 1 )
@@ -940,6 +978,7 @@ int libfsxfs_inode_read_file_io_handle(
 		}
 		if( libfsxfs_extent_btree_initialize(
 		     &extent_btree,
+		     inode->inode_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -956,7 +995,7 @@ int libfsxfs_inode_read_file_io_handle(
 		     io_handle,
 		     file_io_handle,
 		     number_of_blocks,
-		     &( inode->data[ inode->data_fork_offset ] ),
+		     &( data[ inode->data_fork_offset ] ),
 		     inode->data_fork_size,
 		     inode->data_extents_array,
 		     add_sparse_extents,
@@ -988,6 +1027,13 @@ int libfsxfs_inode_read_file_io_handle(
 	return( 1 );
 
 on_error:
+	if( inode->inline_data != NULL )
+	{
+		memory_free(
+		 inode->inline_data );
+
+		inode->inline_data = NULL;
+	}
 	if( extent_btree != NULL )
 	{
 		libfsxfs_extent_btree_free(
@@ -1004,6 +1050,140 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the inode from a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_file_io_handle(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	uint8_t *inode_data           = NULL;
+	static char *function         = "libfsxfs_inode_read_file_io_handle";
+	ssize_t read_count            = 0;
+	uint64_t read_start_timestamp = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->inline_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - inline data value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading inode at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	/* The on-disk inode data is only needed while decoding
+	 */
+	inode_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * inode->data_size );
+
+	if( inode_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode data.",
+		 function );
+
+		goto on_error;
+	}
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       io_handle );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              inode_data,
+	              inode->data_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) inode->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_read_buffer(
+	     inode,
+	     io_handle,
+	     file_io_handle,
+	     inode_data,
+	     inode->data_size,
+	     file_offset,
+	     inode_number,
+	     read_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	memory_free(
+	 inode_data );
+
+	return( 1 );
+
+on_error:
+	if( inode_data != NULL )
+	{
+		memory_free(
+		 inode_data );
+	}
+	return( -1 );
+}
+
 /* Retrieves the creation time
  * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1234,6 +1414,43 @@ int libfsxfs_inode_get_group_identifier(
 	return( 1 );
 }
 
+/* Retrieves the number of (hard) links
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_get_number_of_links(
+     libfsxfs_inode_t *inode,
+     uint32_t *number_of_links,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_get_number_of_links";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_links == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of links.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_links = inode->number_of_links;
+
+	return( 1 );
+}
+
 /* Retrieves the file mode
  * Returns 1 if successful or -1 on error
  */
@@ -39,13 +39,13 @@ typedef struct libfsxfs_inode libfsxfs_inode_t;
 
 struct libfsxfs_inode
 {
-	/* Data
+	/* The size of the on-disk inode
 	 */
-	uint8_t *data;
+	size_t data_size;
 
-	/* Data size
+	/* The inode number
 	 */
-	size_t data_size;
+	uint64_t inode_number;
 
 	/* Format version
 	 */
@@ -92,8 +92,9 @@ struct libfsxfs_inode
 	uint64_t size;
 
 	/* Inline data
+	 * Copied from the data fork, NULL if the inline data is empty
 	 */
-	const uint8_t *inline_data;
+	uint8_t *inline_data;
 
 	/* Number of data extents
 	 */
@@ -114,6 +115,10 @@ struct libfsxfs_inode
 	/* Attributes fork offset
 	 */
 	uint16_t attributes_fork_offset;
+
+	/* Next unlinked (relative) inode number
+	 */
+	uint32_t next_unlinked_inode_number;
 };
 
 int libfsxfs_inode_initialize(
@@ -131,11 +136,23 @@ int libfsxfs_inode_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsxfs_inode_read_buffer(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     uint64_t inode_number,
+     uint64_t read_start_timestamp,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_read_file_io_handle(
      libfsxfs_inode_t *inode,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
+     uint64_t inode_number,
      libcerror_error_t **error );
 
 int libfsxfs_inode_get_creation_time(
@@ -168,6 +185,11 @@ int libfsxfs_inode_get_group_identifier(
      uint32_t *group_identifier,
      libcerror_error_t **error );
 
+int libfsxfs_inode_get_number_of_links(
+     libfsxfs_inode_t *inode,
+     uint32_t *number_of_links,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_get_file_mode(
      libfsxfs_inode_t *inode,
      uint16_t *file_mode,
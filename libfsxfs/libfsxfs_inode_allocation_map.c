@@ -0,0 +1,716 @@
+/*
+ * Inode allocation map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode_allocation_map.h"
+#include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+
+/* Creates an inode allocation map
+ * Make sure the value inode_allocation_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_allocation_map_initialize(
+     libfsxfs_inode_allocation_map_t **inode_allocation_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_allocation_map_initialize";
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_allocation_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode allocation map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_allocation_map = memory_allocate_structure(
+	                         libfsxfs_inode_allocation_map_t );
+
+	if( *inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_allocation_map,
+	     0,
+	     sizeof( libfsxfs_inode_allocation_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode allocation map.",
+		 function );
+
+		memory_free(
+		 *inode_allocation_map );
+
+		*inode_allocation_map = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_allocation_map != NULL )
+	{
+		memory_free(
+		 *inode_allocation_map );
+
+		*inode_allocation_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode allocation map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_allocation_map_free(
+     libfsxfs_inode_allocation_map_t **inode_allocation_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_allocation_map_free";
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_allocation_map != NULL )
+	{
+		if( ( *inode_allocation_map )->chunks != NULL )
+		{
+			memory_free(
+			 ( *inode_allocation_map )->chunks );
+		}
+		memory_free(
+		 *inode_allocation_map );
+
+		*inode_allocation_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an inode chunk to the inode allocation map
+ * The inode chunks must be appended in increasing order of their first inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_allocation_map_append_chunk(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t first_inode_number,
+     uint64_t free_inodes_bitmap,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_allocation_map_chunk_t *safe_chunks = NULL;
+	static char *function                              = "libfsxfs_inode_allocation_map_append_chunk";
+	size_t safe_maximum_number_of_chunks               = 0;
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_allocation_map->number_of_chunks > 0 )
+	{
+		/* An inode chunk consists of 64 inodes
+		 */
+		if( first_inode_number < ( inode_allocation_map->chunks[ inode_allocation_map->number_of_chunks - 1 ].first_inode_number + 64 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid first inode number value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( inode_allocation_map->number_of_chunks >= inode_allocation_map->maximum_number_of_chunks )
+	{
+		if( inode_allocation_map->maximum_number_of_chunks == 0 )
+		{
+			safe_maximum_number_of_chunks = LIBFSXFS_INODE_ALLOCATION_MAP_INITIAL_NUMBER_OF_CHUNKS;
+		}
+		else
+		{
+			safe_maximum_number_of_chunks = inode_allocation_map->maximum_number_of_chunks * 2;
+		}
+		if( ( safe_maximum_number_of_chunks <= inode_allocation_map->maximum_number_of_chunks )
+		 || ( safe_maximum_number_of_chunks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_inode_allocation_map_chunk_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of chunks value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_chunks = (libfsxfs_inode_allocation_map_chunk_t *) memory_reallocate(
+		                                                         inode_allocation_map->chunks,
+		                                                         sizeof( libfsxfs_inode_allocation_map_chunk_t ) * safe_maximum_number_of_chunks );
+
+		if( safe_chunks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize chunks.",
+			 function );
+
+			return( -1 );
+		}
+		inode_allocation_map->chunks                   = safe_chunks;
+		inode_allocation_map->maximum_number_of_chunks = safe_maximum_number_of_chunks;
+	}
+	inode_allocation_map->chunks[ inode_allocation_map->number_of_chunks ].first_inode_number = first_inode_number;
+	inode_allocation_map->chunks[ inode_allocation_map->number_of_chunks ].free_inodes_bitmap = free_inodes_bitmap;
+
+	inode_allocation_map->number_of_chunks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the inode chunk that contains a specific inode number
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t inode_number,
+     libfsxfs_inode_allocation_map_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_allocation_map_get_chunk_by_inode_number";
+	size_t chunk_index    = 0;
+	size_t lower_index    = 0;
+	size_t upper_index    = 0;
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	/* Search for the last inode chunk with a first inode number equal or less than the inode number
+	 */
+	upper_index = inode_allocation_map->number_of_chunks;
+
+	while( lower_index < upper_index )
+	{
+		chunk_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( inode_allocation_map->chunks[ chunk_index ].first_inode_number <= inode_number )
+		{
+			lower_index = chunk_index + 1;
+		}
+		else
+		{
+			upper_index = chunk_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	/* An inode chunk consists of 64 inodes
+	 */
+	if( ( inode_number - inode_allocation_map->chunks[ lower_index - 1 ].first_inode_number ) >= 64 )
+	{
+		return( 0 );
+	}
+	*chunk = &( inode_allocation_map->chunks[ lower_index - 1 ] );
+
+	return( 1 );
+}
+
+/* Reads the inode allocation map of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_allocation_map_read_allocation_group(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *records_array                   = NULL;
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	static char *function                             = "libfsxfs_inode_allocation_map_read_allocation_group";
+	uint64_t first_inode_number                       = 0;
+	int number_of_records                             = 0;
+	int record_index                                  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	libfsxfs_inode_allocation_map_chunk_t *chunk      = NULL;
+	int result                                        = 0;
+#endif
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &records_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records array.",
+		 function );
+
+		goto on_error;
+	}
+	/* The inode B+ tree contains a record for every inode chunk, the free inode
+	 * B+ tree only for the inode chunks that contain free inodes
+	 */
+	if( libfsxfs_inode_btree_get_records(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     (int) allocation_group_index,
+	     records_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode B+ tree records of allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     records_array,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     records_array,
+		     record_index,
+		     (intptr_t **) &inode_btree_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( inode_btree_record == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		first_inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+		                   | inode_btree_record->inode_number;
+
+		if( libfsxfs_inode_allocation_map_append_chunk(
+		     inode_allocation_map,
+		     first_inode_number,
+		     inode_btree_record->chunk_allocation_bitmap,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append inode chunk: %" PRIu64 ".",
+			 function,
+			 first_inode_number );
+
+			goto on_error;
+		}
+		inode_allocation_map->number_of_free_inodes += inode_btree_record->number_of_unused_inodes;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		/* Cross check the free inodes bitmaps with the free inode B+ tree
+		 */
+		if( libcdata_array_empty(
+		     records_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty records array.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfsxfs_inode_btree_get_free_records(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          (int) allocation_group_index,
+		          records_array,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve free inode B+ tree records of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcdata_array_get_number_of_entries(
+			     records_array,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of free records.",
+				 function );
+
+				goto on_error;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     records_array,
+				     record_index,
+				     (intptr_t **) &inode_btree_record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve free record: %d.",
+					 function,
+					 record_index );
+
+					goto on_error;
+				}
+				first_inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+				                   | inode_btree_record->inode_number;
+
+				result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+				          inode_allocation_map,
+				          first_inode_number,
+				          &chunk,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve inode chunk: %" PRIu64 ".",
+					 function,
+					 first_inode_number );
+
+					goto on_error;
+				}
+				else if( ( result == 0 )
+				      || ( chunk->first_inode_number != first_inode_number )
+				      || ( chunk->free_inodes_bitmap != inode_btree_record->chunk_allocation_bitmap ) )
+				{
+					libcnotify_printf(
+					 "%s: mismatch between inode and free inode B+ tree record of inode chunk: %" PRIu64 ".\n",
+					 function,
+					 first_inode_number );
+				}
+			}
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libcdata_array_free(
+	     &records_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( records_array != NULL )
+	{
+		libcdata_array_free(
+		 &records_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inode allocation map of all allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_allocation_map_read_file_system(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsxfs_inode_allocation_map_read_file_system";
+	uint32_t allocation_group_index = 0;
+
+	if( inode_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsxfs_inode_allocation_map_read_allocation_group(
+		     inode_allocation_map,
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode allocation map of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a specific inode is allocated
+ * Returns 1 if the inode is allocated, 0 if not or -1 on error
+ */
+int libfsxfs_inode_allocation_map_is_inode_allocated(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_allocation_map_chunk_t *chunk = NULL;
+	static char *function                        = "libfsxfs_inode_allocation_map_is_inode_allocated";
+	int result                                   = 0;
+
+	result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+	          inode_allocation_map,
+	          inode_number,
+	          &chunk,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode chunk of inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* A set bit in the free inodes bitmap indicates the inode is free
+	 */
+	if( ( chunk->free_inodes_bitmap & ( (uint64_t) 1 << ( inode_number - chunk->first_inode_number ) ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
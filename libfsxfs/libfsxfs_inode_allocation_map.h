@@ -0,0 +1,117 @@
+/*
+ * Inode allocation map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_ALLOCATION_MAP_H )
+#define _LIBFSXFS_INODE_ALLOCATION_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_inode_btree.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_inode_allocation_map_chunk libfsxfs_inode_allocation_map_chunk_t;
+
+struct libfsxfs_inode_allocation_map_chunk
+{
+	/* The (absolute) inode number of the first inode in the chunk
+	 */
+	uint64_t first_inode_number;
+
+	/* The free inodes bitmap, where a set bit indicates the inode is free
+	 */
+	uint64_t free_inodes_bitmap;
+};
+
+typedef struct libfsxfs_inode_allocation_map libfsxfs_inode_allocation_map_t;
+
+struct libfsxfs_inode_allocation_map
+{
+	/* The inode chunks sorted by first inode number
+	 */
+	libfsxfs_inode_allocation_map_chunk_t *chunks;
+
+	/* The number of inode chunks
+	 */
+	size_t number_of_chunks;
+
+	/* The maximum number of inode chunks
+	 */
+	size_t maximum_number_of_chunks;
+
+	/* The number of free inodes
+	 */
+	uint64_t number_of_free_inodes;
+};
+
+int libfsxfs_inode_allocation_map_initialize(
+     libfsxfs_inode_allocation_map_t **inode_allocation_map,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_free(
+     libfsxfs_inode_allocation_map_t **inode_allocation_map,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_append_chunk(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t first_inode_number,
+     uint64_t free_inodes_bitmap,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t inode_number,
+     libfsxfs_inode_allocation_map_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_read_allocation_group(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_read_file_system(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_allocation_map_is_inode_allocated(
+     libfsxfs_inode_allocation_map_t *inode_allocation_map,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_ALLOCATION_MAP_H ) */
+
@@ -30,6 +30,8 @@
 #include "libfsxfs_inode_btree.h"
 #include "libfsxfs_inode_btree_record.h"
 #include "libfsxfs_inode_information.h"
+#include "libfsxfs_io_engine.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
@@ -415,7 +417,7 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 }
 
 /* Retrieves the inode from the inode B+ tree leaf node
- * Returns 1 if successful or -1 on error
+ * Returns 1 if successful, 0 if the inode is not allocated or -1 on error
  */
 int libfsxfs_inode_btree_get_inode_from_leaf_node(
      libfsxfs_inode_btree_t *inode_btree,
@@ -429,6 +431,7 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 	static char *function                             = "libfsxfs_inode_btree_get_inode_from_leaf_node";
 	size_t records_data_offset                        = 0;
 	uint16_t record_index                             = 0;
+	int is_last_record                                = 0;
 	int result                                        = 0;
 
 	if( inode_btree == NULL )
@@ -515,8 +518,13 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 		if( ( inode_number >= inode_btree_record->inode_number )
 		 && ( inode_number < ( inode_btree_record->inode_number + 64 ) ) )
 		{
-/* TODO check bitmap */
-			result = 1;
+			/* A set bit in the chunk allocation bitmap indicates the inode is free
+			 */
+			if( ( inode_btree_record->chunk_allocation_bitmap & ( (uint64_t) 1 << ( inode_number - inode_btree_record->inode_number ) ) ) == 0 )
+			{
+				result = 1;
+			}
+			is_last_record = 1;
 		}
 /* TODO cache records in block */
 		if( libfsxfs_inode_btree_record_free(
@@ -533,7 +541,7 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 			goto on_error;
 		}
-		if( result != 0 )
+		if( is_last_record != 0 )
 		{
 			break;
 		}
@@ -646,6 +654,8 @@ int libfsxfs_inode_btree_get_inode_from_node(
 	     io_handle,
 	     file_io_handle,
 	     btree_block_offset,
+	     LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -924,3 +934,928 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	return( result );
 }
 
+/* Retrieves the records from an inode B+ tree block
+ * The records are appended to the records array in order of their inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_records_from_block(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     libfsxfs_btree_block_t *btree_block,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	static char *function                             = "libfsxfs_inode_btree_get_records_from_block";
+	size_t number_of_key_value_pairs                  = 0;
+	size_t records_data_offset                        = 0;
+	uint32_t relative_sub_block_number                = 0;
+	uint16_t record_index                             = 0;
+	int entry_index                                   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B+ tree block - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     btree_block->header->signature,
+	     signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid block signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( btree_block->header->level == 0 )
+	{
+		if( (size_t) btree_block->header->number_of_records > ( btree_block->records_data_size / 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < btree_block->header->number_of_records;
+		     record_index++ )
+		{
+			if( libfsxfs_inode_btree_record_initialize(
+			     &inode_btree_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create inode B+ tree record: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_btree_record_read_data(
+			     inode_btree_record,
+			     &( btree_block->records_data[ records_data_offset ] ),
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode B+ tree record: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			records_data_offset += 16;
+
+			if( libcdata_array_append_entry(
+			     records_array,
+			     &entry_index,
+			     (intptr_t *) inode_btree_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append inode B+ tree record: %" PRIu16 " to array.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			inode_btree_record = NULL;
+		}
+	}
+	else
+	{
+		number_of_key_value_pairs = btree_block->records_data_size / 8;
+
+		if( (size_t) btree_block->header->number_of_records > number_of_key_value_pairs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The sub nodes are read as a batch if an IO engine is available
+		 */
+		if( io_handle->io_engine != NULL )
+		{
+			if( libfsxfs_inode_btree_get_records_from_sub_nodes(
+			     inode_btree,
+			     io_handle,
+			     file_io_handle,
+			     signature,
+			     allocation_group_block_number,
+			     btree_block,
+			     records_array,
+			     recursion_depth,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve records from sub nodes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			for( record_index = 0;
+			     record_index < btree_block->header->number_of_records;
+			     record_index++ )
+			{
+				records_data_offset = ( number_of_key_value_pairs + record_index ) * 4;
+
+				byte_stream_copy_to_uint32_big_endian(
+				 &( btree_block->records_data[ records_data_offset ] ),
+				 relative_sub_block_number );
+
+				if( libfsxfs_inode_btree_get_records_from_node(
+				     inode_btree,
+				     io_handle,
+				     file_io_handle,
+				     signature,
+				     allocation_group_block_number,
+				     relative_sub_block_number,
+				     records_array,
+				     recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve records from sub node: %" PRIu32 ".",
+					 function,
+					 relative_sub_block_number );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( inode_btree_record != NULL )
+	{
+		libfsxfs_inode_btree_record_free(
+		 &inode_btree_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records from the sub nodes of an inode B+ tree branch block
+ * The sub nodes are read in batches using the IO engine
+ * The records are appended to the records array in order of their inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_records_from_sub_nodes(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     libfsxfs_btree_block_t *btree_block,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *sub_btree_blocks[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+	libfsxfs_io_request_t requests[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+
+	static char *function              = "libfsxfs_inode_btree_get_records_from_sub_nodes";
+	size_t number_of_key_value_pairs   = 0;
+	size_t records_data_offset         = 0;
+	uint64_t decode_start_timestamp    = 0;
+	uint64_t read_start_timestamp      = 0;
+	uint32_t relative_sub_block_number = 0;
+	uint16_t record_index              = 0;
+	int number_of_requests             = 0;
+	int request_index                  = 0;
+	int result                         = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block->header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B+ tree block - missing header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth >= LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_key_value_pairs = btree_block->records_data_size / 8;
+
+	if( (size_t) btree_block->header->number_of_records > number_of_key_value_pairs )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     sub_btree_blocks,
+	     0,
+	     sizeof( libfsxfs_btree_block_t * ) * LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub B+ tree blocks.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( result == 1 )
+	    && ( record_index < btree_block->header->number_of_records ) )
+	{
+		number_of_requests = 0;
+
+		while( ( number_of_requests < LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS )
+		    && ( record_index < btree_block->header->number_of_records ) )
+		{
+			records_data_offset = ( number_of_key_value_pairs + record_index ) * 4;
+
+			byte_stream_copy_to_uint32_big_endian(
+			 &( btree_block->records_data[ records_data_offset ] ),
+			 relative_sub_block_number );
+
+			if( (uint64_t) relative_sub_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid relative sub block number: %" PRIu32 " value out of bounds.",
+				 function,
+				 relative_sub_block_number );
+
+				result = -1;
+
+				break;
+			}
+			if( libfsxfs_btree_block_initialize(
+			     &( sub_btree_blocks[ number_of_requests ] ),
+			     io_handle->block_size,
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub B+ tree block: %" PRIu32 ".",
+				 function,
+				 relative_sub_block_number );
+
+				result = -1;
+
+				break;
+			}
+			requests[ number_of_requests ].offset    = (off64_t) ( allocation_group_block_number + relative_sub_block_number ) * io_handle->block_size;
+			requests[ number_of_requests ].data      = sub_btree_blocks[ number_of_requests ]->data;
+			requests[ number_of_requests ].data_size = sub_btree_blocks[ number_of_requests ]->data_size;
+
+			number_of_requests++;
+			record_index++;
+		}
+		if( result == 1 )
+		{
+			read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+			                       io_handle );
+
+			if( libfsxfs_io_engine_read_requests(
+			     io_handle->io_engine,
+			     file_io_handle,
+			     requests,
+			     number_of_requests,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub B+ tree blocks.",
+				 function );
+
+				result = -1;
+			}
+			decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+			                         io_handle );
+		}
+		for( request_index = 0;
+		     request_index < number_of_requests;
+		     request_index++ )
+		{
+			if( result == 1 )
+			{
+				if( requests[ request_index ].read_count != (ssize_t) requests[ request_index ].data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 requests[ request_index ].offset,
+					 requests[ request_index ].offset );
+
+					result = -1;
+				}
+			}
+			if( result == 1 )
+			{
+				if( libfsxfs_btree_block_read_data(
+				     sub_btree_blocks[ request_index ],
+				     io_handle,
+				     sub_btree_blocks[ request_index ]->data,
+				     sub_btree_blocks[ request_index ]->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub B+ tree block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 requests[ request_index ].offset,
+					 requests[ request_index ].offset );
+
+					result = -1;
+				}
+			}
+			if( result == 1 )
+			{
+				if( libfsxfs_io_handle_add_read(
+				     io_handle,
+				     LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+				     requests[ request_index ].offset,
+				     requests[ request_index ].data_size,
+				     0,
+				     read_start_timestamp,
+				     decode_start_timestamp,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to IO handle.",
+					 function );
+
+					result = -1;
+				}
+			}
+			if( result == 1 )
+			{
+				if( libfsxfs_inode_btree_get_records_from_block(
+				     inode_btree,
+				     io_handle,
+				     file_io_handle,
+				     signature,
+				     allocation_group_block_number,
+				     sub_btree_blocks[ request_index ],
+				     records_array,
+				     recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve records from sub node at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 requests[ request_index ].offset,
+					 requests[ request_index ].offset );
+
+					result = -1;
+				}
+			}
+			libfsxfs_btree_block_free(
+			 &( sub_btree_blocks[ request_index ] ),
+			 NULL );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the records from the inode B+ tree node
+ * The records are appended to the records array in order of their inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_records_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block = NULL;
+	static char *function               = "libfsxfs_inode_btree_get_records_from_node";
+	off64_t btree_block_offset          = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+
+	if( libfsxfs_btree_block_initialize(
+	     &btree_block,
+	     io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     btree_block,
+	     io_handle,
+	     file_io_handle,
+	     btree_block_offset,
+	     LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_btree_get_records_from_block(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     signature,
+	     allocation_group_block_number,
+	     btree_block,
+	     records_array,
+	     recursion_depth,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records from inode B+ tree block: %" PRIu64 ".",
+		 function,
+		 relative_block_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_free(
+	     &btree_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records of the inode B+ tree of a specific allocation group
+ * The records are appended to the records array in order of their inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_records(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libcdata_array_t *records_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_inode_btree_get_records";
+	uint64_t allocation_group_block_number          = 0;
+	const uint8_t *signature                        = NULL;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	if( inode_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode information.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->format_version == 5 )
+	{
+		signature = (uint8_t *) "IAB3";
+	}
+	else
+	{
+		signature = (uint8_t *) "IABT";
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	if( libfsxfs_inode_btree_get_records_from_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     signature,
+	     allocation_group_block_number,
+	     inode_information->inode_btree_root_block_number,
+	     records_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records from root node: %" PRIu32 ".",
+		 function,
+		 inode_information->inode_btree_root_block_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the records of the free inode B+ tree of a specific allocation group
+ * The free inode B+ tree only contains the records of inode chunks with free inodes
+ * The records are appended to the records array in order of their inode number
+ * Returns 1 if successful, 0 if the allocation group has no free inode B+ tree or -1 on error
+ */
+int libfsxfs_inode_btree_get_free_records(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libcdata_array_t *records_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_inode_btree_get_free_records";
+	uint64_t allocation_group_block_number          = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     allocation_group_index,
+	     (intptr_t **) &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %d.",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	if( inode_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode information.",
+		 function );
+
+		return( -1 );
+	}
+	/* The free inode B+ tree is only available in format version 5
+	 */
+	if( ( io_handle->format_version < 5 )
+	 || ( inode_information->free_inode_btree_root_block_number == 0 ) )
+	{
+		return( 0 );
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * io_handle->allocation_group_size;
+
+	if( libfsxfs_inode_btree_get_records_from_node(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     (uint8_t *) "FIB3",
+	     allocation_group_block_number,
+	     inode_information->free_inode_btree_root_block_number,
+	     records_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records from root node: %" PRIu32 ".",
+		 function,
+		 inode_information->free_inode_btree_root_block_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
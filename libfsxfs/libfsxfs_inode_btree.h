@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_btree_block.h"
 #include "libfsxfs_inode_btree_record.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
@@ -98,6 +99,55 @@ int libfsxfs_inode_btree_get_inode_by_number(
      off64_t *file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_get_records_from_block(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     libfsxfs_btree_block_t *btree_block,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_records_from_sub_nodes(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     libfsxfs_btree_block_t *btree_block,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_records_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *signature,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     libcdata_array_t *records_array,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_records(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libcdata_array_t *records_array,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_free_records(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int allocation_group_index,
+     libcdata_array_t *records_array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libfsxfs_debug.h"
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
@@ -150,6 +151,7 @@ int libfsxfs_inode_information_read_data(
 	static char *function              = "libfsxfs_inode_information_read_data";
 	size_t inode_information_data_size = 0;
 	uint32_t format_version            = 0;
+	int bucket_index                   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit               = 0;
@@ -252,6 +254,15 @@ int libfsxfs_inode_information_read_data(
 	 ( (fsxfs_inode_information_t *) data )->last_allocated_chunk,
 	 inode_information->last_allocated_chunk );
 
+	for( bucket_index = 0;
+	     bucket_index < LIBFSXFS_NUMBER_OF_UNLINKED_BUCKETS;
+	     bucket_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( ( (fsxfs_inode_information_t *) data )->unlinked_hash_table[ bucket_index * 4 ] ),
+		 inode_information->unlinked_buckets[ bucket_index ] );
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -347,6 +358,14 @@ int libfsxfs_inode_information_read_data(
 	}
 	if( io_handle->format_version >= 5 )
 	{
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_information_v5_t *) data )->free_inode_btree_root_block_number,
+		 inode_information->free_inode_btree_root_block_number );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_information_v5_t *) data )->free_inode_btree_depth,
+		 inode_information->free_inode_btree_depth );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -392,21 +411,15 @@ int libfsxfs_inode_information_read_data(
 			 function,
 			 value_64bit );
 
-			byte_stream_copy_to_uint32_big_endian(
-			 ( (fsxfs_inode_information_v5_t *) data )->free_inode_btree_root_block_number,
-			 value_32bit );
 			libcnotify_printf(
 			 "%s: free inode B+ tree root block number\t: %" PRIu32 "\n",
 			 function,
-			 value_32bit );
+			 inode_information->free_inode_btree_root_block_number );
 
-			byte_stream_copy_to_uint32_big_endian(
-			 ( (fsxfs_inode_information_v5_t *) data )->free_inode_btree_depth,
-			 value_32bit );
 			libcnotify_printf(
 			 "%s: free inode B+ tree depth\t\t\t: %" PRIu32 "\n",
 			 function,
-			 value_32bit );
+			 inode_information->free_inode_btree_depth );
 
 			libcnotify_printf(
 			 "\n" );
@@ -428,8 +441,10 @@ int libfsxfs_inode_information_read_file_io_handle(
 {
 	uint8_t data[ 512 ];
 
-	static char *function = "libfsxfs_inode_information_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function           = "libfsxfs_inode_information_read_file_io_handle";
+	ssize_t read_count              = 0;
+	uint64_t decode_start_timestamp = 0;
+	uint64_t read_start_timestamp   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -441,6 +456,9 @@ int libfsxfs_inode_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       io_handle );
+
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              data,
@@ -461,6 +479,9 @@ int libfsxfs_inode_information_read_file_io_handle(
 
 		return( -1 );
 	}
+	decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                         io_handle );
+
 	if( libfsxfs_inode_information_read_data(
 	     inode_information,
 	     io_handle,
@@ -479,6 +500,25 @@ int libfsxfs_inode_information_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsxfs_io_handle_add_read(
+	     io_handle,
+	     LIBFSXFS_READ_CATEGORY_SUPERBLOCK,
+	     file_offset,
+	     512,
+	     0,
+	     read_start_timestamp,
+	     decode_start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -48,6 +49,18 @@ struct libfsxfs_inode_information
 	/* Last allocated chunk
 	 */
 	uint32_t last_allocated_chunk;
+
+	/* Free inode B+ tree root block number
+	 */
+	uint32_t free_inode_btree_root_block_number;
+
+	/* Free inode B+ tree depth
+	 */
+	uint32_t free_inode_btree_depth;
+
+	/* The unlinked inode hash buckets
+	 */
+	uint32_t unlinked_buckets[ LIBFSXFS_NUMBER_OF_UNLINKED_BUCKETS ];
 };
 
 int libfsxfs_inode_information_initialize(
@@ -0,0 +1,1091 @@
+/*
+ * IO engine functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_io_engine.h"
+#include "libfsxfs_io_uring.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates an IO engine
+ * The workers of the IO engine read using their own clone of the file IO handle,
+ * if the file IO handle cannot be cloned the IO engine reads synchronously
+ * The threads of the workers are created once and reused for every batch of requests
+ * Make sure the value io_engine is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_initialize(
+     libfsxfs_io_engine_t **io_engine,
+     libbfio_handle_t *file_io_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_engine_initialize";
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libbfio_handle_t *worker_file_io_handle = NULL;
+	int result                              = 0;
+	int worker_index                        = 0;
+#endif
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_engine != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO engine value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 0 )
+	 || ( number_of_workers > LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_engine = memory_allocate_structure(
+	              libfsxfs_io_engine_t );
+
+	if( *io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO engine.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_engine,
+	     0,
+	     sizeof( libfsxfs_io_engine_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO engine.",
+		 function );
+
+		memory_free(
+		 *io_engine );
+
+		*io_engine = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* A file IO handle that cannot be cloned or opened limits the number of workers
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &worker_file_io_handle,
+		     file_io_handle,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+		result = libbfio_handle_is_open(
+		          worker_file_io_handle,
+		          NULL );
+
+		if( result == 0 )
+		{
+			result = libbfio_handle_open(
+			          worker_file_io_handle,
+			          LIBBFIO_OPEN_READ,
+			          NULL );
+		}
+		if( result != 1 )
+		{
+			libbfio_handle_free(
+			 &worker_file_io_handle,
+			 NULL );
+
+			break;
+		}
+		( *io_engine )->file_io_handles[ worker_index ] = worker_file_io_handle;
+
+		worker_file_io_handle = NULL;
+	}
+	( *io_engine )->number_of_workers = worker_index;
+
+	/* Less than 2 workers are read synchronously and do not need threads
+	 */
+	if( ( *io_engine )->number_of_workers >= 2 )
+	{
+		for( worker_index = 0;
+		     worker_index < ( *io_engine )->number_of_workers;
+		     worker_index++ )
+		{
+			( *io_engine )->workers[ worker_index ].file_io_handle = ( *io_engine )->file_io_handles[ worker_index ];
+		}
+		if( libcthreads_mutex_initialize(
+		     &( ( *io_engine )->batch_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize batch mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( ( *io_engine )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *io_engine )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize condition.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( ( *io_engine )->thread_pool ),
+		     NULL,
+		     ( *io_engine )->number_of_workers,
+		     ( *io_engine )->number_of_workers,
+		     (int (*)(intptr_t *, void *)) &libfsxfs_io_engine_worker_callback,
+		     (void *) *io_engine,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_engine != NULL )
+	{
+		libfsxfs_io_engine_free(
+		 io_engine,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an IO engine
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_free(
+     libfsxfs_io_engine_t **io_engine,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_engine_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_engine != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_IO_URING )
+		/* The direct IO handle is not managed by the IO engine
+		 */
+		if( ( *io_engine )->io_uring != NULL )
+		{
+			if( libfsxfs_io_uring_free(
+			     &( ( *io_engine )->io_uring ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free io_uring.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		/* The thread pool is joined before the file IO handles of the workers are closed
+		 */
+		if( ( *io_engine )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *io_engine )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_engine )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *io_engine )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_engine )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *io_engine )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_engine )->batch_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *io_engine )->batch_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free batch mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		for( worker_index = 0;
+		     worker_index < ( *io_engine )->number_of_workers;
+		     worker_index++ )
+		{
+			if( libbfio_handle_close(
+			     ( *io_engine )->file_io_handles[ worker_index ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( ( *io_engine )->file_io_handles[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *io_engine );
+
+		*io_engine = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_LIBFSXFS_IO_URING )
+
+/* Sets the direct IO handle
+ * The requests are then read from the direct IO handle using an io_uring instead of the workers
+ * Returns 1 if successful, 0 if io_uring is not supported by the kernel or -1 on error
+ */
+int libfsxfs_io_engine_set_direct_io_handle(
+     libfsxfs_io_engine_t *io_engine,
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_engine_set_direct_io_handle";
+	int result            = 0;
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_engine->io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO engine - io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_io_uring_initialize(
+	          &( io_engine->io_uring ),
+	          LIBFSXFS_IO_URING_NUMBER_OF_ENTRIES,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		io_engine->direct_io_handle = direct_io_handle;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_IO_URING ) */
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+/* Reads the requests of a worker
+ * Callback function for the threads of the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_worker_callback(
+     libfsxfs_io_engine_worker_t *worker,
+     libfsxfs_io_engine_t *io_engine )
+{
+	libfsxfs_io_request_t *request = NULL;
+	static char *function          = "libfsxfs_io_engine_worker_callback";
+	int request_index              = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = 1;
+
+	for( request_index = worker->first_request_index;
+	     request_index < worker->number_of_requests;
+	     request_index += worker->request_stride )
+	{
+		request = &( worker->requests[ request_index ] );
+
+		request->read_count = libbfio_handle_read_buffer_at_offset(
+		                       worker->file_io_handle,
+		                       request->data,
+		                       request->data_size,
+		                       request->offset,
+		                       &( worker->error ) );
+
+		if( request->read_count < 0 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 request_index,
+			 request->offset,
+			 request->offset );
+
+			worker->result = -1;
+
+			break;
+		}
+	}
+	/* Signal the batch when the last worker has finished
+	 */
+	if( io_engine != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     io_engine->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		io_engine->number_of_active_workers -= 1;
+
+		if( io_engine->number_of_active_workers == 0 )
+		{
+			libcthreads_condition_broadcast(
+			 io_engine->condition,
+			 NULL );
+		}
+		if( libcthreads_mutex_release(
+		     io_engine->mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( worker->result );
+}
+
+/* Waits until the workers of the current batch have finished
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_wait_for_workers(
+     libfsxfs_io_engine_t *io_engine,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_engine_wait_for_workers";
+	int result            = 1;
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     io_engine->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( io_engine->number_of_active_workers > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     io_engine->condition,
+		     io_engine->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     io_engine->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a batch of requests using the threads of the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_read_requests_concurrently(
+     libfsxfs_io_engine_t *io_engine,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libfsxfs_io_engine_worker_t *worker = NULL;
+	static char *function               = "libfsxfs_io_engine_read_requests_concurrently";
+	int number_of_pushed_workers        = 0;
+	int result                          = 1;
+	int worker_index                    = 0;
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 2 )
+	 || ( number_of_workers > io_engine->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The workers are shared by all batches, hence only one batch is read at a time
+	 */
+	if( libcthreads_mutex_grab(
+	     io_engine->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab batch mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The requests are interleaved over the workers so that adjacent requests
+	 * are outstanding at the same time
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( io_engine->workers[ worker_index ] );
+
+		worker->requests            = requests;
+		worker->number_of_requests  = number_of_requests;
+		worker->first_request_index = worker_index;
+		worker->request_stride      = number_of_workers;
+		worker->result              = -1;
+		worker->error               = NULL;
+	}
+	io_engine->number_of_active_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     io_engine->thread_pool,
+		     (intptr_t *) &( io_engine->workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push worker: %d onto thread pool.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+		number_of_pushed_workers++;
+	}
+	if( number_of_pushed_workers < number_of_workers )
+	{
+		/* Discount the workers that were not pushed
+		 */
+		if( libcthreads_mutex_grab(
+		     io_engine->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		io_engine->number_of_active_workers -= number_of_workers - number_of_pushed_workers;
+
+		if( libcthreads_mutex_release(
+		     io_engine->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_io_engine_wait_for_workers(
+	     io_engine,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_pushed_workers;
+	     worker_index++ )
+	{
+		worker = &( io_engine->workers[ worker_index ] );
+
+		if( ( result == 1 )
+		 && ( worker->result != 1 ) )
+		{
+			/* Pass on the error of the worker
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = worker->error;
+
+				worker->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read requests of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+		if( worker->error != NULL )
+		{
+			libcerror_error_free(
+			 &( worker->error ) );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     io_engine->batch_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release batch mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 io_engine->batch_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+/* Reads a batch of requests
+ * If the IO engine has an io_uring the requests are submitted to the kernel as a single batch,
+ * otherwise they are distributed over the workers and read concurrently,
+ * if the IO engine has less than 2 workers they are read synchronously from the file IO handle
+ * The number of bytes read is stored in every request, where a short read indicates
+ * the request exceeds the end of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_engine_read_requests(
+     libfsxfs_io_engine_t *io_engine,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_engine_read_requests";
+	int request_index     = 0;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	int number_of_workers = 0;
+#endif
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		requests[ request_index ].read_count = -1;
+	}
+#if defined( HAVE_LIBFSXFS_IO_URING )
+	if( io_engine->io_uring != NULL )
+	{
+		if( libfsxfs_io_uring_read_requests(
+		     io_engine->io_uring,
+		     io_engine->direct_io_handle,
+		     requests,
+		     number_of_requests,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read requests using io_uring.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	number_of_workers = io_engine->number_of_workers;
+
+	if( number_of_workers > number_of_requests )
+	{
+		number_of_workers = number_of_requests;
+	}
+	if( ( number_of_workers >= 2 )
+	 && ( io_engine->thread_pool != NULL ) )
+	{
+		if( libfsxfs_io_engine_read_requests_concurrently(
+		     io_engine,
+		     requests,
+		     number_of_requests,
+		     number_of_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read requests concurrently.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		requests[ request_index ].read_count = libbfio_handle_read_buffer_at_offset(
+		                                        file_io_handle,
+		                                        requests[ request_index ].data,
+		                                        requests[ request_index ].data_size,
+		                                        requests[ request_index ].offset,
+		                                        error );
+
+		if( requests[ request_index ].read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 request_index,
+			 requests[ request_index ].offset,
+			 requests[ request_index ].offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset
+ * The buffer is split into requests that do not cross a multiple of the request size,
+ * such as the stripe unit size, which are read as batches
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_io_engine_read_buffer_at_offset(
+         libfsxfs_io_engine_t *io_engine,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         size_t request_size,
+         libcerror_error_t **error )
+{
+	libfsxfs_io_request_t requests[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+
+	static char *function  = "libfsxfs_io_engine_read_buffer_at_offset";
+	size_t buffer_offset   = 0;
+	size_t data_size       = 0;
+	size_t read_count      = 0;
+	int number_of_requests = 0;
+	int request_index      = 0;
+
+	if( io_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_size == 0 )
+	{
+		request_size = LIBFSXFS_IO_ENGINE_DEFAULT_REQUEST_SIZE;
+	}
+	while( buffer_offset < size )
+	{
+		number_of_requests = 0;
+
+		while( ( buffer_offset < size )
+		    && ( number_of_requests < LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ) )
+		{
+			data_size = request_size - (size_t) ( ( offset + buffer_offset ) % request_size );
+
+			if( data_size > ( size - buffer_offset ) )
+			{
+				data_size = size - buffer_offset;
+			}
+			requests[ number_of_requests ].offset    = offset + buffer_offset;
+			requests[ number_of_requests ].data      = &( buffer[ buffer_offset ] );
+			requests[ number_of_requests ].data_size = data_size;
+
+			buffer_offset += data_size;
+
+			number_of_requests++;
+		}
+		if( libfsxfs_io_engine_read_requests(
+		     io_engine,
+		     file_io_handle,
+		     requests,
+		     number_of_requests,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read requests.",
+			 function );
+
+			return( -1 );
+		}
+		/* The data read ends at the first short read
+		 */
+		for( request_index = 0;
+		     request_index < number_of_requests;
+		     request_index++ )
+		{
+			read_count += (size_t) requests[ request_index ].read_count;
+
+			if( (size_t) requests[ request_index ].read_count != requests[ request_index ].data_size )
+			{
+				return( (ssize_t) read_count );
+			}
+		}
+	}
+	return( (ssize_t) read_count );
+}
+
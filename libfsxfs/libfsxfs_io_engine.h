@@ -0,0 +1,181 @@
+/*
+ * IO engine functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_IO_ENGINE_H )
+#define _LIBFSXFS_IO_ENGINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_io_request.h"
+#include "libfsxfs_io_uring.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_io_engine_worker libfsxfs_io_engine_worker_t;
+
+struct libfsxfs_io_engine_worker
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The requests
+	 */
+	libfsxfs_io_request_t *requests;
+
+	/* The number of requests
+	 */
+	int number_of_requests;
+
+	/* The index of the first request of the worker
+	 */
+	int first_request_index;
+
+	/* The number of requests between the requests of the worker
+	 */
+	int request_stride;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct libfsxfs_io_engine libfsxfs_io_engine_t;
+
+struct libfsxfs_io_engine
+{
+	/* The file IO handles of the workers
+	 */
+	libbfio_handle_t *file_io_handles[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+#if defined( HAVE_LIBFSXFS_IO_URING )
+	/* The direct IO handle that is read using the io_uring
+	 */
+	libfsxfs_direct_io_handle_t *direct_io_handle;
+
+	/* The io_uring
+	 */
+	libfsxfs_io_uring_t *io_uring;
+#endif
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The workers
+	 */
+	libfsxfs_io_engine_worker_t workers[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+	/* The thread pool that runs the workers
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that serializes the batches of requests
+	 */
+	libcthreads_mutex_t *batch_mutex;
+
+	/* The mutex that protects the number of active workers
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals the workers of a batch have finished
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The number of workers that have not yet finished the current batch
+	 */
+	int number_of_active_workers;
+#endif
+};
+
+int libfsxfs_io_engine_initialize(
+     libfsxfs_io_engine_t **io_engine,
+     libbfio_handle_t *file_io_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsxfs_io_engine_free(
+     libfsxfs_io_engine_t **io_engine,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSXFS_IO_URING )
+
+int libfsxfs_io_engine_set_direct_io_handle(
+     libfsxfs_io_engine_t *io_engine,
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_IO_URING ) */
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+int libfsxfs_io_engine_worker_callback(
+     libfsxfs_io_engine_worker_t *worker,
+     libfsxfs_io_engine_t *io_engine );
+
+int libfsxfs_io_engine_wait_for_workers(
+     libfsxfs_io_engine_t *io_engine,
+     libcerror_error_t **error );
+
+int libfsxfs_io_engine_read_requests_concurrently(
+     libfsxfs_io_engine_t *io_engine,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsxfs_io_engine_read_requests(
+     libfsxfs_io_engine_t *io_engine,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_io_engine_read_buffer_at_offset(
+         libfsxfs_io_engine_t *io_engine,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         size_t request_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_IO_ENGINE_H ) */
+
@@ -30,6 +30,7 @@
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_statistics.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -91,6 +92,19 @@ int libfsxfs_io_handle_initialize(
 
 		goto on_error;
 	}
+	if( libfsxfs_statistics_initialize(
+	     &( ( *io_handle )->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -127,6 +141,22 @@ int libfsxfs_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->statistics != NULL )
+		{
+			if( libfsxfs_statistics_free(
+			     &( ( *io_handle )->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free statistics.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
@@ -136,13 +166,32 @@ int libfsxfs_io_handle_free(
 }
 
 /* Clears the IO handle
+ * The statistics, read trace and progress callbacks are retained so they survive close
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_io_handle_clear(
      libfsxfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_io_handle_clear";
+	libfsxfs_statistics_t *statistics = NULL;
+	static char *function             = "libfsxfs_io_handle_clear";
+	intptr_t *callback_data           = NULL;
+	intptr_t *progress_callback_data  = NULL;
+	uint8_t collect_statistics        = 0;
+
+	void (*callback)(
+	       intptr_t *callback_data,
+	       off64_t offset,
+	       size64_t size,
+	       int read_category,
+	       uint64_t inode_number,
+	       uint64_t latency ) = NULL;
+
+	void (*progress_callback)(
+	       intptr_t *callback_data,
+	       int progress_type,
+	       uint64_t inode_number,
+	       uint64_t number_processed ) = NULL;
 
 	if( io_handle == NULL )
 	{
@@ -155,6 +204,14 @@ int libfsxfs_io_handle_clear(
 
 		return( -1 );
 	}
+	statistics         = io_handle->statistics;
+	collect_statistics = io_handle->collect_statistics;
+	callback           = io_handle->read_trace_callback;
+	callback_data      = io_handle->read_trace_callback_data;
+
+	progress_callback      = io_handle->progress_callback;
+	progress_callback_data = io_handle->progress_callback_data;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -169,6 +226,184 @@ int libfsxfs_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->statistics               = statistics;
+	io_handle->collect_statistics       = collect_statistics;
+	io_handle->read_trace_callback      = callback;
+	io_handle->read_trace_callback_data = callback_data;
+	io_handle->progress_callback        = progress_callback;
+	io_handle->progress_callback_data   = progress_callback_data;
+
+	return( 1 );
+}
+
+/* Retrieves a timestamp for the read statistics and the read trace callback
+ * Returns the timestamp in nano seconds or 0 if neither statistics are collected nor a read trace callback is set
+ */
+uint64_t libfsxfs_io_handle_get_timestamp(
+          libfsxfs_io_handle_t *io_handle )
+{
+	if( io_handle == NULL )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->collect_statistics == 0 )
+	 && ( io_handle->read_trace_callback == NULL ) )
+	{
+		return( 0 );
+	}
+	return( libfsxfs_statistics_get_timestamp() );
+}
+
+/* Adds a read to the statistics if collected and passes it to the read trace callback if set
+ * The latency passed to the read trace callback is the time between the read and decode start timestamps in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_handle_add_read(
+     libfsxfs_io_handle_t *io_handle,
+     int read_category,
+     off64_t offset,
+     size_t read_size,
+     uint64_t inode_number,
+     uint64_t read_start_timestamp,
+     uint64_t decode_start_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_handle_add_read";
+	uint64_t latency      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->collect_statistics != 0 )
+	{
+		if( libfsxfs_statistics_add_read(
+		     io_handle->statistics,
+		     read_category,
+		     read_size,
+		     read_start_timestamp,
+		     decode_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( io_handle->read_trace_callback != NULL )
+	{
+		if( decode_start_timestamp > read_start_timestamp )
+		{
+			latency = decode_start_timestamp - read_start_timestamp;
+		}
+		io_handle->read_trace_callback(
+		 io_handle->read_trace_callback_data,
+		 offset,
+		 (size64_t) read_size,
+		 read_category,
+		 inode_number,
+		 latency );
+	}
+	return( 1 );
+}
+
+/* Adds a cache lookup to the statistics if collected
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_handle_add_cache_lookup(
+     libfsxfs_io_handle_t *io_handle,
+     uint8_t is_cache_hit,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_handle_add_cache_lookup";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->collect_statistics != 0 )
+	{
+		if( libfsxfs_statistics_add_cache_lookup(
+		     io_handle->statistics,
+		     is_cache_hit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add cache lookup statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Checks if abort was signalled and passes the progress to the progress callback if set
+ * The number processed is the number of directory entries, extents or bytes processed
+ * so far by the current operation
+ * Returns 1 if successful or -1 on error or if abort was signalled
+ */
+int libfsxfs_io_handle_update_progress(
+     libfsxfs_io_handle_t *io_handle,
+     int progress_type,
+     uint64_t inode_number,
+     uint64_t number_processed,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_handle_update_progress";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->progress_callback != NULL )
+	{
+		io_handle->progress_callback(
+		 io_handle->progress_callback_data,
+		 progress_type,
+		 inode_number,
+		 number_processed );
+	}
 	return( 1 );
 }
 
@@ -25,8 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_io_engine.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_read_queue.h"
+#include "libfsxfs_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -68,6 +71,56 @@ struct libfsxfs_io_handle
 	 */
 	uint8_t number_of_relative_inode_number_bits;
 
+	/* The stripe unit size in bytes, where 0 represents not set
+	 */
+	uint32_t stripe_unit_size;
+
+	/* The stripe width in bytes, where 0 represents not set
+	 */
+	uint32_t stripe_width;
+
+	/* The IO engine, where NULL represents reads are issued synchronously
+	 */
+	libfsxfs_io_engine_t *io_engine;
+
+	/* The queue of the asynchronous reads
+	 */
+	libfsxfs_read_queue_t *read_queue;
+
+	/* The statistics
+	 */
+	libfsxfs_statistics_t *statistics;
+
+	/* Value to indicate if statistics should be collected
+	 */
+	uint8_t collect_statistics;
+
+	/* The read trace callback function
+	 */
+	void (*read_trace_callback)(
+	       intptr_t *callback_data,
+	       off64_t offset,
+	       size64_t size,
+	       int read_category,
+	       uint64_t inode_number,
+	       uint64_t latency );
+
+	/* The read trace callback data
+	 */
+	intptr_t *read_trace_callback_data;
+
+	/* The progress callback function
+	 */
+	void (*progress_callback)(
+	       intptr_t *callback_data,
+	       int progress_type,
+	       uint64_t inode_number,
+	       uint64_t number_processed );
+
+	/* The progress callback data
+	 */
+	intptr_t *progress_callback_data;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -85,6 +138,31 @@ int libfsxfs_io_handle_clear(
      libfsxfs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+uint64_t libfsxfs_io_handle_get_timestamp(
+          libfsxfs_io_handle_t *io_handle );
+
+int libfsxfs_io_handle_add_read(
+     libfsxfs_io_handle_t *io_handle,
+     int read_category,
+     off64_t offset,
+     size_t read_size,
+     uint64_t inode_number,
+     uint64_t read_start_timestamp,
+     uint64_t decode_start_timestamp,
+     libcerror_error_t **error );
+
+int libfsxfs_io_handle_add_cache_lookup(
+     libfsxfs_io_handle_t *io_handle,
+     uint8_t is_cache_hit,
+     libcerror_error_t **error );
+
+int libfsxfs_io_handle_update_progress(
+     libfsxfs_io_handle_t *io_handle,
+     int progress_type,
+     uint64_t inode_number,
+     uint64_t number_processed,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,880 @@
+/*
+ * Linux io_uring functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* O_DIRECT is only defined by glibc for _GNU_SOURCE
+ */
+#if !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_SYSCALL_H )
+#include <sys/syscall.h>
+#endif
+
+#if defined( HAVE_SYS_UIO_H )
+#include <sys/uio.h>
+#endif
+
+#if defined( HAVE_LINUX_IO_URING_H )
+#include <linux/io_uring.h>
+#endif
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_io_request.h"
+#include "libfsxfs_io_uring.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( HAVE_LIBFSXFS_IO_URING )
+
+/* Creates an io_uring
+ * Make sure the value io_uring is referencing, is set to NULL
+ * Returns 1 if successful, 0 if io_uring is not supported by the kernel or -1 on error
+ */
+int libfsxfs_io_uring_initialize(
+     libfsxfs_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	struct io_uring_params parameters;
+
+	void *mapped_memory   = NULL;
+	static char *function = "libfsxfs_io_uring_initialize";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid io_uring value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( number_of_entries > LIBFSXFS_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_uring = memory_allocate_structure(
+	             libfsxfs_io_uring_t );
+
+	if( *io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create io_uring.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_uring,
+	     0,
+	     sizeof( libfsxfs_io_uring_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear io_uring.",
+		 function );
+
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+
+		return( -1 );
+	}
+	( *io_uring )->ring_file_descriptor = -1;
+
+	if( memory_set(
+	     &parameters,
+	     0,
+	     sizeof( struct io_uring_params ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parameters.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_uring )->ring_file_descriptor = (int) syscall(
+	                                             __NR_io_uring_setup,
+	                                             number_of_entries,
+	                                             &parameters );
+
+	if( ( *io_uring )->ring_file_descriptor == -1 )
+	{
+		/* The kernel does not provide io_uring or it is not permitted, for example by a seccomp filter
+		 */
+		if( ( errno == ENOSYS )
+		 || ( errno == EPERM )
+		 || ( errno == EACCES )
+		 || ( errno == EINVAL ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_system_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 errno,
+			 "%s: unable to set up ring.",
+			 function );
+		}
+		goto on_error;
+	}
+	( *io_uring )->number_of_submission_entries = parameters.sq_entries;
+
+	( *io_uring )->submission_ring_size = (size_t) parameters.sq_off.array
+	                                    + ( (size_t) parameters.sq_entries * sizeof( uint32_t ) );
+
+	mapped_memory = mmap(
+	                 NULL,
+	                 ( *io_uring )->submission_ring_size,
+	                 PROT_READ | PROT_WRITE,
+	                 MAP_SHARED | MAP_POPULATE,
+	                 ( *io_uring )->ring_file_descriptor,
+	                 IORING_OFF_SQ_RING );
+
+	if( mapped_memory == MAP_FAILED )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_uring )->submission_ring = (uint8_t *) mapped_memory;
+
+	( *io_uring )->submission_entries_size = (size_t) parameters.sq_entries * sizeof( struct io_uring_sqe );
+
+	mapped_memory = mmap(
+	                 NULL,
+	                 ( *io_uring )->submission_entries_size,
+	                 PROT_READ | PROT_WRITE,
+	                 MAP_SHARED | MAP_POPULATE,
+	                 ( *io_uring )->ring_file_descriptor,
+	                 IORING_OFF_SQES );
+
+	if( mapped_memory == MAP_FAILED )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map submission queue entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_uring )->submission_entries = (uint8_t *) mapped_memory;
+
+	( *io_uring )->completion_ring_size = (size_t) parameters.cq_off.cqes
+	                                    + ( (size_t) parameters.cq_entries * sizeof( struct io_uring_cqe ) );
+
+	mapped_memory = mmap(
+	                 NULL,
+	                 ( *io_uring )->completion_ring_size,
+	                 PROT_READ | PROT_WRITE,
+	                 MAP_SHARED | MAP_POPULATE,
+	                 ( *io_uring )->ring_file_descriptor,
+	                 IORING_OFF_CQ_RING );
+
+	if( mapped_memory == MAP_FAILED )
+	{
+		libcerror_system_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 errno,
+		 "%s: unable to map completion queue ring.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_uring )->completion_ring = (uint8_t *) mapped_memory;
+
+	( *io_uring )->submission_tail      = (uint32_t *) &( ( *io_uring )->submission_ring[ parameters.sq_off.tail ] );
+	( *io_uring )->submission_ring_mask = (uint32_t *) &( ( *io_uring )->submission_ring[ parameters.sq_off.ring_mask ] );
+	( *io_uring )->submission_array     = (uint32_t *) &( ( *io_uring )->submission_ring[ parameters.sq_off.array ] );
+	( *io_uring )->completion_head      = (uint32_t *) &( ( *io_uring )->completion_ring[ parameters.cq_off.head ] );
+	( *io_uring )->completion_tail      = (uint32_t *) &( ( *io_uring )->completion_ring[ parameters.cq_off.tail ] );
+	( *io_uring )->completion_ring_mask = (uint32_t *) &( ( *io_uring )->completion_ring[ parameters.cq_off.ring_mask ] );
+	( *io_uring )->completion_entries   = &( ( *io_uring )->completion_ring[ parameters.cq_off.cqes ] );
+
+	( *io_uring )->io_vectors = (uint8_t *) memory_allocate(
+	                                         sizeof( struct iovec ) * parameters.sq_entries );
+
+	if( ( *io_uring )->io_vectors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO vectors.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_uring )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_uring != NULL )
+	{
+		libfsxfs_io_uring_free(
+		 io_uring,
+		 NULL );
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( -1 );
+}
+
+/* Frees an io_uring
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_uring_free(
+     libfsxfs_io_uring_t **io_uring,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_uring_free";
+	int result            = 1;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_uring != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *io_uring )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *io_uring )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		/* The bounce buffer is allocated by posix_memalign and hence freed by free
+		 */
+		if( ( *io_uring )->bounce_buffer != NULL )
+		{
+			free(
+			 ( *io_uring )->bounce_buffer );
+		}
+		if( ( *io_uring )->io_vectors != NULL )
+		{
+			memory_free(
+			 ( *io_uring )->io_vectors );
+		}
+		if( ( *io_uring )->completion_ring != NULL )
+		{
+			munmap(
+			 ( *io_uring )->completion_ring,
+			 ( *io_uring )->completion_ring_size );
+		}
+		if( ( *io_uring )->submission_entries != NULL )
+		{
+			munmap(
+			 ( *io_uring )->submission_entries,
+			 ( *io_uring )->submission_entries_size );
+		}
+		if( ( *io_uring )->submission_ring != NULL )
+		{
+			munmap(
+			 ( *io_uring )->submission_ring,
+			 ( *io_uring )->submission_ring_size );
+		}
+		if( ( *io_uring )->ring_file_descriptor != -1 )
+		{
+			if( close(
+			     ( *io_uring )->ring_file_descriptor ) != 0 )
+			{
+				libcerror_system_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 errno,
+				 "%s: unable to close ring.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *io_uring );
+
+		*io_uring = NULL;
+	}
+	return( result );
+}
+
+/* Reads a batch of requests using the io_uring
+ * The requests are read from the file descriptor of the direct IO handle, where every read
+ * is aligned to the alignment of the direct IO handle. A request that is not aligned is read
+ * into the bounce buffer and copied afterwards.
+ * The requests are submitted in rounds of at most the number of submission queue entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_io_uring_read_requests(
+     libfsxfs_io_uring_t *io_uring,
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error )
+{
+	struct io_uring_cqe *completion_entry = NULL;
+	struct io_uring_sqe *submission_entry = NULL;
+	struct iovec *io_vector               = NULL;
+	libfsxfs_io_request_t *request        = NULL;
+	uint8_t *read_buffer                  = NULL;
+	static char *function                 = "libfsxfs_io_uring_read_requests";
+	size_t aligned_size                   = 0;
+	size_t bounce_buffer_offset           = 0;
+	size_t data_offset                    = 0;
+	ssize_t read_count                    = 0;
+	off64_t aligned_offset                = 0;
+	uint32_t alignment                    = 0;
+	uint32_t completion_head              = 0;
+	uint32_t completion_tail              = 0;
+	uint32_t entry_index                  = 0;
+	uint32_t number_of_completed_entries  = 0;
+	uint32_t number_of_submitted_entries  = 0;
+	uint32_t number_of_entries            = 0;
+	uint32_t submission_tail              = 0;
+	int first_request_index               = 0;
+	int last_request_index                = 0;
+	int request_index                     = 0;
+	int result                            = 1;
+	int system_call_result                = 0;
+
+	if( io_uring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid io_uring.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid direct IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( direct_io_handle->alignment == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid direct IO handle - alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	alignment = direct_io_handle->alignment;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( result == 1 )
+	    && ( first_request_index < number_of_requests ) )
+	{
+		/* Determine the requests of this round and the size of the bounce buffer they require
+		 */
+		bounce_buffer_offset = 0;
+		number_of_entries    = 0;
+
+		for( last_request_index = first_request_index;
+		     last_request_index < number_of_requests;
+		     last_request_index++ )
+		{
+			if( number_of_entries >= io_uring->number_of_submission_entries )
+			{
+				break;
+			}
+			request = &( requests[ last_request_index ] );
+
+			if( ( request->data == NULL )
+			 || ( request->data_size > (size_t) SSIZE_MAX )
+			 || ( request->offset < 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid request: %d.",
+				 function,
+				 last_request_index );
+
+				result = -1;
+
+				break;
+			}
+			if( request->data_size == 0 )
+			{
+				continue;
+			}
+			data_offset  = (size_t) ( request->offset % alignment );
+			aligned_size = ( ( data_offset + request->data_size + alignment - 1 ) / alignment ) * alignment;
+
+			if( ( data_offset != 0 )
+			 || ( aligned_size != request->data_size )
+			 || ( ( (intptr_t) request->data % alignment ) != 0 ) )
+			{
+				bounce_buffer_offset += aligned_size;
+			}
+			number_of_entries++;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		if( bounce_buffer_offset > io_uring->bounce_buffer_size )
+		{
+			if( io_uring->bounce_buffer != NULL )
+			{
+				free(
+				 io_uring->bounce_buffer );
+
+				io_uring->bounce_buffer      = NULL;
+				io_uring->bounce_buffer_size = 0;
+			}
+			if( posix_memalign(
+			     (void **) &( io_uring->bounce_buffer ),
+			     LIBFSXFS_DIRECT_IO_MAXIMUM_SECTOR_SIZE,
+			     bounce_buffer_offset ) != 0 )
+			{
+				io_uring->bounce_buffer = NULL;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create bounce buffer.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			io_uring->bounce_buffer_size = bounce_buffer_offset;
+		}
+		/* Fill the submission queue entries, the user data of an entry is the request index
+		 */
+		bounce_buffer_offset = 0;
+		entry_index          = 0;
+		submission_tail      = *( io_uring->submission_tail );
+
+		for( request_index = first_request_index;
+		     request_index < last_request_index;
+		     request_index++ )
+		{
+			request = &( requests[ request_index ] );
+
+			if( request->data_size == 0 )
+			{
+				request->read_count = 0;
+
+				continue;
+			}
+			data_offset    = (size_t) ( request->offset % alignment );
+			aligned_offset = request->offset - (off64_t) data_offset;
+			aligned_size   = ( ( data_offset + request->data_size + alignment - 1 ) / alignment ) * alignment;
+
+			io_vector = &( ( (struct iovec *) io_uring->io_vectors )[ entry_index ] );
+
+			if( ( data_offset != 0 )
+			 || ( aligned_size != request->data_size )
+			 || ( ( (intptr_t) request->data % alignment ) != 0 ) )
+			{
+				io_vector->iov_base = &( io_uring->bounce_buffer[ bounce_buffer_offset ] );
+
+				bounce_buffer_offset += aligned_size;
+			}
+			else
+			{
+				io_vector->iov_base = request->data;
+			}
+			io_vector->iov_len = aligned_size;
+
+			submission_entry = &( ( (struct io_uring_sqe *) io_uring->submission_entries )[ submission_tail & *( io_uring->submission_ring_mask ) ] );
+
+			if( memory_set(
+			     submission_entry,
+			     0,
+			     sizeof( struct io_uring_sqe ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear submission queue entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			submission_entry->opcode    = IORING_OP_READV;
+			submission_entry->fd        = direct_io_handle->file_descriptor;
+			submission_entry->off       = (uint64_t) aligned_offset;
+			submission_entry->addr      = (uint64_t) (intptr_t) io_vector;
+			submission_entry->len       = 1;
+			submission_entry->user_data = (uint64_t) request_index;
+
+			io_uring->submission_array[ submission_tail & *( io_uring->submission_ring_mask ) ] = submission_tail & *( io_uring->submission_ring_mask );
+
+			submission_tail++;
+			entry_index++;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		/* The kernel reads the submission queue tail, hence it is stored after the entries
+		 */
+		__atomic_store_n(
+		 io_uring->submission_tail,
+		 submission_tail,
+		 __ATOMIC_RELEASE );
+
+		number_of_submitted_entries = 0;
+		number_of_completed_entries = 0;
+
+		while( number_of_completed_entries < entry_index )
+		{
+			system_call_result = (int) syscall(
+			                            __NR_io_uring_enter,
+			                            io_uring->ring_file_descriptor,
+			                            entry_index - number_of_submitted_entries,
+			                            1,
+			                            IORING_ENTER_GETEVENTS,
+			                            NULL,
+			                            0 );
+
+			if( system_call_result < 0 )
+			{
+				if( ( errno == EINTR )
+				 || ( errno == EAGAIN )
+				 || ( errno == EBUSY ) )
+				{
+					continue;
+				}
+				libcerror_system_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to submit requests.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			number_of_submitted_entries += (uint32_t) system_call_result;
+
+			completion_head = *( io_uring->completion_head );
+			completion_tail = __atomic_load_n(
+			                   io_uring->completion_tail,
+			                   __ATOMIC_ACQUIRE );
+
+			while( completion_head != completion_tail )
+			{
+				completion_entry = &( ( (struct io_uring_cqe *) io_uring->completion_entries )[ completion_head & *( io_uring->completion_ring_mask ) ] );
+
+				request_index = (int) completion_entry->user_data;
+				read_count    = (ssize_t) completion_entry->res;
+
+				completion_head++;
+				number_of_completed_entries++;
+
+				if( ( request_index < first_request_index )
+				 || ( request_index >= last_request_index ) )
+				{
+					continue;
+				}
+				requests[ request_index ].read_count = read_count;
+			}
+			__atomic_store_n(
+			 io_uring->completion_head,
+			 completion_head,
+			 __ATOMIC_RELEASE );
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		/* Copy the data read into the bounce buffer, a failed or short read is read again
+		 * synchronously, which also determines if the short read is the end of the data
+		 */
+		bounce_buffer_offset = 0;
+
+		for( request_index = first_request_index;
+		     request_index < last_request_index;
+		     request_index++ )
+		{
+			request = &( requests[ request_index ] );
+
+			if( request->data_size == 0 )
+			{
+				continue;
+			}
+			data_offset    = (size_t) ( request->offset % alignment );
+			aligned_offset = request->offset - (off64_t) data_offset;
+			aligned_size   = ( ( data_offset + request->data_size + alignment - 1 ) / alignment ) * alignment;
+
+			if( ( data_offset != 0 )
+			 || ( aligned_size != request->data_size )
+			 || ( ( (intptr_t) request->data % alignment ) != 0 ) )
+			{
+				read_buffer = &( io_uring->bounce_buffer[ bounce_buffer_offset ] );
+
+				bounce_buffer_offset += aligned_size;
+			}
+			else
+			{
+				read_buffer = request->data;
+			}
+			read_count = request->read_count;
+
+			if( ( read_count < 0 )
+			 || ( (size_t) read_count < aligned_size ) )
+			{
+				read_count = libfsxfs_direct_io_handle_read_aligned(
+				              direct_io_handle,
+				              read_buffer,
+				              aligned_size,
+				              aligned_offset,
+				              error );
+
+				if( read_count < 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read request: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 request_index,
+					 request->offset,
+					 request->offset );
+
+					request->read_count = -1;
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( (size_t) read_count <= data_offset )
+			{
+				read_count = 0;
+			}
+			else
+			{
+				read_count -= (ssize_t) data_offset;
+
+				if( (size_t) read_count > request->data_size )
+				{
+					read_count = (ssize_t) request->data_size;
+				}
+			}
+			if( ( read_buffer != request->data )
+			 && ( read_count > 0 ) )
+			{
+				if( memory_copy(
+				     request->data,
+				     &( read_buffer[ data_offset ] ),
+				     (size_t) read_count ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data of request: %d.",
+					 function,
+					 request_index );
+
+					request->read_count = -1;
+
+					result = -1;
+
+					break;
+				}
+			}
+			request->read_count = read_count;
+		}
+		first_request_index = last_request_index;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_uring->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_IO_URING ) */
+
@@ -0,0 +1,151 @@
+/*
+ * Linux io_uring functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_IO_URING_H )
+#define _LIBFSXFS_IO_URING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_io_request.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* The io_uring system calls are used directly, hence without a dependency on liburing
+ */
+#if defined( HAVE_LIBFSXFS_DIRECT_IO ) && defined( HAVE_LINUX_IO_URING_H ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_SYS_UIO_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYSCALL ) && defined( HAVE_DECL___NR_IO_URING_SETUP ) && ( HAVE_DECL___NR_IO_URING_SETUP == 1 ) && defined( HAVE_DECL___NR_IO_URING_ENTER ) && ( HAVE_DECL___NR_IO_URING_ENTER == 1 ) && defined( __GNUC__ )
+#define HAVE_LIBFSXFS_IO_URING		1
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSXFS_IO_URING )
+
+typedef struct libfsxfs_io_uring libfsxfs_io_uring_t;
+
+struct libfsxfs_io_uring
+{
+	/* The file descriptor of the ring
+	 */
+	int ring_file_descriptor;
+
+	/* The number of submission queue entries
+	 */
+	uint32_t number_of_submission_entries;
+
+	/* The mapped submission queue ring
+	 */
+	uint8_t *submission_ring;
+
+	/* The size of the mapped submission queue ring
+	 */
+	size_t submission_ring_size;
+
+	/* The mapped submission queue entries
+	 */
+	uint8_t *submission_entries;
+
+	/* The size of the mapped submission queue entries
+	 */
+	size_t submission_entries_size;
+
+	/* The mapped completion queue ring
+	 */
+	uint8_t *completion_ring;
+
+	/* The size of the mapped completion queue ring
+	 */
+	size_t completion_ring_size;
+
+	/* The submission queue tail
+	 */
+	uint32_t *submission_tail;
+
+	/* The submission queue ring mask
+	 */
+	uint32_t *submission_ring_mask;
+
+	/* The submission queue index array
+	 */
+	uint32_t *submission_array;
+
+	/* The completion queue head
+	 */
+	uint32_t *completion_head;
+
+	/* The completion queue tail
+	 */
+	uint32_t *completion_tail;
+
+	/* The completion queue ring mask
+	 */
+	uint32_t *completion_ring_mask;
+
+	/* The completion queue entries
+	 */
+	uint8_t *completion_entries;
+
+	/* The IO vectors of the submitted reads
+	 */
+	uint8_t *io_vectors;
+
+	/* The aligned buffer for reads that are not aligned
+	 */
+	uint8_t *bounce_buffer;
+
+	/* The size of the aligned buffer
+	 */
+	size_t bounce_buffer_size;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the use of the ring
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsxfs_io_uring_initialize(
+     libfsxfs_io_uring_t **io_uring,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_io_uring_free(
+     libfsxfs_io_uring_t **io_uring,
+     libcerror_error_t **error );
+
+int libfsxfs_io_uring_read_requests(
+     libfsxfs_io_uring_t *io_uring,
+     libfsxfs_direct_io_handle_t *direct_io_handle,
+     libfsxfs_io_request_t *requests,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_IO_URING ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_IO_URING_H ) */
+
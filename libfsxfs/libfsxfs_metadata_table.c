@@ -0,0 +1,1014 @@
+/*
+ * Metadata table functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_metadata_table.h"
+
+#include "fsxfs_metadata_table.h"
+
+/* The columns in the order they are exported
+ */
+static const uint16_t libfsxfs_metadata_table_column_types[ LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS ] = {
+	LIBFSXFS_METADATA_COLUMN_INODE_NUMBER,
+	LIBFSXFS_METADATA_COLUMN_PARENT_INODE_NUMBER,
+	LIBFSXFS_METADATA_COLUMN_SIZE,
+	LIBFSXFS_METADATA_COLUMN_ACCESS_TIME,
+	LIBFSXFS_METADATA_COLUMN_MODIFICATION_TIME,
+	LIBFSXFS_METADATA_COLUMN_INODE_CHANGE_TIME,
+	LIBFSXFS_METADATA_COLUMN_CREATION_TIME,
+	LIBFSXFS_METADATA_COLUMN_NAME_OFFSET,
+	LIBFSXFS_METADATA_COLUMN_OWNER_IDENTIFIER,
+	LIBFSXFS_METADATA_COLUMN_GROUP_IDENTIFIER,
+	LIBFSXFS_METADATA_COLUMN_NUMBER_OF_LINKS,
+	LIBFSXFS_METADATA_COLUMN_NUMBER_OF_EXTENTS,
+	LIBFSXFS_METADATA_COLUMN_NAME_SIZE,
+	LIBFSXFS_METADATA_COLUMN_FILE_MODE };
+
+/* The value sizes of the columns
+ */
+static const uint16_t libfsxfs_metadata_table_column_value_sizes[ LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS ] = {
+	8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 2 };
+
+/* Creates a metadata table
+ * Make sure the value metadata_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_metadata_table_initialize(
+     libfsxfs_metadata_table_t **metadata_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_metadata_table_initialize";
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_table = memory_allocate_structure(
+	                   libfsxfs_metadata_table_t );
+
+	if( *metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_table,
+	     0,
+	     sizeof( libfsxfs_metadata_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata table.",
+		 function );
+
+		memory_free(
+		 *metadata_table );
+
+		*metadata_table = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *metadata_table != NULL )
+	{
+		memory_free(
+		 *metadata_table );
+
+		*metadata_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_metadata_table_free(
+     libfsxfs_metadata_table_t **metadata_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_metadata_table_free";
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_table != NULL )
+	{
+		if( ( *metadata_table )->string_heap != NULL )
+		{
+			memory_free(
+			 ( *metadata_table )->string_heap );
+		}
+		if( ( *metadata_table )->rows != NULL )
+		{
+			memory_free(
+			 ( *metadata_table )->rows );
+		}
+		memory_free(
+		 *metadata_table );
+
+		*metadata_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the metadata table so that it can contain at least one more row
+ * and a string of a specific size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_metadata_table_resize(
+     libfsxfs_metadata_table_t *metadata_table,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_metadata_table_row_t *rows = NULL;
+	uint8_t *string_heap                = NULL;
+	static char *function               = "libfsxfs_metadata_table_resize";
+	size_t allocated_string_heap_size   = 0;
+	int number_of_allocated_rows        = 0;
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_table->number_of_rows >= metadata_table->number_of_allocated_rows )
+	{
+		if( metadata_table->number_of_allocated_rows == 0 )
+		{
+			number_of_allocated_rows = LIBFSXFS_METADATA_TABLE_INITIAL_NUMBER_OF_ROWS;
+		}
+		else
+		{
+			number_of_allocated_rows = metadata_table->number_of_allocated_rows * 2;
+		}
+		if( ( number_of_allocated_rows <= metadata_table->number_of_allocated_rows )
+		 || ( (size_t) number_of_allocated_rows > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_metadata_table_row_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated rows value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		rows = (libfsxfs_metadata_table_row_t *) memory_reallocate(
+		                                          metadata_table->rows,
+		                                          sizeof( libfsxfs_metadata_table_row_t ) * number_of_allocated_rows );
+
+		if( rows == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize rows.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_table->rows                     = rows;
+		metadata_table->number_of_allocated_rows = number_of_allocated_rows;
+	}
+	if( string_size > ( metadata_table->allocated_string_heap_size - metadata_table->string_heap_size ) )
+	{
+		if( metadata_table->allocated_string_heap_size == 0 )
+		{
+			allocated_string_heap_size = LIBFSXFS_METADATA_TABLE_INITIAL_STRING_HEAP_SIZE;
+		}
+		else
+		{
+			allocated_string_heap_size = metadata_table->allocated_string_heap_size;
+		}
+		while( string_size > ( allocated_string_heap_size - metadata_table->string_heap_size ) )
+		{
+			if( allocated_string_heap_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid allocated string heap size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_string_heap_size *= 2;
+		}
+		string_heap = (uint8_t *) memory_reallocate(
+		                           metadata_table->string_heap,
+		                           sizeof( uint8_t ) * allocated_string_heap_size );
+
+		if( string_heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize string heap.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_table->string_heap                = string_heap;
+		metadata_table->allocated_string_heap_size = allocated_string_heap_size;
+	}
+	return( 1 );
+}
+
+/* Appends a row for an inode
+ * The directory entry provides the name and can be NULL for the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_metadata_table_append_row(
+     libfsxfs_metadata_table_t *metadata_table,
+     uint64_t inode_number,
+     uint64_t parent_inode_number,
+     int parent_row_index,
+     libfsxfs_inode_t *inode,
+     libfsxfs_directory_entry_t *directory_entry,
+     int *row_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_metadata_table_row_t *row = NULL;
+	static char *function              = "libfsxfs_metadata_table_append_row";
+	size_t name_size                   = 1;
+	int number_of_extents              = 0;
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_row_index < -1 )
+	 || ( parent_row_index >= metadata_table->number_of_rows ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid row index.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_get_utf8_name_size(
+		     directory_entry,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name size.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > (size_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 name size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_metadata_table_resize(
+	     metadata_table,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	row = &( metadata_table->rows[ metadata_table->number_of_rows ] );
+
+	if( memory_set(
+	     row,
+	     0,
+	     sizeof( libfsxfs_metadata_table_row_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear row.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry != NULL )
+	{
+		if( libfsxfs_directory_entry_get_utf8_name(
+		     directory_entry,
+		     &( metadata_table->string_heap[ metadata_table->string_heap_size ] ),
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		metadata_table->string_heap[ metadata_table->string_heap_size ] = 0;
+	}
+	row->inode_number        = inode_number;
+	row->parent_inode_number = parent_inode_number;
+	row->parent_row_index    = parent_row_index;
+	row->name_offset         = (uint64_t) metadata_table->string_heap_size;
+	row->name_size           = (uint32_t) ( name_size - 1 );
+
+	if( libfsxfs_inode_get_data_size(
+	     inode,
+	     &( row->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_access_time(
+	     inode,
+	     &( row->access_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_modification_time(
+	     inode,
+	     &( row->modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_inode_change_time(
+	     inode,
+	     &( row->inode_change_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_creation_time(
+	     inode,
+	     &( row->creation_time ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_owner_identifier(
+	     inode,
+	     &( row->owner_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve owner identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_group_identifier(
+	     inode,
+	     &( row->group_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_links(
+	     inode,
+	     &( row->number_of_links ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of links.",
+		 function );
+
+		return( -1 );
+	}
+	/* Inodes with inline data have no extents
+	 */
+	if( inode->data_extents_array != NULL )
+	{
+		if( libfsxfs_inode_get_number_of_extents(
+		     inode,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	row->number_of_extents = (uint32_t) number_of_extents;
+
+	if( libfsxfs_inode_get_file_mode(
+	     inode,
+	     &( row->file_mode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_table->string_heap_size += name_size;
+
+	*row_index = metadata_table->number_of_rows;
+
+	metadata_table->number_of_rows += 1;
+
+	return( 1 );
+}
+
+/* Determines if the inode number is that of the row or one of its ancestors
+ * This is used to prevent directory loops in corrupted file systems
+ * A row index of -1 represents no row
+ * Returns 1 if the inode number is an ancestor, 0 if not or -1 on error
+ */
+int libfsxfs_metadata_table_has_ancestor(
+     libfsxfs_metadata_table_t *metadata_table,
+     int row_index,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_metadata_table_has_ancestor";
+	int depth             = 0;
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( row_index < -1 )
+	 || ( row_index >= metadata_table->number_of_rows ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( row_index != -1 )
+	{
+		if( depth > metadata_table->number_of_rows )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid parent row index - loop detected.",
+			 function );
+
+			return( -1 );
+		}
+		if( metadata_table->rows[ row_index ].inode_number == inode_number )
+		{
+			return( 1 );
+		}
+		row_index = metadata_table->rows[ row_index ].parent_row_index;
+
+		depth++;
+	}
+	return( 0 );
+}
+
+/* Copies a column value of a row to a little-endian byte stream
+ */
+void libfsxfs_metadata_table_copy_column_value(
+      libfsxfs_metadata_table_row_t *row,
+      uint16_t column_type,
+      uint8_t *byte_stream )
+{
+	switch( column_type )
+	{
+		case LIBFSXFS_METADATA_COLUMN_INODE_NUMBER:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 row->inode_number );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_PARENT_INODE_NUMBER:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 row->parent_inode_number );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_SIZE:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 row->size );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_ACCESS_TIME:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 (uint64_t) row->access_time );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_MODIFICATION_TIME:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 (uint64_t) row->modification_time );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_INODE_CHANGE_TIME:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 (uint64_t) row->inode_change_time );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_CREATION_TIME:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 (uint64_t) row->creation_time );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_NAME_OFFSET:
+			byte_stream_copy_from_uint64_little_endian(
+			 byte_stream,
+			 row->name_offset );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_OWNER_IDENTIFIER:
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 row->owner_identifier );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_GROUP_IDENTIFIER:
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 row->group_identifier );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_NUMBER_OF_LINKS:
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 row->number_of_links );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_NUMBER_OF_EXTENTS:
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 row->number_of_extents );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_NAME_SIZE:
+			byte_stream_copy_from_uint32_little_endian(
+			 byte_stream,
+			 row->name_size );
+			break;
+
+		case LIBFSXFS_METADATA_COLUMN_FILE_MODE:
+			byte_stream_copy_from_uint16_little_endian(
+			 byte_stream,
+			 row->file_mode );
+			break;
+
+		default:
+			break;
+	}
+}
+
+/* Writes the metadata table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_metadata_table_write_file_io_handle(
+     libfsxfs_metadata_table_t *metadata_table,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( fsxfs_metadata_table_header_t ) + ( LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS * sizeof( fsxfs_metadata_table_column_descriptor_t ) ) ];
+
+	fsxfs_metadata_table_column_descriptor_t *column_descriptor = NULL;
+	uint8_t *column_data                                        = NULL;
+	static char *function                                       = "libfsxfs_metadata_table_write_file_io_handle";
+	size_t column_data_offset                                   = 0;
+	size_t column_size                                          = 0;
+	size_t padding_size                                         = 0;
+	ssize_t write_count                                         = 0;
+	uint64_t data_offset                                        = 0;
+	uint16_t value_size                                         = 0;
+	int column_index                                            = 0;
+	int row_index                                               = 0;
+
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     header_data,
+	     0,
+	     sizeof( header_data ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header data.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = (uint64_t) sizeof( header_data );
+
+	for( column_index = 0;
+	     column_index < LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS;
+	     column_index++ )
+	{
+		value_size = libfsxfs_metadata_table_column_value_sizes[ column_index ];
+
+		column_descriptor = (fsxfs_metadata_table_column_descriptor_t *) &( header_data[ sizeof( fsxfs_metadata_table_header_t ) + ( column_index * sizeof( fsxfs_metadata_table_column_descriptor_t ) ) ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 column_descriptor->column_type,
+		 libfsxfs_metadata_table_column_types[ column_index ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 column_descriptor->value_size,
+		 value_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 column_descriptor->data_offset,
+		 data_offset );
+
+		column_size  = (size_t) metadata_table->number_of_rows * value_size;
+		data_offset += ( column_size + 7 ) & ~( (size_t) 7 );
+	}
+	if( memory_copy(
+	     ( (fsxfs_metadata_table_header_t *) header_data )->signature,
+	     "FSXFSMDT",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsxfs_metadata_table_header_t *) header_data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsxfs_metadata_table_header_t *) header_data )->number_of_columns,
+	 LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsxfs_metadata_table_header_t *) header_data )->number_of_rows,
+	 (uint64_t) metadata_table->number_of_rows );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsxfs_metadata_table_header_t *) header_data )->string_heap_offset,
+	 data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsxfs_metadata_table_header_t *) header_data )->string_heap_size,
+	 (uint64_t) metadata_table->string_heap_size );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               header_data,
+	               sizeof( header_data ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( header_data ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	column_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * LIBFSXFS_METADATA_TABLE_COLUMN_DATA_SIZE );
+
+	if( column_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column data.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < LIBFSXFS_METADATA_TABLE_NUMBER_OF_COLUMNS;
+	     column_index++ )
+	{
+		value_size         = libfsxfs_metadata_table_column_value_sizes[ column_index ];
+		column_data_offset = 0;
+
+		for( row_index = 0;
+		     row_index < metadata_table->number_of_rows;
+		     row_index++ )
+		{
+			libfsxfs_metadata_table_copy_column_value(
+			 &( metadata_table->rows[ row_index ] ),
+			 libfsxfs_metadata_table_column_types[ column_index ],
+			 &( column_data[ column_data_offset ] ) );
+
+			column_data_offset += value_size;
+
+			/* Keep room for the next value or the column padding
+			 */
+			if( ( column_data_offset + 8 ) > LIBFSXFS_METADATA_TABLE_COLUMN_DATA_SIZE )
+			{
+				write_count = libbfio_handle_write_buffer(
+				               file_io_handle,
+				               column_data,
+				               column_data_offset,
+				               error );
+
+				if( write_count != (ssize_t) column_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write column: %d data.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				column_data_offset = 0;
+			}
+		}
+		column_size  = (size_t) metadata_table->number_of_rows * value_size;
+		padding_size = ( ( column_size + 7 ) & ~( (size_t) 7 ) ) - column_size;
+
+		if( padding_size > 0 )
+		{
+			if( memory_set(
+			     &( column_data[ column_data_offset ] ),
+			     0,
+			     padding_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear column: %d padding.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+			column_data_offset += padding_size;
+		}
+		if( column_data_offset > 0 )
+		{
+			write_count = libbfio_handle_write_buffer(
+			               file_io_handle,
+			               column_data,
+			               column_data_offset,
+			               error );
+
+			if( write_count != (ssize_t) column_data_offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write column: %d data.",
+				 function,
+				 column_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 column_data );
+
+	column_data = NULL;
+
+	if( metadata_table->string_heap_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               metadata_table->string_heap,
+		               metadata_table->string_heap_size,
+		               error );
+
+		if( write_count != (ssize_t) metadata_table->string_heap_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string heap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( column_data != NULL )
+	{
+		memory_free(
+		 column_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,176 @@
+/*
+ * Metadata table functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_METADATA_TABLE_H )
+#define _LIBFSXFS_METADATA_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_metadata_table_row libfsxfs_metadata_table_row_t;
+
+struct libfsxfs_metadata_table_row
+{
+	/* Inode number
+	 */
+	uint64_t inode_number;
+
+	/* Parent inode number
+	 */
+	uint64_t parent_inode_number;
+
+	/* Size
+	 */
+	uint64_t size;
+
+	/* Access time
+	 */
+	int64_t access_time;
+
+	/* Modification time
+	 */
+	int64_t modification_time;
+
+	/* Inode change time
+	 */
+	int64_t inode_change_time;
+
+	/* Creation time
+	 */
+	int64_t creation_time;
+
+	/* Name offset in the string heap
+	 */
+	uint64_t name_offset;
+
+	/* Owner identifier
+	 */
+	uint32_t owner_identifier;
+
+	/* Group identifier
+	 */
+	uint32_t group_identifier;
+
+	/* Number of links
+	 */
+	uint32_t number_of_links;
+
+	/* Number of extents
+	 */
+	uint32_t number_of_extents;
+
+	/* Name size without the end-of-string character
+	 */
+	uint32_t name_size;
+
+	/* File mode
+	 */
+	uint16_t file_mode;
+
+	/* Index of the row of the parent directory or -1 if none
+	 * Not exported
+	 */
+	int parent_row_index;
+};
+
+typedef struct libfsxfs_metadata_table libfsxfs_metadata_table_t;
+
+struct libfsxfs_metadata_table
+{
+	/* The rows
+	 */
+	libfsxfs_metadata_table_row_t *rows;
+
+	/* The number of rows
+	 */
+	int number_of_rows;
+
+	/* The number of allocated rows
+	 */
+	int number_of_allocated_rows;
+
+	/* The string heap
+	 */
+	uint8_t *string_heap;
+
+	/* The string heap size
+	 */
+	size_t string_heap_size;
+
+	/* The allocated string heap size
+	 */
+	size_t allocated_string_heap_size;
+};
+
+int libfsxfs_metadata_table_initialize(
+     libfsxfs_metadata_table_t **metadata_table,
+     libcerror_error_t **error );
+
+int libfsxfs_metadata_table_free(
+     libfsxfs_metadata_table_t **metadata_table,
+     libcerror_error_t **error );
+
+int libfsxfs_metadata_table_resize(
+     libfsxfs_metadata_table_t *metadata_table,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libfsxfs_metadata_table_append_row(
+     libfsxfs_metadata_table_t *metadata_table,
+     uint64_t inode_number,
+     uint64_t parent_inode_number,
+     int parent_row_index,
+     libfsxfs_inode_t *inode,
+     libfsxfs_directory_entry_t *directory_entry,
+     int *row_index,
+     libcerror_error_t **error );
+
+int libfsxfs_metadata_table_has_ancestor(
+     libfsxfs_metadata_table_t *metadata_table,
+     int row_index,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+void libfsxfs_metadata_table_copy_column_value(
+      libfsxfs_metadata_table_row_t *row,
+      uint16_t column_type,
+      uint8_t *byte_stream );
+
+int libfsxfs_metadata_table_write_file_io_handle(
+     libfsxfs_metadata_table_t *metadata_table,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_METADATA_TABLE_H ) */
+
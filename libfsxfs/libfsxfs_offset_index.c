@@ -0,0 +1,336 @@
+/*
+ * Offset index functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_offset_index.h"
+
+/* Creates an offset index
+ * Make sure the value offset_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_offset_index_initialize(
+     libfsxfs_offset_index_t **offset_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_offset_index_initialize";
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offset index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*offset_index = memory_allocate_structure(
+	                 libfsxfs_offset_index_t );
+
+	if( *offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offset index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *offset_index,
+	     0,
+	     sizeof( libfsxfs_offset_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear offset index.",
+		 function );
+
+		memory_free(
+		 *offset_index );
+
+		*offset_index = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *offset_index != NULL )
+	{
+		memory_free(
+		 *offset_index );
+
+		*offset_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an offset index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_offset_index_free(
+     libfsxfs_offset_index_t **offset_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_offset_index_free";
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_index != NULL )
+	{
+		if( ( *offset_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *offset_index )->entries );
+		}
+		memory_free(
+		 *offset_index );
+
+		*offset_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the offset index
+ * The logical offset of the entry is the end of the previous entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_offset_index_append_entry(
+     libfsxfs_offset_index_t *offset_index,
+     off64_t physical_offset,
+     size64_t size,
+     uint32_t range_flags,
+     libcerror_error_t **error )
+{
+	libfsxfs_offset_index_entry_t *entries = NULL;
+	static char *function                  = "libfsxfs_offset_index_append_entry";
+	int number_of_allocated_entries        = 0;
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid physical offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - offset_index->size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_index->number_of_entries >= offset_index->number_of_allocated_entries )
+	{
+		if( offset_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBFSXFS_OFFSET_INDEX_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			number_of_allocated_entries = offset_index->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries <= offset_index->number_of_allocated_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_offset_index_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsxfs_offset_index_entry_t *) memory_reallocate(
+		                                             offset_index->entries,
+		                                             sizeof( libfsxfs_offset_index_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		offset_index->entries                     = entries;
+		offset_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	offset_index->entries[ offset_index->number_of_entries ].logical_offset  = (off64_t) offset_index->size;
+	offset_index->entries[ offset_index->number_of_entries ].physical_offset = physical_offset;
+	offset_index->entries[ offset_index->number_of_entries ].size            = size;
+	offset_index->entries[ offset_index->number_of_entries ].range_flags     = range_flags;
+
+	offset_index->number_of_entries += 1;
+	offset_index->size              += size;
+
+	return( 1 );
+}
+
+/* Retrieves the entry that contains a specific logical offset
+ * The entry of the last lookup and the entry that follows it are checked first
+ * so that sequential access does not require a search, otherwise the entries,
+ * which are sorted by logical offset, are searched using a binary search
+ * Returns 1 if successful, 0 if no entry contains the offset or -1 on error
+ */
+int libfsxfs_offset_index_get_entry_at_offset(
+     libfsxfs_offset_index_t *offset_index,
+     off64_t offset,
+     libfsxfs_offset_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_offset_index_entry_t *safe_entry = NULL;
+	static char *function                     = "libfsxfs_offset_index_get_entry_at_offset";
+	int entry_index                           = 0;
+	int lower_index                           = 0;
+	int upper_index                           = 0;
+
+	if( offset_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= offset_index->size ) )
+	{
+		return( 0 );
+	}
+	for( entry_index = offset_index->last_entry_index;
+	     entry_index < ( offset_index->last_entry_index + 2 );
+	     entry_index++ )
+	{
+		if( entry_index >= offset_index->number_of_entries )
+		{
+			break;
+		}
+		safe_entry = &( offset_index->entries[ entry_index ] );
+
+		if( ( offset >= safe_entry->logical_offset )
+		 && ( (size64_t) ( offset - safe_entry->logical_offset ) < safe_entry->size ) )
+		{
+			offset_index->last_entry_index = entry_index;
+
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+	}
+	upper_index = offset_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+		safe_entry  = &( offset_index->entries[ entry_index ] );
+
+		if( offset < safe_entry->logical_offset )
+		{
+			upper_index = entry_index;
+		}
+		else if( (size64_t) ( offset - safe_entry->logical_offset ) >= safe_entry->size )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			offset_index->last_entry_index = entry_index;
+
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Offset index functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_OFFSET_INDEX_H )
+#define _LIBFSXFS_OFFSET_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_offset_index_entry libfsxfs_offset_index_entry_t;
+
+struct libfsxfs_offset_index_entry
+{
+	/* The logical offset
+	 */
+	off64_t logical_offset;
+
+	/* The physical offset
+	 */
+	off64_t physical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The range flags
+	 */
+	uint32_t range_flags;
+};
+
+typedef struct libfsxfs_offset_index libfsxfs_offset_index_t;
+
+struct libfsxfs_offset_index
+{
+	/* The entries
+	 */
+	libfsxfs_offset_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The size of the mapped data
+	 */
+	size64_t size;
+
+	/* The index of the entry of the last lookup
+	 */
+	int last_entry_index;
+};
+
+int libfsxfs_offset_index_initialize(
+     libfsxfs_offset_index_t **offset_index,
+     libcerror_error_t **error );
+
+int libfsxfs_offset_index_free(
+     libfsxfs_offset_index_t **offset_index,
+     libcerror_error_t **error );
+
+int libfsxfs_offset_index_append_entry(
+     libfsxfs_offset_index_t *offset_index,
+     off64_t physical_offset,
+     size64_t size,
+     uint32_t range_flags,
+     libcerror_error_t **error );
+
+int libfsxfs_offset_index_get_entry_at_offset(
+     libfsxfs_offset_index_t *offset_index,
+     off64_t offset,
+     libfsxfs_offset_index_entry_t **entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_OFFSET_INDEX_H ) */
+
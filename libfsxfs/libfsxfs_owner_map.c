@@ -0,0 +1,736 @@
+/*
+ * Block owner map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_owner_map.h"
+#include "libfsxfs_sidecar_index.h"
+
+#include "fsxfs_sidecar_index.h"
+
+/* Creates an owner map
+ * Make sure the value owner_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_initialize(
+     libfsxfs_owner_map_t **owner_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_owner_map_initialize";
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *owner_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid owner map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*owner_map = memory_allocate_structure(
+	              libfsxfs_owner_map_t );
+
+	if( *owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create owner map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *owner_map,
+	     0,
+	     sizeof( libfsxfs_owner_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear owner map.",
+		 function );
+
+		memory_free(
+		 *owner_map );
+
+		*owner_map = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *owner_map != NULL )
+	{
+		memory_free(
+		 *owner_map );
+
+		*owner_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an owner map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_free(
+     libfsxfs_owner_map_t **owner_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_owner_map_free";
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *owner_map != NULL )
+	{
+		if( ( *owner_map )->entries != NULL )
+		{
+			memory_free(
+			 ( *owner_map )->entries );
+		}
+		memory_free(
+		 *owner_map );
+
+		*owner_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the owner map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_append_entry(
+     libfsxfs_owner_map_t *owner_map,
+     off64_t offset,
+     size64_t size,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_owner_map_entry_t *entries = NULL;
+	static char *function               = "libfsxfs_owner_map_append_entry";
+	int number_of_allocated_entries     = 0;
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_map->number_of_entries >= owner_map->number_of_allocated_entries )
+	{
+		if( owner_map->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBFSXFS_OWNER_MAP_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			number_of_allocated_entries = owner_map->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries <= owner_map->number_of_allocated_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_owner_map_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsxfs_owner_map_entry_t *) memory_reallocate(
+		                                          owner_map->entries,
+		                                          sizeof( libfsxfs_owner_map_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		owner_map->entries                     = entries;
+		owner_map->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	owner_map->entries[ owner_map->number_of_entries ].offset       = offset;
+	owner_map->entries[ owner_map->number_of_entries ].size         = size;
+	owner_map->entries[ owner_map->number_of_entries ].inode_number = inode_number;
+
+	owner_map->number_of_entries += 1;
+	owner_map->is_sorted          = 0;
+
+	return( 1 );
+}
+
+/* Compares two owner map entries by their offset
+ * Returns -1 if the first entry is before the second, 0 if equal or 1 if after
+ */
+int libfsxfs_owner_map_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	off64_t first_offset  = ( (libfsxfs_owner_map_entry_t *) first_entry )->offset;
+	off64_t second_offset = ( (libfsxfs_owner_map_entry_t *) second_entry )->offset;
+
+	if( first_offset < second_offset )
+	{
+		return( -1 );
+	}
+	else if( first_offset > second_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the owner map entries by their offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_sort(
+     libfsxfs_owner_map_t *owner_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_owner_map_sort";
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_map->number_of_entries > 1 )
+	{
+		qsort(
+		 owner_map->entries,
+		 (size_t) owner_map->number_of_entries,
+		 sizeof( libfsxfs_owner_map_entry_t ),
+		 &libfsxfs_owner_map_entry_compare );
+	}
+	owner_map->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Reads the data extents of an inode into the owner map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_read_inode(
+     libfsxfs_owner_map_t *owner_map,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent       = NULL;
+	static char *function           = "libfsxfs_owner_map_read_inode";
+	off64_t extent_offset           = 0;
+	uint64_t allocation_group_index = 0;
+	uint64_t relative_block_number  = 0;
+	int extent_index                = 0;
+	int number_of_extents           = 0;
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* Inodes with inline data have no extents
+	 */
+	if( inode->data_extents_array == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_inode_get_number_of_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_inode_get_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		 || ( extent->number_of_blocks == 0 ) )
+		{
+			continue;
+		}
+		allocation_group_index = extent->physical_block_number >> io_handle->number_of_relative_block_number_bits;
+		relative_block_number  = extent->physical_block_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+		extent_offset = (off64_t) ( ( allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+		if( libfsxfs_owner_map_append_entry(
+		     owner_map,
+		     extent_offset,
+		     (size64_t) extent->number_of_blocks * io_handle->block_size,
+		     inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent: %d of inode: %" PRIu64 ".",
+			 function,
+			 extent_index,
+			 inode_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the data extents of all the allocated inodes of the file system into the owner map
+ * The allocated inodes are determined from the inode chunks of the sidecar index if available
+ * otherwise from the inode B+ trees
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_owner_map_read_file_system(
+     libfsxfs_owner_map_t *owner_map,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_inode_chunk_t *inode_chunk = NULL;
+	libfsxfs_inode_t *inode                        = NULL;
+	uint8_t *inode_chunks_data                     = NULL;
+	uint8_t *safe_inode_chunks_data                = NULL;
+	static char *function                          = "libfsxfs_owner_map_read_file_system";
+	size_t inode_chunk_index                       = 0;
+	size_t number_of_inode_chunks                  = 0;
+	uint64_t first_inode_number                    = 0;
+	uint64_t free_inodes_bitmap                    = 0;
+	uint64_t inode_number                          = 0;
+	uint64_t number_of_inodes                      = 0;
+	uint8_t inode_index                            = 0;
+	int result                                     = 0;
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->sidecar_index != NULL )
+	{
+		safe_inode_chunks_data = &( file_system->sidecar_index->data[ file_system->sidecar_index->inode_chunks_offset ] );
+		number_of_inode_chunks = file_system->sidecar_index->number_of_inode_chunks;
+	}
+	else
+	{
+		if( libfsxfs_sidecar_index_read_inode_chunks(
+		     io_handle,
+		     file_io_handle,
+		     file_system->inode_btree,
+		     number_of_allocation_groups,
+		     &inode_chunks_data,
+		     &number_of_inode_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunks.",
+			 function );
+
+			goto on_error;
+		}
+		safe_inode_chunks_data = inode_chunks_data;
+	}
+	for( inode_chunk_index = 0;
+	     inode_chunk_index < number_of_inode_chunks;
+	     inode_chunk_index++ )
+	{
+		inode_chunk = (fsxfs_sidecar_index_inode_chunk_t *) &( safe_inode_chunks_data[ inode_chunk_index * sizeof( fsxfs_sidecar_index_inode_chunk_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 inode_chunk->first_inode_number,
+		 first_inode_number );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 inode_chunk->free_inodes_bitmap,
+		 free_inodes_bitmap );
+
+		/* An inode chunk consists of 64 inodes
+		 */
+		for( inode_index = 0;
+		     inode_index < 64;
+		     inode_index++ )
+		{
+			if( ( free_inodes_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 )
+			{
+				continue;
+			}
+			inode_number = first_inode_number + inode_index;
+
+			if( libfsxfs_io_handle_update_progress(
+			     io_handle,
+			     LIBFSXFS_PROGRESS_TYPE_INODES,
+			     inode_number,
+			     number_of_inodes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfsxfs_file_system_get_inode_by_number(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          inode_number,
+			          &inode,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			if( libfsxfs_owner_map_read_inode(
+			     owner_map,
+			     io_handle,
+			     inode,
+			     inode_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extents of inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_free(
+			     &inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			number_of_inodes++;
+		}
+	}
+	if( inode_chunks_data != NULL )
+	{
+		memory_free(
+		 inode_chunks_data );
+
+		inode_chunks_data = NULL;
+	}
+	if( libfsxfs_owner_map_sort(
+	     owner_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort owner map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_chunks_data != NULL )
+	{
+		memory_free(
+		 inode_chunks_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode number of the owner of a specific volume offset
+ * Returns 1 if successful, 0 if the offset is not owned by an inode or -1 on error
+ */
+int libfsxfs_owner_map_get_inode_number_by_offset(
+     libfsxfs_owner_map_t *owner_map,
+     off64_t offset,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_owner_map_entry_t *entry = NULL;
+	static char *function             = "libfsxfs_owner_map_get_inode_number_by_offset";
+	int entry_index                   = 0;
+	int lower_index                   = 0;
+	int upper_index                   = 0;
+
+	if( owner_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner map.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_map->is_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid owner map - entries are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	/* Search for the last entry with an offset equal or less than the offset
+	 */
+	upper_index = owner_map->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( owner_map->entries[ entry_index ].offset <= offset )
+		{
+			lower_index = entry_index + 1;
+		}
+		else
+		{
+			upper_index = entry_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	entry = &( owner_map->entries[ lower_index - 1 ] );
+
+	if( (size64_t) ( offset - entry->offset ) >= entry->size )
+	{
+		return( 0 );
+	}
+	*inode_number = entry->inode_number;
+
+	return( 1 );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * Block owner map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_OWNER_MAP_H )
+#define _LIBFSXFS_OWNER_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_owner_map_entry libfsxfs_owner_map_entry_t;
+
+struct libfsxfs_owner_map_entry
+{
+	/* The volume offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The inode number of the owner
+	 */
+	uint64_t inode_number;
+};
+
+typedef struct libfsxfs_owner_map libfsxfs_owner_map_t;
+
+struct libfsxfs_owner_map
+{
+	/* The entries
+	 */
+	libfsxfs_owner_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* Value to indicate the entries are sorted by offset
+	 */
+	uint8_t is_sorted;
+};
+
+int libfsxfs_owner_map_initialize(
+     libfsxfs_owner_map_t **owner_map,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_free(
+     libfsxfs_owner_map_t **owner_map,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_append_entry(
+     libfsxfs_owner_map_t *owner_map,
+     off64_t offset,
+     size64_t size,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfsxfs_owner_map_sort(
+     libfsxfs_owner_map_t *owner_map,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_read_inode(
+     libfsxfs_owner_map_t *owner_map,
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_read_file_system(
+     libfsxfs_owner_map_t *owner_map,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_owner_map_get_inode_number_by_offset(
+     libfsxfs_owner_map_t *owner_map,
+     off64_t offset,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_OWNER_MAP_H ) */
+
@@ -0,0 +1,299 @@
+/*
+ * Quota record functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_quota_record.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+
+#include "fsxfs_quota.h"
+
+/* Creates a quota record
+ * Make sure the value quota_record is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_record_initialize(
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_record_initialize";
+
+	if( quota_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid quota record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*quota_record = memory_allocate_structure(
+	                 libfsxfs_quota_record_t );
+
+	if( *quota_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create quota record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *quota_record,
+	     0,
+	     sizeof( libfsxfs_quota_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear quota record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *quota_record != NULL )
+	{
+		memory_free(
+		 *quota_record );
+
+		*quota_record = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a quota record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_record_free(
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_record_free";
+
+	if( quota_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_record != NULL )
+	{
+		memory_free(
+		 *quota_record );
+
+		*quota_record = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the quota record data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_record_read_data(
+     libfsxfs_quota_record_t *quota_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_record_read_data";
+
+	if( quota_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota record.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsxfs_quota_record_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: quota record data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsxfs_quota_record_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( memory_compare(
+	     ( (fsxfs_quota_record_t *) data )->signature,
+	     "DQ",
+	     2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	quota_record->quota_type = ( (fsxfs_quota_record_t *) data )->quota_type;
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->identifier,
+	 quota_record->identifier );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->block_hard_limit,
+	 quota_record->block_hard_limit );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->block_soft_limit,
+	 quota_record->block_soft_limit );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->inode_hard_limit,
+	 quota_record->inode_hard_limit );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->inode_soft_limit,
+	 quota_record->inode_soft_limit );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->number_of_blocks,
+	 quota_record->number_of_blocks );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_quota_record_t *) data )->number_of_inodes,
+	 quota_record->number_of_inodes );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: %c%c\n",
+		 function,
+		 ( (fsxfs_quota_record_t *) data )->signature[ 0 ],
+		 ( (fsxfs_quota_record_t *) data )->signature[ 1 ] );
+
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu8 "\n",
+		 function,
+		 ( (fsxfs_quota_record_t *) data )->format_version );
+
+		libcnotify_printf(
+		 "%s: quota type\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 quota_record->quota_type );
+
+		libcnotify_printf(
+		 "%s: identifier\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 quota_record->identifier );
+
+		libcnotify_printf(
+		 "%s: block hard limit\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->block_hard_limit );
+
+		libcnotify_printf(
+		 "%s: block soft limit\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->block_soft_limit );
+
+		libcnotify_printf(
+		 "%s: inode hard limit\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->inode_hard_limit );
+
+		libcnotify_printf(
+		 "%s: inode soft limit\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->inode_soft_limit );
+
+		libcnotify_printf(
+		 "%s: number of blocks\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->number_of_blocks );
+
+		libcnotify_printf(
+		 "%s: number of inodes\t\t\t: %" PRIu64 "\n",
+		 function,
+		 quota_record->number_of_inodes );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,90 @@
+/*
+ * Quota record functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_QUOTA_RECORD_H )
+#define _LIBFSXFS_QUOTA_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_quota_record libfsxfs_quota_record_t;
+
+struct libfsxfs_quota_record
+{
+	/* Quota type
+	 */
+	uint8_t quota_type;
+
+	/* Identifier
+	 */
+	uint32_t identifier;
+
+	/* Number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* Number of inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* Block hard limit
+	 */
+	uint64_t block_hard_limit;
+
+	/* Block soft limit
+	 */
+	uint64_t block_soft_limit;
+
+	/* Inode hard limit
+	 */
+	uint64_t inode_hard_limit;
+
+	/* Inode soft limit
+	 */
+	uint64_t inode_soft_limit;
+};
+
+int libfsxfs_quota_record_initialize(
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_record_free(
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_record_read_data(
+     libfsxfs_quota_record_t *quota_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_QUOTA_RECORD_H ) */
+
@@ -0,0 +1,760 @@
+/*
+ * Quota usage functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_quota_record.h"
+#include "libfsxfs_quota_usage.h"
+#include "libfsxfs_superblock.h"
+
+#include "fsxfs_quota.h"
+
+/* Creates quota usage
+ * Make sure the value quota_usage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_initialize(
+     libfsxfs_quota_usage_t **quota_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_usage_initialize";
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid quota usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*quota_usage = memory_allocate_structure(
+	                libfsxfs_quota_usage_t );
+
+	if( *quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create quota usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *quota_usage,
+	     0,
+	     sizeof( libfsxfs_quota_usage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear quota usage.",
+		 function );
+
+		memory_free(
+		 *quota_usage );
+
+		*quota_usage = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *quota_usage )->records_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create quota records array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *quota_usage != NULL )
+	{
+		memory_free(
+		 *quota_usage );
+
+		*quota_usage = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees quota usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_free(
+     libfsxfs_quota_usage_t **quota_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_usage_free";
+	int result            = 1;
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *quota_usage != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *quota_usage )->records_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_quota_record_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free quota records array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *quota_usage );
+
+		*quota_usage = NULL;
+	}
+	return( result );
+}
+
+/* Reads the quota records of a quota file block
+ * Records without block and inode usage are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_read_block_data(
+     libfsxfs_quota_usage_t *quota_usage,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_quota_record_t *quota_record = NULL;
+	static char *function                 = "libfsxfs_quota_usage_read_block_data";
+	size_t data_offset                    = 0;
+	int entry_index                       = 0;
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_offset + sizeof( fsxfs_quota_record_t ) ) <= data_size )
+	{
+		if( libfsxfs_quota_record_initialize(
+		     &quota_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create quota record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_quota_record_read_data(
+		     quota_record,
+		     &( data[ data_offset ] ),
+		     sizeof( fsxfs_quota_record_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read quota record at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			goto on_error;
+		}
+		data_offset += sizeof( fsxfs_quota_record_t );
+
+		if( ( quota_record->number_of_blocks == 0 )
+		 && ( quota_record->number_of_inodes == 0 ) )
+		{
+			if( libfsxfs_quota_record_free(
+			     &quota_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free quota record.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libcdata_array_append_entry(
+		     quota_usage->records_array,
+		     &entry_index,
+		     (intptr_t *) quota_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append quota record to array.",
+			 function );
+
+			goto on_error;
+		}
+		quota_record = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( quota_record != NULL )
+	{
+		libfsxfs_quota_record_free(
+		 &quota_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the quota records of a quota inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_read_inode(
+     libfsxfs_quota_usage_t *quota_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent       = NULL;
+	libfsxfs_inode_t *inode         = NULL;
+	uint8_t *block_data             = NULL;
+	static char *function           = "libfsxfs_quota_usage_read_inode";
+	ssize_t read_count              = 0;
+	off64_t block_offset            = 0;
+	uint64_t allocation_group_index = 0;
+	uint64_t decode_start_timestamp = 0;
+	uint64_t read_start_timestamp   = 0;
+	uint64_t relative_block_number  = 0;
+	uint32_t block_index            = 0;
+	int extent_index                = 0;
+	int number_of_extents           = 0;
+	int result                      = 0;
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_get_inode_by_number(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          inode_number,
+	          &inode,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve quota inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_get_number_of_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * io_handle->block_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_get_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		/* Quota records are only stored in allocated blocks
+		 */
+		if( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			continue;
+		}
+		allocation_group_index = extent->physical_block_number >> io_handle->number_of_relative_block_number_bits;
+		relative_block_number  = extent->physical_block_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+		block_offset = (off64_t) ( ( allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+		for( block_index = 0;
+		     block_index < extent->number_of_blocks;
+		     block_index++ )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading quota block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 block_offset,
+				 block_offset );
+			}
+#endif
+			read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+			                       io_handle );
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              block_data,
+			              (size_t) io_handle->block_size,
+			              block_offset,
+			              error );
+
+			if( read_count != (ssize_t) io_handle->block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read quota block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			decode_start_timestamp = libfsxfs_io_handle_get_timestamp(
+			                         io_handle );
+
+			if( libfsxfs_quota_usage_read_block_data(
+			     quota_usage,
+			     block_data,
+			     (size_t) io_handle->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read quota block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			if( libfsxfs_io_handle_add_read(
+			     io_handle,
+			     LIBFSXFS_READ_CATEGORY_FILE_DATA,
+			     block_offset,
+			     (size_t) io_handle->block_size,
+			     inode_number,
+			     read_start_timestamp,
+			     decode_start_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add read to IO handle.",
+				 function );
+
+				goto on_error;
+			}
+			block_offset += io_handle->block_size;
+		}
+	}
+	memory_free(
+	 block_data );
+
+	block_data = NULL;
+
+	if( libfsxfs_inode_free(
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free quota inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the quota records of the quota inodes of the file system
+ * Only the quota inodes for which accounting is enabled are read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_read_file_system(
+     libfsxfs_quota_usage_t *quota_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_superblock_t *superblock,
+     libcerror_error_t **error )
+{
+	uint64_t quota_inode_numbers[ 3 ];
+
+	static char *function      = "libfsxfs_quota_usage_read_file_system";
+	uint16_t group_quota_flags = 0;
+	int quota_inode_index      = 0;
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	quota_inode_numbers[ 0 ] = 0;
+	quota_inode_numbers[ 1 ] = 0;
+	quota_inode_numbers[ 2 ] = 0;
+
+	if( ( superblock->quota_flags & LIBFSXFS_QUOTA_FLAG_USER_ACCOUNTING ) != 0 )
+	{
+		quota_inode_numbers[ 0 ] = superblock->user_quota_inode_number;
+	}
+	/* Before version 5 the group quota inode is used for either group or project quota
+	 */
+	group_quota_flags = LIBFSXFS_QUOTA_FLAG_GROUP_ACCOUNTING;
+
+	if( superblock->format_version < 5 )
+	{
+		group_quota_flags |= LIBFSXFS_QUOTA_FLAG_PROJECT_ACCOUNTING;
+	}
+	if( ( superblock->quota_flags & group_quota_flags ) != 0 )
+	{
+		quota_inode_numbers[ 1 ] = superblock->group_quota_inode_number;
+	}
+	if( ( superblock->format_version == 5 )
+	 && ( ( superblock->quota_flags & LIBFSXFS_QUOTA_FLAG_PROJECT_ACCOUNTING ) != 0 ) )
+	{
+		quota_inode_numbers[ 2 ] = superblock->project_quota_inode_number;
+	}
+	for( quota_inode_index = 0;
+	     quota_inode_index < 3;
+	     quota_inode_index++ )
+	{
+		/* An inode number of 0 or -1 indicates there is no quota inode
+		 */
+		if( ( quota_inode_numbers[ quota_inode_index ] == 0 )
+		 || ( quota_inode_numbers[ quota_inode_index ] == (uint64_t) -1 ) )
+		{
+			continue;
+		}
+		if( libfsxfs_quota_usage_read_inode(
+		     quota_usage,
+		     io_handle,
+		     file_io_handle,
+		     file_system,
+		     quota_inode_numbers[ quota_inode_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read quota inode: %" PRIu64 ".",
+			 function,
+			 quota_inode_numbers[ quota_inode_index ] );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of quota records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_get_number_of_records(
+     libfsxfs_quota_usage_t *quota_usage,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_usage_get_number_of_records";
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     quota_usage->records_array,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific quota record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_quota_usage_get_record_by_index(
+     libfsxfs_quota_usage_t *quota_usage,
+     int record_index,
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_quota_usage_get_record_by_index";
+
+	if( quota_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     quota_usage->records_array,
+	     record_index,
+	     (intptr_t **) quota_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve quota record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Quota usage functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_QUOTA_USAGE_H )
+#define _LIBFSXFS_QUOTA_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_quota_record.h"
+#include "libfsxfs_superblock.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_quota_usage libfsxfs_quota_usage_t;
+
+struct libfsxfs_quota_usage
+{
+	/* The quota records array
+	 */
+	libcdata_array_t *records_array;
+};
+
+int libfsxfs_quota_usage_initialize(
+     libfsxfs_quota_usage_t **quota_usage,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_free(
+     libfsxfs_quota_usage_t **quota_usage,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_read_block_data(
+     libfsxfs_quota_usage_t *quota_usage,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_read_inode(
+     libfsxfs_quota_usage_t *quota_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_read_file_system(
+     libfsxfs_quota_usage_t *quota_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_superblock_t *superblock,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_get_number_of_records(
+     libfsxfs_quota_usage_t *quota_usage,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libfsxfs_quota_usage_get_record_by_index(
+     libfsxfs_quota_usage_t *quota_usage,
+     int record_index,
+     libfsxfs_quota_record_t **quota_record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_QUOTA_USAGE_H ) */
+
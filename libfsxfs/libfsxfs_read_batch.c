@@ -0,0 +1,975 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_engine.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_read_batch.h"
+
+/* Creates a read batch
+ * Make sure the value read_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_batch_initialize(
+     libfsxfs_read_batch_t **read_batch,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_batch_initialize";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*read_batch = memory_allocate_structure(
+	               libfsxfs_read_batch_t );
+
+	if( *read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_batch,
+	     0,
+	     sizeof( libfsxfs_read_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read batch.",
+		 function );
+
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+
+		return( -1 );
+	}
+	( *read_batch )->io_handle      = io_handle;
+	( *read_batch )->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *read_batch != NULL )
+	{
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_batch_free(
+     libfsxfs_read_batch_t **read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_batch_free";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		if( ( *read_batch )->entries != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->entries );
+		}
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the read batch
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_batch_append_entry(
+     libfsxfs_read_batch_t *read_batch,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t inode_number,
+     ssize_t *range_read_count,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_batch_entry_t *entries = NULL;
+	static char *function                = "libfsxfs_read_batch_append_entry";
+	int number_of_allocated_entries      = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->number_of_entries >= read_batch->number_of_allocated_entries )
+	{
+		if( read_batch->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBFSXFS_READ_BATCH_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			number_of_allocated_entries = read_batch->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries <= read_batch->number_of_allocated_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_read_batch_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfsxfs_read_batch_entry_t *) memory_reallocate(
+		                                           read_batch->entries,
+		                                           sizeof( libfsxfs_read_batch_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		read_batch->entries                     = entries;
+		read_batch->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	read_batch->entries[ read_batch->number_of_entries ].offset           = offset;
+	read_batch->entries[ read_batch->number_of_entries ].data             = data;
+	read_batch->entries[ read_batch->number_of_entries ].data_size        = data_size;
+	read_batch->entries[ read_batch->number_of_entries ].inode_number     = inode_number;
+	read_batch->entries[ read_batch->number_of_entries ].range_read_count = range_read_count;
+
+	read_batch->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific logical block
+ * The extents of the inode are sorted by logical block number hence a binary search is used
+ * If no extent contains the block the index of the first extent after the block is set
+ * Returns 1 if successful, 0 if no extent contains the block or -1 on error
+ */
+int libfsxfs_read_batch_get_extent_index_at_block(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent = NULL;
+	static char *function     = "libfsxfs_read_batch_get_extent_index_at_block";
+	int lower_index           = 0;
+	int middle_index          = 0;
+	int upper_index           = 0;
+
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_extents(
+	     inode,
+	     &upper_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libfsxfs_inode_get_extent_by_index(
+		     inode,
+		     middle_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( logical_block_number < extent->logical_block_number )
+		{
+			upper_index = middle_index;
+		}
+		else if( logical_block_number >= ( extent->logical_block_number + extent->number_of_blocks ) )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*extent_index = middle_index;
+
+			return( 1 );
+		}
+	}
+	*extent_index = lower_index;
+
+	return( 0 );
+}
+
+/* Adds a range of the data of an inode to the read batch
+ * The range is resolved into reads of the physical extents, sparse extents and
+ * inline data are copied into the buffer directly. The number of bytes of the range,
+ * that is limited by the data size, is stored in range_read_count and set to -1
+ * if a read of the range fails when the batch is flushed.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_batch_add_range(
+     libfsxfs_read_batch_t *read_batch,
+     libfsxfs_inode_t *inode,
+     size64_t data_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     ssize_t *range_read_count,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent       = NULL;
+	static char *function           = "libfsxfs_read_batch_add_range";
+	size64_t extent_offset          = 0;
+	size64_t extent_size            = 0;
+	size_t buffer_offset            = 0;
+	size_t read_size                = 0;
+	size_t segment_size             = 0;
+	off64_t current_offset          = 0;
+	off64_t physical_offset         = 0;
+	uint64_t allocation_group_index = 0;
+	uint64_t relative_block_number  = 0;
+	int extent_index                = 0;
+	int number_of_extents           = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read batch - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read batch - invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range read count.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset < data_size )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > ( data_size - offset ) )
+		{
+			read_size = (size_t) ( data_size - offset );
+		}
+	}
+	*range_read_count = (ssize_t) read_size;
+
+	if( read_size == 0 )
+	{
+		return( 1 );
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		if( ( inode->inline_data == NULL )
+		 || ( (size64_t) ( offset + read_size ) > inode->size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid inode - inline data value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( inode->inline_data[ offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inline data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data fork type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_read_batch_get_extent_index_at_block(
+	     inode,
+	     (uint64_t) offset / read_batch->io_handle->block_size,
+	     &extent_index,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( buffer_offset < read_size )
+	{
+		current_offset = offset + (off64_t) buffer_offset;
+		segment_size   = read_size - buffer_offset;
+		extent         = NULL;
+
+		if( extent_index < number_of_extents )
+		{
+			if( libfsxfs_inode_get_extent_by_index(
+			     inode,
+			     extent_index,
+			     &extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			if( extent == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			extent_offset = extent->logical_block_number * read_batch->io_handle->block_size;
+			extent_size   = (size64_t) extent->number_of_blocks * read_batch->io_handle->block_size;
+		}
+		if( ( extent == NULL )
+		 || ( (size64_t) current_offset < extent_offset ) )
+		{
+			/* Data that is not covered by an extent is sparse
+			 */
+			if( ( extent != NULL )
+			 && ( (size64_t) segment_size > ( extent_offset - current_offset ) ) )
+			{
+				segment_size = (size_t) ( extent_offset - current_offset );
+			}
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     segment_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( (size64_t) segment_size > ( extent_offset + extent_size - current_offset ) )
+			{
+				segment_size = (size_t) ( extent_offset + extent_size - current_offset );
+			}
+			if( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			{
+				if( memory_set(
+				     &( buffer[ buffer_offset ] ),
+				     0,
+				     segment_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				allocation_group_index = extent->physical_block_number >> read_batch->io_handle->number_of_relative_block_number_bits;
+				relative_block_number  = extent->physical_block_number & ( ( (uint64_t) 1 << read_batch->io_handle->number_of_relative_block_number_bits ) - 1 );
+
+				physical_offset = (off64_t) ( ( allocation_group_index * read_batch->io_handle->allocation_group_size ) + relative_block_number ) * read_batch->io_handle->block_size;
+
+				if( libfsxfs_read_batch_append_entry(
+				     read_batch,
+				     physical_offset + (off64_t) ( current_offset - extent_offset ),
+				     &( buffer[ buffer_offset ] ),
+				     segment_size,
+				     inode->inode_number,
+				     range_read_count,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append entry.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			extent_index++;
+		}
+		buffer_offset += segment_size;
+	}
+	return( 1 );
+}
+
+/* Compares two read batch entries by their offset
+ * Returns -1 if the first entry is before the second, 0 if equal or 1 if after
+ */
+int libfsxfs_read_batch_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	off64_t first_offset  = ( (libfsxfs_read_batch_entry_t *) first_entry )->offset;
+	off64_t second_offset = ( (libfsxfs_read_batch_entry_t *) second_entry )->offset;
+
+	if( first_offset < second_offset )
+	{
+		return( -1 );
+	}
+	else if( first_offset > second_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Flushes the read batch
+ * The entries are sorted by their offset and entries that are adjacent on the volume
+ * are merged into a single read. The reads are issued as batches of requests using
+ * the IO engine, if available. A failed read does not fail the flush, but sets
+ * the read count of the ranges of the entries it does not cover to -1
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_batch_flush(
+     libfsxfs_read_batch_t *read_batch,
+     libcerror_error_t **error )
+{
+	libfsxfs_io_request_t requests[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+	uint8_t *merge_buffers[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+	int first_entry_indexes[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+	int numbers_of_entries[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+
+	libcerror_error_t *read_error      = NULL;
+	libfsxfs_read_batch_entry_t *entry = NULL;
+	static char *function              = "libfsxfs_read_batch_flush";
+	size_t data_offset                 = 0;
+	size_t read_size                   = 0;
+	uint64_t read_start_timestamp      = 0;
+	int data_is_contiguous             = 0;
+	int entry_index                    = 0;
+	int first_entry_index              = 0;
+	int number_of_requests             = 0;
+	int request_entry_index            = 0;
+	int request_index                  = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid read batch - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->number_of_entries > 1 )
+	{
+		qsort(
+		 read_batch->entries,
+		 (size_t) read_batch->number_of_entries,
+		 sizeof( libfsxfs_read_batch_entry_t ),
+		 &libfsxfs_read_batch_entry_compare );
+	}
+	while( entry_index < read_batch->number_of_entries )
+	{
+		number_of_requests = 0;
+
+		while( ( entry_index < read_batch->number_of_entries )
+		    && ( number_of_requests < LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ) )
+		{
+			first_entry_index  = entry_index;
+			read_size          = read_batch->entries[ first_entry_index ].data_size;
+			data_is_contiguous = 1;
+
+			for( entry_index = first_entry_index + 1;
+			     entry_index < read_batch->number_of_entries;
+			     entry_index++ )
+			{
+				entry = &( read_batch->entries[ entry_index ] );
+
+				if( ( entry->offset != ( read_batch->entries[ first_entry_index ].offset + (off64_t) read_size ) )
+				 || ( read_size >= (size_t) LIBFSXFS_READ_BATCH_MAXIMUM_MERGED_READ_SIZE )
+				 || ( entry->data_size > ( (size_t) LIBFSXFS_READ_BATCH_MAXIMUM_MERGED_READ_SIZE - read_size ) ) )
+				{
+					break;
+				}
+				if( entry->data != &( read_batch->entries[ first_entry_index ].data[ read_size ] ) )
+				{
+					data_is_contiguous = 0;
+				}
+				read_size += entry->data_size;
+			}
+			merge_buffers[ number_of_requests ] = NULL;
+
+			/* Entries of which the data is not contiguous are read into a merge buffer
+			 */
+			if( data_is_contiguous == 0 )
+			{
+				merge_buffers[ number_of_requests ] = (uint8_t *) memory_allocate(
+				                                                   sizeof( uint8_t ) * read_size );
+
+				if( merge_buffers[ number_of_requests ] == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create merge buffer.",
+					 function );
+
+					goto on_error;
+				}
+				requests[ number_of_requests ].data = merge_buffers[ number_of_requests ];
+			}
+			else
+			{
+				requests[ number_of_requests ].data = read_batch->entries[ first_entry_index ].data;
+			}
+			requests[ number_of_requests ].offset     = read_batch->entries[ first_entry_index ].offset;
+			requests[ number_of_requests ].data_size  = read_size;
+			requests[ number_of_requests ].read_count = -1;
+
+			first_entry_indexes[ number_of_requests ] = first_entry_index;
+			numbers_of_entries[ number_of_requests ]  = entry_index - first_entry_index;
+
+			number_of_requests++;
+		}
+		read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+		                       read_batch->io_handle );
+
+		if( read_batch->io_handle->io_engine != NULL )
+		{
+			libfsxfs_io_engine_read_requests(
+			 read_batch->io_handle->io_engine,
+			 read_batch->file_io_handle,
+			 requests,
+			 number_of_requests,
+			 &read_error );
+		}
+		else
+		{
+			for( request_index = 0;
+			     request_index < number_of_requests;
+			     request_index++ )
+			{
+				requests[ request_index ].read_count = libbfio_handle_read_buffer_at_offset(
+				                                        read_batch->file_io_handle,
+				                                        requests[ request_index ].data,
+				                                        requests[ request_index ].data_size,
+				                                        requests[ request_index ].offset,
+				                                        &read_error );
+
+				if( requests[ request_index ].read_count < 0 )
+				{
+					break;
+				}
+			}
+		}
+		/* The failed reads are reported by their read count
+		 */
+		if( read_error != NULL )
+		{
+			libcerror_error_free(
+			 &read_error );
+		}
+		for( request_index = 0;
+		     request_index < number_of_requests;
+		     request_index++ )
+		{
+			data_offset = 0;
+
+			for( request_entry_index = 0;
+			     request_entry_index < numbers_of_entries[ request_index ];
+			     request_entry_index++ )
+			{
+				entry = &( read_batch->entries[ first_entry_indexes[ request_index ] + request_entry_index ] );
+
+				data_offset += entry->data_size;
+
+				/* A short read only fails the entries that it does not cover
+				 */
+				if( ( requests[ request_index ].read_count < 0 )
+				 || ( (size_t) requests[ request_index ].read_count < data_offset ) )
+				{
+					if( entry->range_read_count != NULL )
+					{
+						*( entry->range_read_count ) = -1;
+					}
+				}
+				else if( merge_buffers[ request_index ] != NULL )
+				{
+					if( memory_copy(
+					     entry->data,
+					     &( ( merge_buffers[ request_index ] )[ data_offset - entry->data_size ] ),
+					     entry->data_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy data from merge buffer.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			if( requests[ request_index ].read_count == (ssize_t) requests[ request_index ].data_size )
+			{
+				/* A merged read is attributed to the inode of its first entry
+				 */
+				if( libfsxfs_io_handle_add_read(
+				     read_batch->io_handle,
+				     LIBFSXFS_READ_CATEGORY_FILE_DATA,
+				     requests[ request_index ].offset,
+				     requests[ request_index ].data_size,
+				     read_batch->entries[ first_entry_indexes[ request_index ] ].inode_number,
+				     read_start_timestamp,
+				     libfsxfs_io_handle_get_timestamp( read_batch->io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to add read to IO handle.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( merge_buffers[ request_index ] != NULL )
+			{
+				memory_free(
+				 merge_buffers[ request_index ] );
+
+				merge_buffers[ request_index ] = NULL;
+			}
+		}
+	}
+	read_batch->number_of_entries = 0;
+
+	return( 1 );
+
+on_error:
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		if( merge_buffers[ request_index ] != NULL )
+		{
+			memory_free(
+			 merge_buffers[ request_index ] );
+		}
+	}
+	return( -1 );
+}
+
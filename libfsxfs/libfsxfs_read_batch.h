@@ -0,0 +1,135 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_READ_BATCH_H )
+#define _LIBFSXFS_READ_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_read_batch_entry libfsxfs_read_batch_entry_t;
+
+struct libfsxfs_read_batch_entry
+{
+	/* The volume offset
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The read count of the range the entry is part of
+	 */
+	ssize_t *range_read_count;
+};
+
+typedef struct libfsxfs_read_batch libfsxfs_read_batch_t;
+
+struct libfsxfs_read_batch
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The entries
+	 */
+	libfsxfs_read_batch_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libfsxfs_read_batch_initialize(
+     libfsxfs_read_batch_t **read_batch,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_read_batch_free(
+     libfsxfs_read_batch_t **read_batch,
+     libcerror_error_t **error );
+
+int libfsxfs_read_batch_append_entry(
+     libfsxfs_read_batch_t *read_batch,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t inode_number,
+     ssize_t *range_read_count,
+     libcerror_error_t **error );
+
+int libfsxfs_read_batch_get_extent_index_at_block(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libcerror_error_t **error );
+
+int libfsxfs_read_batch_add_range(
+     libfsxfs_read_batch_t *read_batch,
+     libfsxfs_inode_t *inode,
+     size64_t data_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     ssize_t *range_read_count,
+     libcerror_error_t **error );
+
+int libfsxfs_read_batch_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfsxfs_read_batch_flush(
+     libfsxfs_read_batch_t *read_batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_READ_BATCH_H ) */
+
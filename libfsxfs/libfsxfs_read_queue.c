@@ -0,0 +1,613 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_read_queue.h"
+#include "libfsxfs_types.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_initialize(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_queue = memory_allocate_structure(
+	               libfsxfs_read_queue_t );
+
+	if( *read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_queue,
+	     0,
+	     sizeof( libfsxfs_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *read_queue )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *read_queue != NULL )
+	{
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * The requests that are still queued are freed without calling their callback
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_free(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_queue_request_t *next_request = NULL;
+	libfsxfs_read_queue_request_t *request      = NULL;
+	static char *function                       = "libfsxfs_read_queue_free";
+	int result                                  = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		request = ( *read_queue )->first_request;
+
+		while( request != NULL )
+		{
+			next_request = request->next_request;
+
+			memory_free(
+			 request );
+
+			request = next_request;
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *read_queue )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *read_queue );
+
+		*read_queue = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a request onto the end of the read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_push_request(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            intptr_t *callback_data,
+            libfsxfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_queue_request_t *request = NULL;
+	static char *function                  = "libfsxfs_read_queue_push_request";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback.",
+		 function );
+
+		return( -1 );
+	}
+	request = memory_allocate_structure(
+	           libfsxfs_read_queue_request_t );
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create request.",
+		 function );
+
+		return( -1 );
+	}
+	request->file_entry    = file_entry;
+	request->buffer        = buffer;
+	request->buffer_size   = buffer_size;
+	request->offset        = offset;
+	request->callback      = callback;
+	request->callback_data = callback_data;
+	request->read_count    = -1;
+	request->next_request  = NULL;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		memory_free(
+		 request );
+
+		return( -1 );
+	}
+#endif
+	if( read_queue->last_request == NULL )
+	{
+		read_queue->first_request = request;
+	}
+	else
+	{
+		read_queue->last_request->next_request = request;
+	}
+	read_queue->last_request = request;
+
+	read_queue->number_of_requests += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Pops requests from the start of the read queue
+ * At most maximum_number_of_requests requests are stored in the requests array,
+ * the caller takes ownership of the requests and must complete them
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_pop_requests(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_read_queue_request_t **requests,
+     int maximum_number_of_requests,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_queue_request_t *request = NULL;
+	static char *function                  = "libfsxfs_read_queue_pop_requests";
+	int request_index                      = 0;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_requests < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of requests value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( request_index < maximum_number_of_requests )
+	    && ( read_queue->first_request != NULL ) )
+	{
+		request = read_queue->first_request;
+
+		read_queue->first_request = request->next_request;
+
+		request->next_request = NULL;
+
+		requests[ request_index++ ] = request;
+	}
+	if( read_queue->first_request == NULL )
+	{
+		read_queue->last_request = NULL;
+	}
+	read_queue->number_of_requests -= request_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_requests = request_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of requests in the read queue
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_get_number_of_requests(
+     libfsxfs_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_queue_get_number_of_requests";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_requests = read_queue->number_of_requests;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Completes a request that was popped from the read queue
+ * Calls the callback of the request with its read count and frees the request
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_complete_request(
+     libfsxfs_read_queue_request_t **request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_read_queue_complete_request";
+
+	if( request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *request != NULL )
+	{
+		if( ( *request )->callback != NULL )
+		{
+			( *request )->callback(
+			 ( *request )->callback_data,
+			 ( *request )->file_entry,
+			 (void *) ( *request )->buffer,
+			 ( *request )->read_count );
+		}
+		memory_free(
+		 *request );
+
+		*request = NULL;
+	}
+	return( 1 );
+}
+
+/* Cancels the requests in the read queue
+ * The callback of every queued request is called with a read count of -1
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_read_queue_cancel_requests(
+     libfsxfs_read_queue_t *read_queue,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_queue_request_t *request = NULL;
+	static char *function                  = "libfsxfs_read_queue_cancel_requests";
+	int number_of_requests                 = 0;
+
+	do
+	{
+		if( libfsxfs_read_queue_pop_requests(
+		     read_queue,
+		     &request,
+		     1,
+		     &number_of_requests,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop request.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_requests == 1 )
+		{
+			request->read_count = -1;
+
+			if( libfsxfs_read_queue_complete_request(
+			     &request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to complete request.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( number_of_requests == 1 );
+
+	return( 1 );
+}
+
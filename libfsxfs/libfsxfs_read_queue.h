@@ -0,0 +1,147 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_READ_QUEUE_H )
+#define _LIBFSXFS_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_read_queue_request libfsxfs_read_queue_request_t;
+
+struct libfsxfs_read_queue_request
+{
+	/* The file entry
+	 */
+	libfsxfs_file_entry_t *file_entry;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The callback function
+	 */
+	void (*callback)(
+	       intptr_t *callback_data,
+	       libfsxfs_file_entry_t *file_entry,
+	       void *buffer,
+	       ssize_t read_count );
+
+	/* The callback data
+	 */
+	intptr_t *callback_data;
+
+	/* The number of bytes read, where -1 represents a failed read
+	 */
+	ssize_t read_count;
+
+	/* The next request in the queue
+	 */
+	libfsxfs_read_queue_request_t *next_request;
+};
+
+typedef struct libfsxfs_read_queue libfsxfs_read_queue_t;
+
+struct libfsxfs_read_queue
+{
+	/* The first request
+	 */
+	libfsxfs_read_queue_request_t *first_request;
+
+	/* The last request
+	 */
+	libfsxfs_read_queue_request_t *last_request;
+
+	/* The number of requests
+	 */
+	int number_of_requests;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsxfs_read_queue_initialize(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_free(
+     libfsxfs_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_push_request(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            intptr_t *callback_data,
+            libfsxfs_file_entry_t *file_entry,
+            void *buffer,
+            ssize_t read_count ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_pop_requests(
+     libfsxfs_read_queue_t *read_queue,
+     libfsxfs_read_queue_request_t **requests,
+     int maximum_number_of_requests,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_get_number_of_requests(
+     libfsxfs_read_queue_t *read_queue,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_complete_request(
+     libfsxfs_read_queue_request_t **request,
+     libcerror_error_t **error );
+
+int libfsxfs_read_queue_cancel_requests(
+     libfsxfs_read_queue_t *read_queue,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_READ_QUEUE_H ) */
+
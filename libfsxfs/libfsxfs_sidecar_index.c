@@ -0,0 +1,1594 @@
+/*
+ * Sidecar index functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_metadata_table.h"
+#include "libfsxfs_sidecar_index.h"
+#include "libfsxfs_superblock.h"
+
+#include "fsxfs_sidecar_index.h"
+
+const char *fsxfs_sidecar_index_signature = "FSXFSIDX";
+
+/* Creates a sidecar index
+ * Make sure the value sidecar_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_initialize(
+     libfsxfs_sidecar_index_t **sidecar_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_sidecar_index_initialize";
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sidecar_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sidecar index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sidecar_index = memory_allocate_structure(
+	                  libfsxfs_sidecar_index_t );
+
+	if( *sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sidecar index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sidecar_index,
+	     0,
+	     sizeof( libfsxfs_sidecar_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sidecar index.",
+		 function );
+
+		memory_free(
+		 *sidecar_index );
+
+		*sidecar_index = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *sidecar_index != NULL )
+	{
+		memory_free(
+		 *sidecar_index );
+
+		*sidecar_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sidecar index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_free(
+     libfsxfs_sidecar_index_t **sidecar_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_sidecar_index_free";
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sidecar_index != NULL )
+	{
+		if( ( *sidecar_index )->data != NULL )
+		{
+			memory_free(
+			 ( *sidecar_index )->data );
+		}
+		memory_free(
+		 *sidecar_index );
+
+		*sidecar_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a directory entry name (32-bit FNV-1a)
+ * The hash covers the little-endian parent inode number followed by the name
+ * Returns the hash value
+ */
+uint32_t libfsxfs_sidecar_index_calculate_hash(
+          uint64_t parent_inode_number,
+          const uint8_t *name,
+          size_t name_size )
+{
+	size_t name_index  = 0;
+	uint32_t hash      = 0x811c9dc5UL;
+	uint8_t byte_index = 0;
+
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash ^= (uint8_t) ( parent_inode_number & 0xff );
+		hash *= 0x01000193UL;
+
+		parent_inode_number >>= 8;
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		hash ^= name[ name_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Reads the sidecar index header from the data
+ * Determines the layout of the sidecar index and checks if it is within the bounds of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_read_header(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_header_t *header = NULL;
+	static char *function                = "libfsxfs_sidecar_index_read_header";
+	size_t data_offset                   = 0;
+	uint64_t value_64bit                 = 0;
+	uint32_t format_version              = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sidecar index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data_size < sizeof( fsxfs_sidecar_index_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sidecar index - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header = (fsxfs_sidecar_index_header_t *) sidecar_index->data;
+
+	if( memory_compare(
+	     header->signature,
+	     fsxfs_sidecar_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->format_version,
+	 format_version );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     sidecar_index->file_system_identifier,
+	     header->file_system_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 header->media_size,
+	 sidecar_index->media_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_blocks,
+	 sidecar_index->number_of_blocks );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_inodes,
+	 sidecar_index->number_of_inodes );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_free_inodes,
+	 sidecar_index->number_of_free_inodes );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_free_data_blocks,
+	 sidecar_index->number_of_free_data_blocks );
+
+	data_offset = sizeof( fsxfs_sidecar_index_header_t );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_inode_chunks,
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) ( ( sidecar_index->data_size - data_offset ) / sizeof( fsxfs_sidecar_index_inode_chunk_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of inode chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_index->number_of_inode_chunks = (size_t) value_64bit;
+	sidecar_index->inode_chunks_offset    = data_offset;
+
+	data_offset += sidecar_index->number_of_inode_chunks * sizeof( fsxfs_sidecar_index_inode_chunk_t );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_directory_entries,
+	 value_64bit );
+
+	if( ( value_64bit >= (uint64_t) UINT32_MAX )
+	 || ( value_64bit > (uint64_t) ( ( sidecar_index->data_size - data_offset ) / sizeof( fsxfs_sidecar_index_directory_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directory entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_index->number_of_directory_entries = (size_t) value_64bit;
+	sidecar_index->directory_entries_offset    = data_offset;
+
+	data_offset += sidecar_index->number_of_directory_entries * sizeof( fsxfs_sidecar_index_directory_entry_t );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 header->number_of_hash_slots,
+	 value_64bit );
+
+	/* The number of hash table slots must be a power of 2 and larger than
+	 * the number of directory entries so that a lookup always terminates
+	 */
+	if( ( value_64bit <= (uint64_t) sidecar_index->number_of_directory_entries )
+	 || ( ( value_64bit & ( value_64bit - 1 ) ) != 0 )
+	 || ( value_64bit > (uint64_t) ( ( sidecar_index->data_size - data_offset ) / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hash table slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_index->number_of_hash_slots = (size_t) value_64bit;
+	sidecar_index->hash_slots_offset    = data_offset;
+
+	data_offset += sidecar_index->number_of_hash_slots * 4;
+
+	if( ( data_offset % 8 ) != 0 )
+	{
+		data_offset += 8 - ( data_offset % 8 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 header->string_heap_size,
+	 value_64bit );
+
+	if( ( data_offset > sidecar_index->data_size )
+	 || ( value_64bit > (uint64_t) ( sidecar_index->data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string heap size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sidecar_index->string_heap_size   = (size_t) value_64bit;
+	sidecar_index->string_heap_offset = data_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of inode chunks\t\t: %" PRIzd "\n",
+		 function,
+		 sidecar_index->number_of_inode_chunks );
+
+		libcnotify_printf(
+		 "%s: number of directory entries\t: %" PRIzd "\n",
+		 function,
+		 sidecar_index->number_of_directory_entries );
+
+		libcnotify_printf(
+		 "%s: number of hash table slots\t: %" PRIzd "\n",
+		 function,
+		 sidecar_index->number_of_hash_slots );
+
+		libcnotify_printf(
+		 "%s: string heap size\t\t: %" PRIzd "\n",
+		 function,
+		 sidecar_index->string_heap_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads the sidecar index
+ * The entire sidecar index file is read into memory, lookups are served from
+ * the data as stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_read_file_io_handle(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_sidecar_index_read_file_io_handle";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sidecar index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( fsxfs_sidecar_index_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	sidecar_index->data_size = (size_t) file_size;
+
+	sidecar_index->data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * sidecar_index->data_size );
+
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              sidecar_index->data,
+	              sidecar_index->data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sidecar_index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_sidecar_index_read_header(
+	     sidecar_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar index header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sidecar_index->data != NULL )
+	{
+		memory_free(
+		 sidecar_index->data );
+
+		sidecar_index->data = NULL;
+	}
+	sidecar_index->data_size = 0;
+
+	return( -1 );
+}
+
+/* Writes the sidecar index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_write_file_io_handle(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_sidecar_index_write_file_io_handle";
+	ssize_t write_count   = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sidecar index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               sidecar_index->data,
+	               sidecar_index->data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) sidecar_index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar index data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inode chunks from the inode B+ trees of all allocation groups
+ * The inode chunks are stored in the format of the sidecar index in order of their inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_read_inode_chunks(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     uint8_t **inode_chunks_data,
+     size_t *number_of_inode_chunks,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_inode_chunk_t *inode_chunk    = NULL;
+	libcdata_array_t *records_array                   = NULL;
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	uint8_t *reallocated_data                         = NULL;
+	uint8_t *safe_inode_chunks_data                   = NULL;
+	static char *function                             = "libfsxfs_sidecar_index_read_inode_chunks";
+	size_t number_of_allocated_inode_chunks           = 0;
+	size_t safe_number_of_inode_chunks                = 0;
+	uint64_t first_inode_number                       = 0;
+	uint32_t allocation_group_index                   = 0;
+	int number_of_records                             = 0;
+	int record_index                                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_chunks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode chunks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inode_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inode chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocation_groups > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &records_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records array.",
+		 function );
+
+		goto on_error;
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( libfsxfs_inode_btree_get_records(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     (int) allocation_group_index,
+		     records_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode B+ tree records of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     records_array,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     records_array,
+			     record_index,
+			     (intptr_t **) &inode_btree_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( inode_btree_record == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing record: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( safe_number_of_inode_chunks >= number_of_allocated_inode_chunks )
+			{
+				if( number_of_allocated_inode_chunks == 0 )
+				{
+					number_of_allocated_inode_chunks = 1024;
+				}
+				else
+				{
+					number_of_allocated_inode_chunks *= 2;
+				}
+				if( number_of_allocated_inode_chunks > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( fsxfs_sidecar_index_inode_chunk_t ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid number of allocated inode chunks value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				reallocated_data = (uint8_t *) memory_reallocate(
+				                                safe_inode_chunks_data,
+				                                sizeof( fsxfs_sidecar_index_inode_chunk_t ) * number_of_allocated_inode_chunks );
+
+				if( reallocated_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize inode chunks data.",
+					 function );
+
+					goto on_error;
+				}
+				safe_inode_chunks_data = reallocated_data;
+			}
+			first_inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+			                   | inode_btree_record->inode_number;
+
+			inode_chunk = (fsxfs_sidecar_index_inode_chunk_t *) &( safe_inode_chunks_data[ safe_number_of_inode_chunks * sizeof( fsxfs_sidecar_index_inode_chunk_t ) ] );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 inode_chunk->first_inode_number,
+			 first_inode_number );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 inode_chunk->free_inodes_bitmap,
+			 inode_btree_record->chunk_allocation_bitmap );
+
+			safe_number_of_inode_chunks++;
+		}
+		if( libcdata_array_empty(
+		     records_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty records array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &records_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records array.",
+		 function );
+
+		goto on_error;
+	}
+	*inode_chunks_data      = safe_inode_chunks_data;
+	*number_of_inode_chunks = safe_number_of_inode_chunks;
+
+	return( 1 );
+
+on_error:
+	if( records_array != NULL )
+	{
+		libcdata_array_free(
+		 &records_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+		 NULL );
+	}
+	if( safe_inode_chunks_data != NULL )
+	{
+		memory_free(
+		 safe_inode_chunks_data );
+	}
+	return( -1 );
+}
+
+/* Builds the sidecar index
+ * The directory entries are taken from the metadata table, where the first row
+ * must contain the root directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_sidecar_index_build(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_superblock_t *superblock,
+     size64_t media_size,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_metadata_table_t *metadata_table,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_directory_entry_t *index_directory_entry = NULL;
+	fsxfs_sidecar_index_header_t *header                         = NULL;
+	libfsxfs_metadata_table_row_t *row                           = NULL;
+	uint8_t *inode_chunks_data                                   = NULL;
+	static char *function                                        = "libfsxfs_sidecar_index_build";
+	size_t data_offset                                           = 0;
+	size_t directory_entries_offset                              = 0;
+	size_t hash_slot_index                                       = 0;
+	size_t hash_slots_offset                                     = 0;
+	size_t number_of_directory_entries                           = 0;
+	size_t number_of_hash_slots                                  = 16;
+	size_t number_of_inode_chunks                                = 0;
+	size_t string_heap_offset                                    = 0;
+	uint32_t hash_slot_value                                     = 0;
+	uint8_t file_type                                            = 0;
+	int row_index                                                = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sidecar index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( metadata_table->number_of_rows < 1 )
+	 || ( (size_t) metadata_table->number_of_rows > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) / sizeof( fsxfs_sidecar_index_directory_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata table - number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_sidecar_index_read_inode_chunks(
+	     io_handle,
+	     file_io_handle,
+	     inode_btree,
+	     superblock->number_of_allocation_groups,
+	     &inode_chunks_data,
+	     &number_of_inode_chunks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode chunks.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first row contains the root directory which has no directory entry
+	 */
+	number_of_directory_entries = (size_t) metadata_table->number_of_rows - 1;
+
+	while( number_of_hash_slots < ( number_of_directory_entries * 2 ) )
+	{
+		number_of_hash_slots *= 2;
+	}
+	directory_entries_offset = sizeof( fsxfs_sidecar_index_header_t )
+	                         + ( number_of_inode_chunks * sizeof( fsxfs_sidecar_index_inode_chunk_t ) );
+
+	hash_slots_offset = directory_entries_offset
+	                  + ( number_of_directory_entries * sizeof( fsxfs_sidecar_index_directory_entry_t ) );
+
+	string_heap_offset = hash_slots_offset + ( number_of_hash_slots * 4 );
+
+	if( ( string_heap_offset % 8 ) != 0 )
+	{
+		string_heap_offset += 8 - ( string_heap_offset % 8 );
+	}
+	if( metadata_table->string_heap_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - string_heap_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sidecar index data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	sidecar_index->data_size = string_heap_offset + metadata_table->string_heap_size;
+
+	sidecar_index->data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * sidecar_index->data_size );
+
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     sidecar_index->data,
+	     0,
+	     sidecar_index->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	header = (fsxfs_sidecar_index_header_t *) sidecar_index->data;
+
+	if( memory_copy(
+	     header->signature,
+	     fsxfs_sidecar_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header->format_version,
+	 1 );
+
+	if( memory_copy(
+	     header->file_system_identifier,
+	     superblock->file_system_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 header->media_size,
+	 (uint64_t) media_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_blocks,
+	 superblock->number_of_blocks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_inodes,
+	 superblock->number_of_inodes );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_free_inodes,
+	 superblock->number_of_free_inodes );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_free_data_blocks,
+	 superblock->number_of_free_data_blocks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_inode_chunks,
+	 (uint64_t) number_of_inode_chunks );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_directory_entries,
+	 (uint64_t) number_of_directory_entries );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->number_of_hash_slots,
+	 (uint64_t) number_of_hash_slots );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->string_heap_size,
+	 (uint64_t) metadata_table->string_heap_size );
+
+	if( number_of_inode_chunks > 0 )
+	{
+		if( memory_copy(
+		     &( sidecar_index->data[ sizeof( fsxfs_sidecar_index_header_t ) ] ),
+		     inode_chunks_data,
+		     number_of_inode_chunks * sizeof( fsxfs_sidecar_index_inode_chunk_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inode chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = directory_entries_offset;
+
+	for( row_index = 1;
+	     row_index < metadata_table->number_of_rows;
+	     row_index++ )
+	{
+		row = &( metadata_table->rows[ row_index ] );
+
+		if( ( row->name_offset > (uint64_t) metadata_table->string_heap_size )
+		 || ( (uint64_t) row->name_size > ( (uint64_t) metadata_table->string_heap_size - row->name_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid row: %d - name value out of bounds.",
+			 function,
+			 row_index );
+
+			goto on_error;
+		}
+		switch( row->file_mode & 0xf000 )
+		{
+			case LIBFSXFS_FILE_TYPE_REGULAR_FILE:
+				file_type = 1;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_DIRECTORY:
+				file_type = 2;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_CHARACTER_DEVICE:
+				file_type = 3;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_BLOCK_DEVICE:
+				file_type = 4;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_FIFO:
+				file_type = 5;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_SOCKET:
+				file_type = 6;
+				break;
+
+			case LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK:
+				file_type = 7;
+				break;
+
+			default:
+				file_type = 0;
+				break;
+		}
+		index_directory_entry = (fsxfs_sidecar_index_directory_entry_t *) &( sidecar_index->data[ data_offset ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 index_directory_entry->parent_inode_number,
+		 row->parent_inode_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 index_directory_entry->inode_number,
+		 row->inode_number );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 index_directory_entry->name_offset,
+		 row->name_offset );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 index_directory_entry->name_size,
+		 (uint16_t) row->name_size );
+
+		index_directory_entry->file_type = file_type;
+
+		data_offset += sizeof( fsxfs_sidecar_index_directory_entry_t );
+
+		/* Use linear probing to find an unused hash table slot
+		 */
+		hash_slot_index = (size_t) libfsxfs_sidecar_index_calculate_hash(
+		                            row->parent_inode_number,
+		                            &( metadata_table->string_heap[ row->name_offset ] ),
+		                            (size_t) row->name_size );
+
+		hash_slot_index &= number_of_hash_slots - 1;
+
+		do
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( sidecar_index->data[ hash_slots_offset + ( hash_slot_index * 4 ) ] ),
+			 hash_slot_value );
+
+			if( hash_slot_value == 0 )
+			{
+				break;
+			}
+			hash_slot_index = ( hash_slot_index + 1 ) & ( number_of_hash_slots - 1 );
+		}
+		while( hash_slot_value != 0 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( sidecar_index->data[ hash_slots_offset + ( hash_slot_index * 4 ) ] ),
+		 (uint32_t) row_index );
+	}
+	if( metadata_table->string_heap_size > 0 )
+	{
+		if( memory_copy(
+		     &( sidecar_index->data[ string_heap_offset ] ),
+		     metadata_table->string_heap,
+		     metadata_table->string_heap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string heap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( inode_chunks_data != NULL )
+	{
+		memory_free(
+		 inode_chunks_data );
+
+		inode_chunks_data = NULL;
+	}
+	if( libfsxfs_sidecar_index_read_header(
+	     sidecar_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sidecar index header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sidecar_index->data != NULL )
+	{
+		memory_free(
+		 sidecar_index->data );
+
+		sidecar_index->data = NULL;
+	}
+	sidecar_index->data_size = 0;
+
+	if( inode_chunks_data != NULL )
+	{
+		memory_free(
+		 inode_chunks_data );
+	}
+	return( -1 );
+}
+
+/* Determines if the sidecar index matches the volume
+ * The sidecar index is considered stale if the file system identifier, the media size
+ * or the allocation counters of the superblock differ
+ * Returns 1 if the sidecar index matches, 0 if not or -1 on error
+ */
+int libfsxfs_sidecar_index_matches(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libfsxfs_superblock_t *superblock,
+     size64_t media_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_sidecar_index_matches";
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     sidecar_index->file_system_identifier,
+	     superblock->file_system_identifier,
+	     16 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( sidecar_index->media_size != media_size )
+	 || ( sidecar_index->number_of_blocks != superblock->number_of_blocks )
+	 || ( sidecar_index->number_of_inodes != superblock->number_of_inodes )
+	 || ( sidecar_index->number_of_free_inodes != superblock->number_of_free_inodes )
+	 || ( sidecar_index->number_of_free_data_blocks != superblock->number_of_free_data_blocks ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if an inode is an allocated inode of an inode chunk in the sidecar index
+ * Returns 1 if the inode is allocated, 0 if not or -1 on error
+ */
+int libfsxfs_sidecar_index_has_inode(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_inode_chunk_t *inode_chunk = NULL;
+	static char *function                          = "libfsxfs_sidecar_index_has_inode";
+	size_t inode_chunk_index                       = 0;
+	size_t lower_index                             = 0;
+	size_t upper_index                             = 0;
+	uint64_t first_inode_number                    = 0;
+	uint64_t free_inodes_bitmap                    = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sidecar index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Search for the last inode chunk with a first inode number equal or less than the inode number
+	 */
+	upper_index = sidecar_index->number_of_inode_chunks;
+
+	while( lower_index < upper_index )
+	{
+		inode_chunk_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsxfs_sidecar_index_inode_chunk_t *) &( sidecar_index->data[ sidecar_index->inode_chunks_offset + ( inode_chunk_index * sizeof( fsxfs_sidecar_index_inode_chunk_t ) ) ] ) )->first_inode_number,
+		 first_inode_number );
+
+		if( first_inode_number <= inode_number )
+		{
+			lower_index = inode_chunk_index + 1;
+		}
+		else
+		{
+			upper_index = inode_chunk_index;
+		}
+	}
+	if( lower_index == 0 )
+	{
+		return( 0 );
+	}
+	inode_chunk = (fsxfs_sidecar_index_inode_chunk_t *) &( sidecar_index->data[ sidecar_index->inode_chunks_offset + ( ( lower_index - 1 ) * sizeof( fsxfs_sidecar_index_inode_chunk_t ) ) ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 inode_chunk->first_inode_number,
+	 first_inode_number );
+
+	/* An inode chunk consists of 64 inodes
+	 */
+	if( ( inode_number - first_inode_number ) >= 64 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 inode_chunk->free_inodes_bitmap,
+	 free_inodes_bitmap );
+
+	/* A set bit in the free inodes bitmap indicates the inode is free
+	 */
+	if( ( free_inodes_bitmap & ( (uint64_t) 1 << ( inode_number - first_inode_number ) ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory entry for an UTF-8 encoded name in a specific parent directory
+ * Returns 1 if successful, 0 if no such directory entry or -1 on error
+ */
+int libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	fsxfs_sidecar_index_directory_entry_t *index_directory_entry = NULL;
+	static char *function                                        = "libfsxfs_sidecar_index_get_directory_entry_by_utf8_name";
+	size_t hash_slot_index                                       = 0;
+	size_t number_of_probes                                      = 0;
+	uint64_t name_offset                                         = 0;
+	uint64_t value_64bit                                         = 0;
+	uint32_t hash_slot_value                                     = 0;
+	uint16_t name_size                                           = 0;
+
+	if( sidecar_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sidecar_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sidecar index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Directory entry names are stored without an end-of-string character
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > 255 ) )
+	{
+		return( 0 );
+	}
+	hash_slot_index = (size_t) libfsxfs_sidecar_index_calculate_hash(
+	                            parent_inode_number,
+	                            utf8_string,
+	                            utf8_string_length );
+
+	hash_slot_index &= sidecar_index->number_of_hash_slots - 1;
+
+	for( number_of_probes = 0;
+	     number_of_probes < sidecar_index->number_of_hash_slots;
+	     number_of_probes++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( sidecar_index->data[ sidecar_index->hash_slots_offset + ( hash_slot_index * 4 ) ] ),
+		 hash_slot_value );
+
+		if( hash_slot_value == 0 )
+		{
+			break;
+		}
+		if( (size_t) hash_slot_value > sidecar_index->number_of_directory_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash table slot: %" PRIzd " value out of bounds.",
+			 function,
+			 hash_slot_index );
+
+			return( -1 );
+		}
+		index_directory_entry = (fsxfs_sidecar_index_directory_entry_t *) &( sidecar_index->data[ sidecar_index->directory_entries_offset + ( ( hash_slot_value - 1 ) * sizeof( fsxfs_sidecar_index_directory_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 index_directory_entry->parent_inode_number,
+		 value_64bit );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 index_directory_entry->name_size,
+		 name_size );
+
+		if( ( value_64bit == parent_inode_number )
+		 && ( (size_t) name_size == utf8_string_length ) )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 index_directory_entry->name_offset,
+			 name_offset );
+
+			if( ( name_offset > (uint64_t) sidecar_index->string_heap_size )
+			 || ( (uint64_t) name_size > ( (uint64_t) sidecar_index->string_heap_size - name_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid directory entry: %" PRIu32 " - name value out of bounds.",
+				 function,
+				 hash_slot_value - 1 );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     &( sidecar_index->data[ sidecar_index->string_heap_offset + (size_t) name_offset ] ),
+			     utf8_string,
+			     utf8_string_length ) == 0 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 index_directory_entry->inode_number,
+				 directory_entry->inode_number );
+
+				if( memory_copy(
+				     directory_entry->name,
+				     utf8_string,
+				     utf8_string_length ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy name.",
+					 function );
+
+					return( -1 );
+				}
+				directory_entry->name_size = (uint8_t) utf8_string_length;
+				directory_entry->file_type = index_directory_entry->file_type;
+
+				return( 1 );
+			}
+		}
+		hash_slot_index = ( hash_slot_index + 1 ) & ( sidecar_index->number_of_hash_slots - 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,179 @@
+/*
+ * Sidecar index functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_SIDECAR_INDEX_H )
+#define _LIBFSXFS_SIDECAR_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_inode_btree.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_metadata_table.h"
+#include "libfsxfs_superblock.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_sidecar_index libfsxfs_sidecar_index_t;
+
+struct libfsxfs_sidecar_index
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The file system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The number of inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* The number of free inodes
+	 */
+	uint64_t number_of_free_inodes;
+
+	/* The number of free data blocks
+	 */
+	uint64_t number_of_free_data_blocks;
+
+	/* The number of inode chunks
+	 */
+	size_t number_of_inode_chunks;
+
+	/* The number of directory entries
+	 */
+	size_t number_of_directory_entries;
+
+	/* The number of hash table slots
+	 */
+	size_t number_of_hash_slots;
+
+	/* The inode chunks offset
+	 */
+	size_t inode_chunks_offset;
+
+	/* The directory entries offset
+	 */
+	size_t directory_entries_offset;
+
+	/* The hash table offset
+	 */
+	size_t hash_slots_offset;
+
+	/* The string heap offset
+	 */
+	size_t string_heap_offset;
+
+	/* The string heap size
+	 */
+	size_t string_heap_size;
+};
+
+int libfsxfs_sidecar_index_initialize(
+     libfsxfs_sidecar_index_t **sidecar_index,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_free(
+     libfsxfs_sidecar_index_t **sidecar_index,
+     libcerror_error_t **error );
+
+uint32_t libfsxfs_sidecar_index_calculate_hash(
+          uint64_t parent_inode_number,
+          const uint8_t *name,
+          size_t name_size );
+
+int libfsxfs_sidecar_index_read_header(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_read_file_io_handle(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_write_file_io_handle(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_read_inode_chunks(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     uint8_t **inode_chunks_data,
+     size_t *number_of_inode_chunks,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_build(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_superblock_t *superblock,
+     size64_t media_size,
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_metadata_table_t *metadata_table,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_matches(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     libfsxfs_superblock_t *superblock,
+     size64_t media_size,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_has_inode(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+     libfsxfs_sidecar_index_t *sidecar_index,
+     uint64_t parent_inode_number,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_SIDECAR_INDEX_H ) */
+
@@ -0,0 +1,573 @@
+/*
+ * Space map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_space_map.h"
+
+/* Creates a space map
+ * Make sure the value space_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_initialize(
+     libfsxfs_space_map_t **space_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_map_initialize";
+
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *space_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid space map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*space_map = memory_allocate_structure(
+	              libfsxfs_space_map_t );
+
+	if( *space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create space map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *space_map,
+	     0,
+	     sizeof( libfsxfs_space_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear space map.",
+		 function );
+
+		memory_free(
+		 *space_map );
+
+		*space_map = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *space_map != NULL )
+	{
+		memory_free(
+		 *space_map );
+
+		*space_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a space map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_free(
+     libfsxfs_space_map_t **space_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_map_free";
+
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *space_map != NULL )
+	{
+		if( ( *space_map )->allocated_extents != NULL )
+		{
+			memory_free(
+			 ( *space_map )->allocated_extents );
+		}
+		if( ( *space_map )->free_extents != NULL )
+		{
+			memory_free(
+			 ( *space_map )->free_extents );
+		}
+		memory_free(
+		 *space_map );
+
+		*space_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent to an array of extents
+ * The extent is merged with the last extent if they are adjacent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_append_extent(
+     libfsxfs_space_map_extent_t **extents,
+     int *number_of_extents,
+     int *maximum_number_of_extents,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_map_extent_t *last_extent  = NULL;
+	libfsxfs_space_map_extent_t *safe_extents = NULL;
+	static char *function                     = "libfsxfs_space_map_append_extent";
+	int safe_maximum_number_of_extents        = 0;
+
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_extents > 0 )
+	{
+		last_extent = &( ( *extents )[ *number_of_extents - 1 ] );
+
+		if( offset < (off64_t) ( last_extent->offset + last_extent->size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset == (off64_t) ( last_extent->offset + last_extent->size ) )
+		{
+			last_extent->size += size;
+
+			return( 1 );
+		}
+	}
+	if( *number_of_extents >= *maximum_number_of_extents )
+	{
+		if( *maximum_number_of_extents == 0 )
+		{
+			safe_maximum_number_of_extents = LIBFSXFS_SPACE_MAP_INITIAL_NUMBER_OF_EXTENTS;
+		}
+		else
+		{
+			safe_maximum_number_of_extents = *maximum_number_of_extents * 2;
+		}
+		if( ( safe_maximum_number_of_extents <= *maximum_number_of_extents )
+		 || ( (size_t) safe_maximum_number_of_extents > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_space_map_extent_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_extents = (libfsxfs_space_map_extent_t *) memory_reallocate(
+		                                                *extents,
+		                                                sizeof( libfsxfs_space_map_extent_t ) * safe_maximum_number_of_extents );
+
+		if( safe_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		*extents                   = safe_extents;
+		*maximum_number_of_extents = safe_maximum_number_of_extents;
+	}
+	( *extents )[ *number_of_extents ].offset = offset;
+	( *extents )[ *number_of_extents ].size   = size;
+
+	*number_of_extents += 1;
+
+	return( 1 );
+}
+
+/* Appends a free extent to the space map
+ * The space between the end of the mapped space and the free extent is mapped as allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_append_free_extent(
+     libfsxfs_space_map_t *space_map,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_map_append_free_extent";
+
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_map_extend(
+	     space_map,
+	     offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to extend space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_map_append_extent(
+	     &( space_map->free_extents ),
+	     &( space_map->number_of_free_extents ),
+	     &( space_map->maximum_number_of_free_extents ),
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append free extent.",
+		 function );
+
+		return( -1 );
+	}
+	space_map->end_offset = offset + (off64_t) size;
+
+	return( 1 );
+}
+
+/* Extends the space map up to the end offset
+ * The space between the end of the mapped space and the end offset is mapped as allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_extend(
+     libfsxfs_space_map_t *space_map,
+     off64_t end_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_map_extend";
+
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_offset < space_map->end_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_offset > space_map->end_offset )
+	{
+		if( libfsxfs_space_map_append_extent(
+		     &( space_map->allocated_extents ),
+		     &( space_map->number_of_allocated_extents ),
+		     &( space_map->maximum_number_of_allocated_extents ),
+		     space_map->end_offset,
+		     (size64_t) ( end_offset - space_map->end_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append allocated extent.",
+			 function );
+
+			return( -1 );
+		}
+		space_map->end_offset = end_offset;
+	}
+	return( 1 );
+}
+
+/* Retrieves the allocation bitmap of a range of blocks
+ * The bitmap contains a bit per block, where a set bit indicates the block is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_map_get_allocation_bitmap(
+     libfsxfs_space_map_t *space_map,
+     off64_t offset,
+     uint64_t number_of_blocks,
+     uint32_t block_size,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_map_extent_t *free_extent = NULL;
+	static char *function                    = "libfsxfs_space_map_get_allocation_bitmap";
+	off64_t end_offset                       = 0;
+	off64_t extent_end_offset                = 0;
+	off64_t extent_offset                    = 0;
+	uint64_t block_index                     = 0;
+	uint64_t first_block_index               = 0;
+	uint64_t last_block_index                = 0;
+	int extent_index                         = 0;
+	int lower_index                          = 0;
+	int upper_index                          = 0;
+
+	if( space_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space map.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks > (uint64_t) ( ( INT64_MAX - offset ) / block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bitmap == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bitmap_size > (size_t) SSIZE_MAX )
+	 || ( (uint64_t) bitmap_size < ( ( number_of_blocks + 7 ) / 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bitmap size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bitmap,
+	     0,
+	     bitmap_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		bitmap[ block_index / 8 ] |= (uint8_t) ( 1 << ( block_index % 8 ) );
+	}
+	end_offset = offset + (off64_t) ( number_of_blocks * block_size );
+
+	/* Search for the first free extent that ends after the offset
+	 */
+	upper_index = space_map->number_of_free_extents;
+
+	while( lower_index < upper_index )
+	{
+		extent_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		free_extent = &( space_map->free_extents[ extent_index ] );
+
+		if( (off64_t) ( free_extent->offset + free_extent->size ) <= offset )
+		{
+			lower_index = extent_index + 1;
+		}
+		else
+		{
+			upper_index = extent_index;
+		}
+	}
+	for( extent_index = lower_index;
+	     extent_index < space_map->number_of_free_extents;
+	     extent_index++ )
+	{
+		free_extent = &( space_map->free_extents[ extent_index ] );
+
+		if( free_extent->offset >= end_offset )
+		{
+			break;
+		}
+		extent_offset     = free_extent->offset;
+		extent_end_offset = free_extent->offset + (off64_t) free_extent->size;
+
+		if( extent_offset < offset )
+		{
+			extent_offset = offset;
+		}
+		if( extent_end_offset > end_offset )
+		{
+			extent_end_offset = end_offset;
+		}
+		first_block_index = (uint64_t) ( extent_offset - offset ) / block_size;
+		last_block_index  = (uint64_t) ( extent_end_offset - offset ) / block_size;
+
+		for( block_index = first_block_index;
+		     block_index < last_block_index;
+		     block_index++ )
+		{
+			bitmap[ block_index / 8 ] &= (uint8_t) ~( 1 << ( block_index % 8 ) );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Space map functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_SPACE_MAP_H )
+#define _LIBFSXFS_SPACE_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_space_map_extent libfsxfs_space_map_extent_t;
+
+struct libfsxfs_space_map_extent
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+typedef struct libfsxfs_space_map libfsxfs_space_map_t;
+
+struct libfsxfs_space_map
+{
+	/* The free extents
+	 */
+	libfsxfs_space_map_extent_t *free_extents;
+
+	/* The number of free extents
+	 */
+	int number_of_free_extents;
+
+	/* The maximum number of free extents
+	 */
+	int maximum_number_of_free_extents;
+
+	/* The allocated extents
+	 */
+	libfsxfs_space_map_extent_t *allocated_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+
+	/* The maximum number of allocated extents
+	 */
+	int maximum_number_of_allocated_extents;
+
+	/* The end offset of the mapped space
+	 */
+	off64_t end_offset;
+};
+
+int libfsxfs_space_map_initialize(
+     libfsxfs_space_map_t **space_map,
+     libcerror_error_t **error );
+
+int libfsxfs_space_map_free(
+     libfsxfs_space_map_t **space_map,
+     libcerror_error_t **error );
+
+int libfsxfs_space_map_append_extent(
+     libfsxfs_space_map_extent_t **extents,
+     int *number_of_extents,
+     int *maximum_number_of_extents,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfsxfs_space_map_append_free_extent(
+     libfsxfs_space_map_t *space_map,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfsxfs_space_map_extend(
+     libfsxfs_space_map_t *space_map,
+     off64_t end_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_space_map_get_allocation_bitmap(
+     libfsxfs_space_map_t *space_map,
+     off64_t offset,
+     uint64_t number_of_blocks,
+     uint32_t block_size,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_SPACE_MAP_H ) */
+
@@ -0,0 +1,1435 @@
+/*
+ * Space usage functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_io_engine.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_space_usage.h"
+
+/* Creates space usage
+ * Make sure the value space_usage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_initialize(
+     libfsxfs_space_usage_t **space_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_usage_initialize";
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *space_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid space usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*space_usage = memory_allocate_structure(
+	                libfsxfs_space_usage_t );
+
+	if( *space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create space usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *space_usage,
+	     0,
+	     sizeof( libfsxfs_space_usage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear space usage.",
+		 function );
+
+		memory_free(
+		 *space_usage );
+
+		*space_usage = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *space_usage != NULL )
+	{
+		memory_free(
+		 *space_usage );
+
+		*space_usage = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees space usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_free(
+     libfsxfs_space_usage_t **space_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_usage_free";
+	int usage_type_index  = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *space_usage != NULL )
+	{
+		for( usage_type_index = 0;
+		     usage_type_index < LIBFSXFS_NUMBER_OF_SPACE_USAGE_TYPES;
+		     usage_type_index++ )
+		{
+			if( ( *space_usage )->entries[ usage_type_index ] != NULL )
+			{
+				memory_free(
+				 ( *space_usage )->entries[ usage_type_index ] );
+			}
+		}
+		memory_free(
+		 *space_usage );
+
+		*space_usage = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the size bucket of a specific size
+ * Size bucket 0 contains empty files, size bucket N sizes in the range [ 2^(N-1), 2^N )
+ * Returns the size bucket
+ */
+uint32_t libfsxfs_space_usage_get_size_bucket(
+          uint64_t size )
+{
+	uint32_t size_bucket = 0;
+
+	while( size != 0 )
+	{
+		size >>= 1;
+
+		size_bucket++;
+	}
+	return( size_bucket );
+}
+
+/* Adds a value to the entry with a specific key
+ * The entry is inserted in key order if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_add_value(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     uint32_t key,
+     uint64_t number_of_inodes,
+     uint64_t number_of_blocks,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_usage_entry_t *entries      = NULL;
+	libfsxfs_space_usage_entry_t *safe_entries = NULL;
+	static char *function                      = "libfsxfs_space_usage_add_value";
+	int entry_index                            = 0;
+	int maximum_entry_index                    = 0;
+	int minimum_entry_index                    = 0;
+	int move_entry_index                       = 0;
+	int safe_maximum_number_of_entries         = 0;
+	int usage_type_index                       = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFSXFS_SPACE_USAGE_TYPE_OWNER )
+	 || ( usage_type > LIBFSXFS_SPACE_USAGE_TYPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type.",
+		 function );
+
+		return( -1 );
+	}
+	usage_type_index = usage_type - 1;
+
+	entries             = space_usage->entries[ usage_type_index ];
+	maximum_entry_index = space_usage->number_of_entries[ usage_type_index ];
+
+	/* Binary search for the first entry with a key equal or greater than the key
+	 */
+	while( minimum_entry_index < maximum_entry_index )
+	{
+		entry_index = minimum_entry_index + ( ( maximum_entry_index - minimum_entry_index ) / 2 );
+
+		if( entries[ entry_index ].key < key )
+		{
+			minimum_entry_index = entry_index + 1;
+		}
+		else
+		{
+			maximum_entry_index = entry_index;
+		}
+	}
+	entry_index = minimum_entry_index;
+
+	if( ( entry_index < space_usage->number_of_entries[ usage_type_index ] )
+	 && ( entries[ entry_index ].key == key ) )
+	{
+		entries[ entry_index ].number_of_inodes += number_of_inodes;
+		entries[ entry_index ].number_of_blocks += number_of_blocks;
+
+		return( 1 );
+	}
+	if( space_usage->number_of_entries[ usage_type_index ] >= space_usage->maximum_number_of_entries[ usage_type_index ] )
+	{
+		if( space_usage->maximum_number_of_entries[ usage_type_index ] == 0 )
+		{
+			safe_maximum_number_of_entries = LIBFSXFS_SPACE_USAGE_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			safe_maximum_number_of_entries = space_usage->maximum_number_of_entries[ usage_type_index ] * 2;
+		}
+		if( ( safe_maximum_number_of_entries <= space_usage->maximum_number_of_entries[ usage_type_index ] )
+		 || ( (size_t) safe_maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsxfs_space_usage_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_entries = (libfsxfs_space_usage_entry_t *) memory_reallocate(
+		                                                 entries,
+		                                                 sizeof( libfsxfs_space_usage_entry_t ) * safe_maximum_number_of_entries );
+
+		if( safe_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		entries = safe_entries;
+
+		space_usage->entries[ usage_type_index ]                   = safe_entries;
+		space_usage->maximum_number_of_entries[ usage_type_index ] = safe_maximum_number_of_entries;
+	}
+	/* Move the entries with a greater key one position up
+	 */
+	for( move_entry_index = space_usage->number_of_entries[ usage_type_index ];
+	     move_entry_index > entry_index;
+	     move_entry_index-- )
+	{
+		entries[ move_entry_index ] = entries[ move_entry_index - 1 ];
+	}
+	entries[ entry_index ].key              = key;
+	entries[ entry_index ].number_of_inodes = number_of_inodes;
+	entries[ entry_index ].number_of_blocks = number_of_blocks;
+
+	space_usage->number_of_entries[ usage_type_index ] += 1;
+
+	return( 1 );
+}
+
+/* Adds the allocated blocks of an inode
+ * The number of blocks is determined from the data extents, not the size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_add_inode(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent = NULL;
+	static char *function     = "libfsxfs_space_usage_add_inode";
+	uint64_t number_of_blocks = 0;
+	int extent_index          = 0;
+	int number_of_extents     = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* Inodes with inline data have no extents
+	 */
+	if( inode->data_extents_array != NULL )
+	{
+		if( libfsxfs_inode_get_number_of_extents(
+		     inode,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of extents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsxfs_inode_get_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( ( extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+		{
+			number_of_blocks += extent->number_of_blocks;
+		}
+	}
+	if( libfsxfs_space_usage_add_value(
+	     space_usage,
+	     LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	     inode->owner_identifier,
+	     1,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add owner usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_usage_add_value(
+	     space_usage,
+	     LIBFSXFS_SPACE_USAGE_TYPE_GROUP,
+	     inode->group_identifier,
+	     1,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add group usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_usage_add_value(
+	     space_usage,
+	     LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	     (uint32_t) ( inode->file_mode & 0xf000 ),
+	     1,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add file type usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_usage_add_value(
+	     space_usage,
+	     LIBFSXFS_SPACE_USAGE_TYPE_SIZE,
+	     libfsxfs_space_usage_get_size_bucket(
+	      inode->size ),
+	     1,
+	     number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add size usage.",
+		 function );
+
+		return( -1 );
+	}
+	space_usage->number_of_inodes += 1;
+	space_usage->number_of_blocks += number_of_blocks;
+
+	return( 1 );
+}
+
+/* Merges the entries of source space usage into space usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_merge(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_space_usage_t *source_space_usage,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_usage_entry_t *entry = NULL;
+	static char *function               = "libfsxfs_space_usage_merge";
+	int entry_index                     = 0;
+	int usage_type_index                = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source space usage.",
+		 function );
+
+		return( -1 );
+	}
+	for( usage_type_index = 0;
+	     usage_type_index < LIBFSXFS_NUMBER_OF_SPACE_USAGE_TYPES;
+	     usage_type_index++ )
+	{
+		for( entry_index = 0;
+		     entry_index < source_space_usage->number_of_entries[ usage_type_index ];
+		     entry_index++ )
+		{
+			entry = &( source_space_usage->entries[ usage_type_index ][ entry_index ] );
+
+			if( libfsxfs_space_usage_add_value(
+			     space_usage,
+			     usage_type_index + 1,
+			     entry->key,
+			     entry->number_of_inodes,
+			     entry->number_of_blocks,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	space_usage->number_of_inodes += source_space_usage->number_of_inodes;
+	space_usage->number_of_blocks += source_space_usage->number_of_blocks;
+
+	return( 1 );
+}
+
+/* Reads the space usage of the allocated inodes of a specific inode chunk
+ * If chunk data is provided the inodes are decoded from the data of the chunk,
+ * otherwise every allocated inode is read individually
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_read_inode_chunk(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     uint64_t read_start_timestamp,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode         = NULL;
+	static char *function           = "libfsxfs_space_usage_read_inode_chunk";
+	off64_t allocation_group_offset = 0;
+	off64_t file_offset             = 0;
+	uint64_t inode_number           = 0;
+	uint64_t relative_inode_number  = 0;
+	uint8_t inode_index             = 0;
+	int result                      = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_btree_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_data != NULL )
+	 && ( chunk_data_size < ( (size_t) 64 * io_handle->inode_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_offset = (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size;
+
+	/* An inode chunk consists of 64 inodes, where a set bit indicates a free inode
+	 */
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( ( inode_btree_record->chunk_allocation_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 )
+		{
+			continue;
+		}
+		relative_inode_number = (uint64_t) inode_btree_record->inode_number + inode_index;
+
+		inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+		             | relative_inode_number;
+
+		/* The inode is read directly since its location follows from the inode number
+		 */
+		file_offset = allocation_group_offset + ( (off64_t) relative_inode_number * io_handle->inode_size );
+
+		if( libfsxfs_inode_initialize(
+		     &inode,
+		     io_handle->inode_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( chunk_data != NULL )
+		{
+			result = libfsxfs_inode_read_buffer(
+			          inode,
+			          io_handle,
+			          file_io_handle,
+			          &( chunk_data[ (size_t) inode_index * io_handle->inode_size ] ),
+			          (size_t) io_handle->inode_size,
+			          file_offset,
+			          inode_number,
+			          read_start_timestamp,
+			          error );
+		}
+		else
+		{
+			result = libfsxfs_inode_read_file_io_handle(
+			          inode,
+			          io_handle,
+			          file_io_handle,
+			          file_offset,
+			          inode_number,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 inode_number,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libfsxfs_space_usage_add_inode(
+		     space_usage,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the space usage of the allocated inodes of a specific allocation group
+ * The allocated inodes are determined from the inode B+ tree of the allocation group
+ * Every inode is read once, hence the blocks of hard linked files are only counted once
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_read_allocation_group(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_btree_record_t *batch_records[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+	libfsxfs_io_request_t requests[ LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS ];
+
+	libcdata_array_t *records_array                   = NULL;
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	uint8_t *chunk_data                               = NULL;
+	uint8_t *chunks_data                              = NULL;
+	static char *function                             = "libfsxfs_space_usage_read_allocation_group";
+	off64_t allocation_group_offset                   = 0;
+	size_t chunk_data_size                            = 0;
+	uint64_t read_start_timestamp                     = 0;
+	int batch_record_index                            = 0;
+	int maximum_number_of_batch_records               = 1;
+	int number_of_batch_records                       = 0;
+	int number_of_records                             = 0;
+	int record_index                                  = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &records_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_btree_get_records(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     (int) allocation_group_index,
+	     records_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode B+ tree records of allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     records_array,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	allocation_group_offset = (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size;
+	chunk_data_size         = (size_t) 64 * io_handle->inode_size;
+
+	/* With an IO engine the inode chunks are read in batches, where every chunk
+	 * is read as a whole instead of per inode
+	 */
+	if( ( io_handle->io_engine != NULL )
+	 && ( number_of_records > 0 ) )
+	{
+		maximum_number_of_batch_records = number_of_records;
+
+		if( maximum_number_of_batch_records > LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS )
+		{
+			maximum_number_of_batch_records = LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_REQUESTS;
+		}
+		chunks_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * chunk_data_size * maximum_number_of_batch_records );
+
+		if( chunks_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inode chunks data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index += number_of_batch_records )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_batch_records = number_of_records - record_index;
+
+		if( number_of_batch_records > maximum_number_of_batch_records )
+		{
+			number_of_batch_records = maximum_number_of_batch_records;
+		}
+		for( batch_record_index = 0;
+		     batch_record_index < number_of_batch_records;
+		     batch_record_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     records_array,
+			     record_index + batch_record_index,
+			     (intptr_t **) &inode_btree_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record: %d.",
+				 function,
+				 record_index + batch_record_index );
+
+				goto on_error;
+			}
+			if( inode_btree_record == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing record: %d.",
+				 function,
+				 record_index + batch_record_index );
+
+				goto on_error;
+			}
+			if( chunks_data != NULL )
+			{
+				requests[ batch_record_index ].offset    = allocation_group_offset + ( (off64_t) inode_btree_record->inode_number * io_handle->inode_size );
+				requests[ batch_record_index ].data      = &( chunks_data[ (size_t) batch_record_index * chunk_data_size ] );
+				requests[ batch_record_index ].data_size = chunk_data_size;
+			}
+			batch_records[ batch_record_index ] = inode_btree_record;
+		}
+		read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+		                       io_handle );
+
+		if( chunks_data != NULL )
+		{
+			if( libfsxfs_io_engine_read_requests(
+			     io_handle->io_engine,
+			     file_io_handle,
+			     requests,
+			     number_of_batch_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunks.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( batch_record_index = 0;
+		     batch_record_index < number_of_batch_records;
+		     batch_record_index++ )
+		{
+			chunk_data = NULL;
+
+			if( chunks_data != NULL )
+			{
+				if( requests[ batch_record_index ].read_count != (ssize_t) chunk_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read inode chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 requests[ batch_record_index ].offset,
+					 requests[ batch_record_index ].offset );
+
+					goto on_error;
+				}
+				chunk_data = requests[ batch_record_index ].data;
+			}
+			if( libfsxfs_space_usage_read_inode_chunk(
+			     space_usage,
+			     io_handle,
+			     file_io_handle,
+			     allocation_group_index,
+			     batch_records[ batch_record_index ],
+			     chunk_data,
+			     chunk_data_size,
+			     read_start_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunk of record: %d.",
+				 function,
+				 record_index + batch_record_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( chunks_data != NULL )
+	{
+		memory_free(
+		 chunks_data );
+
+		chunks_data = NULL;
+	}
+	if( libcdata_array_free(
+	     &records_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free records array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( chunks_data != NULL )
+	{
+		memory_free(
+		 chunks_data );
+	}
+	if( records_array != NULL )
+	{
+		libcdata_array_free(
+		 &records_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_btree_record_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the space usage of the allocation group of a worker
+ * Callback function for the worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_worker_callback(
+     libfsxfs_space_usage_worker_t *worker )
+{
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = libfsxfs_space_usage_read_allocation_group(
+	                  worker->space_usage,
+	                  worker->io_handle,
+	                  worker->file_io_handle,
+	                  worker->file_system,
+	                  worker->allocation_group_index,
+	                  &( worker->error ) );
+
+	return( worker->result );
+}
+
+/* Reads the space usage of all the allocated inodes of the file system
+ * Every allocation group is read by a separate worker, when multi-threading
+ * is supported, into a separate space usage that is merged afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_read_file_system(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_usage_worker_t workers[ LIBFSXFS_SPACE_USAGE_MAXIMUM_NUMBER_OF_WORKERS ];
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LIBFSXFS_SPACE_USAGE_MAXIMUM_NUMBER_OF_WORKERS ];
+#endif
+
+	static char *function           = "libfsxfs_space_usage_read_file_system";
+	uint32_t allocation_group_index = 0;
+	int number_of_workers           = 0;
+	int result                      = 1;
+	int worker_index                = 0;
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     workers,
+	     0,
+	     sizeof( libfsxfs_space_usage_worker_t ) * LIBFSXFS_SPACE_USAGE_MAXIMUM_NUMBER_OF_WORKERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * LIBFSXFS_SPACE_USAGE_MAXIMUM_NUMBER_OF_WORKERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The allocation groups are read in batches of at most the maximum number of workers
+	 */
+	while( ( result == 1 )
+	    && ( allocation_group_index < number_of_allocation_groups ) )
+	{
+		number_of_workers = 0;
+
+		while( ( number_of_workers < LIBFSXFS_SPACE_USAGE_MAXIMUM_NUMBER_OF_WORKERS )
+		    && ( allocation_group_index < number_of_allocation_groups ) )
+		{
+			workers[ number_of_workers ].io_handle              = io_handle;
+			workers[ number_of_workers ].file_io_handle         = file_io_handle;
+			workers[ number_of_workers ].file_system            = file_system;
+			workers[ number_of_workers ].allocation_group_index = allocation_group_index;
+			workers[ number_of_workers ].result                 = -1;
+
+			if( libfsxfs_space_usage_initialize(
+			     &( workers[ number_of_workers ].space_usage ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create space usage of allocation group: %" PRIu32 ".",
+				 function,
+				 allocation_group_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_workers++;
+			allocation_group_index++;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( result != 1 )
+			{
+				break;
+			}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			if( libcthreads_thread_create(
+			     &( threads[ worker_index ] ),
+			     NULL,
+			     (int (*)(void *)) &libfsxfs_space_usage_worker_callback,
+			     (void *) &( workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+#else
+			libfsxfs_space_usage_worker_callback(
+			 &( workers[ worker_index ] ) );
+#endif
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( threads[ worker_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( threads[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+#endif
+		/* The space usage of the workers is merged in allocation group order
+		 */
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( ( result == 1 )
+			 && ( workers[ worker_index ].result != 1 ) )
+			{
+				/* Pass on the error of the worker
+				 */
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = workers[ worker_index ].error;
+
+					workers[ worker_index ].error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read space usage of allocation group: %" PRIu32 ".",
+				 function,
+				 workers[ worker_index ].allocation_group_index );
+
+				result = -1;
+			}
+			if( result == 1 )
+			{
+				if( libfsxfs_space_usage_merge(
+				     space_usage,
+				     workers[ worker_index ].space_usage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to merge space usage of allocation group: %" PRIu32 ".",
+					 function,
+					 workers[ worker_index ].allocation_group_index );
+
+					result = -1;
+				}
+			}
+			if( workers[ worker_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( workers[ worker_index ].error ) );
+			}
+			if( workers[ worker_index ].space_usage != NULL )
+			{
+				libfsxfs_space_usage_free(
+				 &( workers[ worker_index ].space_usage ),
+				 NULL );
+			}
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of entries of a specific space usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_get_number_of_entries(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_space_usage_get_number_of_entries";
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFSXFS_SPACE_USAGE_TYPE_OWNER )
+	 || ( usage_type > LIBFSXFS_SPACE_USAGE_TYPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = space_usage->number_of_entries[ usage_type - 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry of a specific space usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_space_usage_get_entry_by_index(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     int entry_index,
+     uint32_t *key,
+     uint64_t *number_of_inodes,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libfsxfs_space_usage_entry_t *entry = NULL;
+	static char *function               = "libfsxfs_space_usage_get_entry_by_index";
+
+	if( space_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid space usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFSXFS_SPACE_USAGE_TYPE_OWNER )
+	 || ( usage_type > LIBFSXFS_SPACE_USAGE_TYPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= space_usage->number_of_entries[ usage_type - 1 ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( space_usage->entries[ usage_type - 1 ][ entry_index ] );
+
+	*key              = entry->key;
+	*number_of_inodes = entry->number_of_inodes;
+	*number_of_blocks = entry->number_of_blocks;
+
+	return( 1 );
+}
+
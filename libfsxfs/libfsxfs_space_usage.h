@@ -0,0 +1,195 @@
+/*
+ * Space usage functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_SPACE_USAGE_H )
+#define _LIBFSXFS_SPACE_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_space_usage_entry libfsxfs_space_usage_entry_t;
+
+struct libfsxfs_space_usage_entry
+{
+	/* The key
+	 * Contains the owner identifier, group identifier, file type or size bucket
+	 */
+	uint32_t key;
+
+	/* The number of inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* The number of allocated blocks
+	 */
+	uint64_t number_of_blocks;
+};
+
+typedef struct libfsxfs_space_usage libfsxfs_space_usage_t;
+
+struct libfsxfs_space_usage
+{
+	/* The entries per space usage type, sorted by key
+	 */
+	libfsxfs_space_usage_entry_t *entries[ LIBFSXFS_NUMBER_OF_SPACE_USAGE_TYPES ];
+
+	/* The number of entries per space usage type
+	 */
+	int number_of_entries[ LIBFSXFS_NUMBER_OF_SPACE_USAGE_TYPES ];
+
+	/* The maximum number of entries per space usage type
+	 */
+	int maximum_number_of_entries[ LIBFSXFS_NUMBER_OF_SPACE_USAGE_TYPES ];
+
+	/* The total number of inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* The total number of allocated blocks
+	 */
+	uint64_t number_of_blocks;
+};
+
+typedef struct libfsxfs_space_usage_worker libfsxfs_space_usage_worker_t;
+
+struct libfsxfs_space_usage_worker
+{
+	/* The space usage of the allocation group
+	 */
+	libfsxfs_space_usage_t *space_usage;
+
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file system
+	 */
+	libfsxfs_file_system_t *file_system;
+
+	/* The allocation group index
+	 */
+	uint32_t allocation_group_index;
+
+	/* The result of the worker
+	 */
+	int result;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+};
+
+int libfsxfs_space_usage_initialize(
+     libfsxfs_space_usage_t **space_usage,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_free(
+     libfsxfs_space_usage_t **space_usage,
+     libcerror_error_t **error );
+
+uint32_t libfsxfs_space_usage_get_size_bucket(
+          uint64_t size );
+
+int libfsxfs_space_usage_add_value(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     uint32_t key,
+     uint64_t number_of_inodes,
+     uint64_t number_of_blocks,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_add_inode(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_merge(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_space_usage_t *source_space_usage,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_read_inode_chunk(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     uint64_t read_start_timestamp,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_read_allocation_group(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_worker_callback(
+     libfsxfs_space_usage_worker_t *worker );
+
+int libfsxfs_space_usage_read_file_system(
+     libfsxfs_space_usage_t *space_usage,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_get_number_of_entries(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfsxfs_space_usage_get_entry_by_index(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     int entry_index,
+     uint32_t *key,
+     uint64_t *number_of_inodes,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_SPACE_USAGE_H ) */
+
@@ -0,0 +1,123 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_STATISTICS_H )
+#define _LIBFSXFS_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_statistics libfsxfs_statistics_t;
+
+struct libfsxfs_statistics
+{
+	/* The number of reads per read category
+	 */
+	uint64_t number_of_reads[ LIBFSXFS_NUMBER_OF_READ_CATEGORIES ];
+
+	/* The number of bytes read per read category
+	 */
+	uint64_t number_of_bytes_read[ LIBFSXFS_NUMBER_OF_READ_CATEGORIES ];
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The time spent reading, in nano seconds
+	 */
+	uint64_t read_time;
+
+	/* The time spent decoding, in nano seconds
+	 */
+	uint64_t decode_time;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfsxfs_statistics_initialize(
+     libfsxfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_free(
+     libfsxfs_statistics_t **statistics,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_clear(
+     libfsxfs_statistics_t *statistics,
+     libcerror_error_t **error );
+
+uint64_t libfsxfs_statistics_get_timestamp(
+          void );
+
+int libfsxfs_statistics_add_read(
+     libfsxfs_statistics_t *statistics,
+     int read_category,
+     size_t read_size,
+     uint64_t read_start_timestamp,
+     uint64_t decode_start_timestamp,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_add_cache_lookup(
+     libfsxfs_statistics_t *statistics,
+     uint8_t is_cache_hit,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_get_read_values(
+     libfsxfs_statistics_t *statistics,
+     int read_category,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_get_cache_values(
+     libfsxfs_statistics_t *statistics,
+     uint64_t *number_of_cache_hits,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error );
+
+int libfsxfs_statistics_get_time_values(
+     libfsxfs_statistics_t *statistics,
+     uint64_t *read_time,
+     uint64_t *decode_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_STATISTICS_H ) */
+
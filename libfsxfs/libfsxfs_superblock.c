@@ -228,6 +228,20 @@ int libfsxfs_superblock_read_data(
 	 ( (fsxfs_superblock_t *) data )->number_of_blocks,
 	 superblock->number_of_blocks );
 
+	if( memory_copy(
+	     superblock->file_system_identifier,
+	     ( (fsxfs_superblock_t *) data )->file_system_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file system identifier.",
+		 function );
+
+		return( -1 );
+	}
 	byte_stream_copy_to_uint64_big_endian(
 	 ( (fsxfs_superblock_t *) data )->journal_block_number,
 	 superblock->journal_block_number );
@@ -281,6 +295,48 @@ int libfsxfs_superblock_read_data(
 	 ( (fsxfs_superblock_t *) data )->secondary_feature_flags,
 	 superblock->secondary_feature_flags );
 
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->number_of_inodes,
+	 superblock->number_of_inodes );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->number_of_free_inodes,
+	 superblock->number_of_free_inodes );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->number_of_free_data_blocks,
+	 superblock->number_of_free_data_blocks );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->user_quota_inode_number,
+	 superblock->user_quota_inode_number );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->group_quota_inode_number,
+	 superblock->group_quota_inode_number );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 ( (fsxfs_superblock_t *) data )->quota_flags,
+	 superblock->quota_flags );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_superblock_t *) data )->raid_unit_size,
+	 superblock->raid_unit_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_superblock_t *) data )->raid_width,
+	 superblock->raid_width );
+
+	/* Version 5 stores project quota separate from group quota
+	 */
+	if( ( superblock->format_version == 5 )
+	 && ( data_size >= sizeof( fsxfs_superblock_v5_t ) ) )
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 ( (fsxfs_superblock_v5_t *) data )->project_quota_inode_number,
+		 superblock->project_quota_inode_number );
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -551,21 +607,15 @@ int libfsxfs_superblock_read_data(
 		 function,
 		 value_32bit );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_superblock_t *) data )->raid_unit_size,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: RAID unit size\t\t\t\t: %" PRIu32 " blocks\n",
 		 function,
-		 value_32bit );
+		 superblock->raid_unit_size );
 
-		byte_stream_copy_to_uint32_big_endian(
-		 ( (fsxfs_superblock_t *) data )->raid_width,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: RAID width\t\t\t\t: %" PRIu32 " blocks\n",
 		 function,
-		 value_32bit );
+		 superblock->raid_width );
 
 		libcnotify_printf(
 		 "%s: directory block size (log2)\t\t: %" PRIu8 " (%" PRIu64 ")\n",
@@ -615,6 +665,17 @@ int libfsxfs_superblock_read_data(
 		 value_32bit );
 		libcnotify_printf(
 		 "\n" );
+
+		if( superblock->format_version == 5 )
+		{
+			libcnotify_printf(
+			 "%s: project quota inode number\t\t: %" PRIu64 "\n",
+			 function,
+			 superblock->project_quota_inode_number );
+
+			libcnotify_printf(
+			 "\n" );
+		}
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -50,6 +50,10 @@ struct libfsxfs_superblock
 	 */
 	uint64_t journal_block_number;
 
+	/* File system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
 	/* Root directory inode number
 	 */
 	uint64_t root_directory_inode_number;
@@ -82,10 +86,46 @@ struct libfsxfs_superblock
 	 */
 	uint32_t directory_block_size;
 
+	/* Number of inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* Number of free inodes
+	 */
+	uint64_t number_of_free_inodes;
+
+	/* Number of free data blocks
+	 */
+	uint64_t number_of_free_data_blocks;
+
 	/* Volume label
 	 */
 	uint8_t volume_label[ 12 ];
 
+	/* User quota inode number
+	 */
+	uint64_t user_quota_inode_number;
+
+	/* Group quota inode number
+	 */
+	uint64_t group_quota_inode_number;
+
+	/* Project quota inode number
+	 */
+	uint64_t project_quota_inode_number;
+
+	/* Quota flags
+	 */
+	uint16_t quota_flags;
+
+	/* RAID unit size in blocks
+	 */
+	uint32_t raid_unit_size;
+
+	/* RAID width in blocks
+	 */
+	uint32_t raid_width;
+
 	/* Secondary feature flags
 	 */
 	uint32_t secondary_feature_flags;
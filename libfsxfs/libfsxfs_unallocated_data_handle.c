@@ -0,0 +1,474 @@
+/*
+ * Unallocated data handle functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libfdata.h"
+#include "libfsxfs_unallocated_data_handle.h"
+#include "libfsxfs_unused.h"
+
+/* Creates an unallocated data handle
+ * Make sure the value data_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unallocated_data_handle_initialize(
+     libfsxfs_unallocated_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unallocated_data_handle_initialize";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->block_size > ( LIBFSXFS_UNALLOCATED_DATA_READ_AHEAD_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data_handle = memory_allocate_structure(
+	                libfsxfs_unallocated_data_handle_t );
+
+	if( *data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data_handle,
+	     0,
+	     sizeof( libfsxfs_unallocated_data_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data handle.",
+		 function );
+
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+
+		return( -1 );
+	}
+	( *data_handle )->read_ahead_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * LIBFSXFS_UNALLOCATED_DATA_READ_AHEAD_SIZE );
+
+	if( ( *data_handle )->read_ahead_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead data.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->io_handle            = io_handle;
+	( *data_handle )->read_ahead_data_size = LIBFSXFS_UNALLOCATED_DATA_READ_AHEAD_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *data_handle != NULL )
+	{
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an unallocated data handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unallocated_data_handle_free(
+     libfsxfs_unallocated_data_handle_t **data_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unallocated_data_handle_free";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_handle != NULL )
+	{
+		/* The io_handle reference is freed elsewhere
+		 */
+		if( ( *data_handle )->read_ahead_data != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->read_ahead_data );
+		}
+		memory_free(
+		 *data_handle );
+
+		*data_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset from the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_unallocated_data_handle_read_at_offset(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function         = "libfsxfs_unallocated_data_handle_read_at_offset";
+	ssize_t read_count            = 0;
+	uint64_t read_start_timestamp = 0;
+
+	read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+	                       data_handle->io_handle );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	/* Unallocated data is not owned by an inode hence the inode number is 0
+	 */
+	if( libfsxfs_io_handle_add_read(
+	     data_handle->io_handle,
+	     LIBFSXFS_READ_CATEGORY_FILE_DATA,
+	     offset,
+	     (size_t) read_count,
+	     0,
+	     read_start_timestamp,
+	     libfsxfs_io_handle_get_timestamp( data_handle->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read to IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads data from the current offset into a buffer
+ * Reads smaller than the read-ahead data are served from a block aligned read-ahead
+ * buffer, which typically also contains the start of the next free extent
+ * Callback for the unallocated data stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_unallocated_data_handle_read_segment_data(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags LIBFSXFS_ATTRIBUTE_UNUSED,
+         uint8_t read_flags LIBFSXFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function         = "libfsxfs_unallocated_data_handle_read_segment_data";
+	size_t read_ahead_data_offset = 0;
+	ssize_t read_count            = 0;
+	off64_t read_ahead_offset     = 0;
+
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_flags )
+	LIBFSXFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->read_ahead_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing read-ahead data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_data_size + data_handle->io_handle->block_size ) > data_handle->read_ahead_data_size )
+	{
+		/* Large reads bypass the read-ahead data
+		 */
+		read_count = libfsxfs_unallocated_data_handle_read_at_offset(
+		              data_handle,
+		              file_io_handle,
+		              segment_data,
+		              segment_data_size,
+		              data_handle->current_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( ( data_handle->current_offset < data_handle->read_ahead_data_offset )
+		 || ( (size64_t) ( data_handle->current_offset + segment_data_size ) > (size64_t) ( data_handle->read_ahead_data_offset + data_handle->read_ahead_data_count ) ) )
+		{
+			read_ahead_offset = data_handle->current_offset - ( data_handle->current_offset % data_handle->io_handle->block_size );
+
+			data_handle->read_ahead_data_offset = read_ahead_offset;
+			data_handle->read_ahead_data_count  = 0;
+
+			read_count = libfsxfs_unallocated_data_handle_read_at_offset(
+			              data_handle,
+			              file_io_handle,
+			              data_handle->read_ahead_data,
+			              data_handle->read_ahead_data_size,
+			              read_ahead_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read read-ahead data.",
+				 function );
+
+				return( -1 );
+			}
+			data_handle->read_ahead_data_count = (size_t) read_count;
+		}
+		read_ahead_data_offset = (size_t) ( data_handle->current_offset - data_handle->read_ahead_data_offset );
+
+		if( read_ahead_data_offset >= data_handle->read_ahead_data_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) ( data_handle->read_ahead_data_count - read_ahead_data_offset );
+
+		if( read_count > (ssize_t) segment_data_size )
+		{
+			read_count = (ssize_t) segment_data_size;
+		}
+		if( memory_copy(
+		     segment_data,
+		     &( data_handle->read_ahead_data[ read_ahead_data_offset ] ),
+		     (size_t) read_count ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	data_handle->current_offset += read_count;
+
+	return( read_count );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the unallocated data stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsxfs_unallocated_data_handle_seek_segment_offset(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSXFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unallocated_data_handle_seek_segment_offset";
+
+	LIBFSXFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSXFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
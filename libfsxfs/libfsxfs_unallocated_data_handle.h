@@ -0,0 +1,107 @@
+/*
+ * Unallocated data handle functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_UNALLOCATED_DATA_HANDLE_H )
+#define _LIBFSXFS_UNALLOCATED_DATA_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_unallocated_data_handle libfsxfs_unallocated_data_handle_t;
+
+struct libfsxfs_unallocated_data_handle
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The read-ahead data
+	 */
+	uint8_t *read_ahead_data;
+
+	/* The read-ahead data size
+	 */
+	size_t read_ahead_data_size;
+
+	/* The offset of the read-ahead data
+	 */
+	off64_t read_ahead_data_offset;
+
+	/* The number of bytes in the read-ahead data
+	 */
+	size_t read_ahead_data_count;
+};
+
+int libfsxfs_unallocated_data_handle_initialize(
+     libfsxfs_unallocated_data_handle_t **data_handle,
+     libfsxfs_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_unallocated_data_handle_free(
+     libfsxfs_unallocated_data_handle_t **data_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_unallocated_data_handle_read_at_offset(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsxfs_unallocated_data_handle_read_segment_data(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfsxfs_unallocated_data_handle_seek_segment_offset(
+         libfsxfs_unallocated_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_UNALLOCATED_DATA_HANDLE_H ) */
+
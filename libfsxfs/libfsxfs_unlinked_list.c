@@ -0,0 +1,682 @@
+/*
+ * Unlinked inode list functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_information.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_unlinked_list.h"
+
+/* Creates an unlinked list
+ * Make sure the value unlinked_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_initialize(
+     libfsxfs_unlinked_list_t **unlinked_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unlinked_list_initialize";
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unlinked_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unlinked list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*unlinked_list = memory_allocate_structure(
+	                  libfsxfs_unlinked_list_t );
+
+	if( *unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unlinked list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *unlinked_list,
+	     0,
+	     sizeof( libfsxfs_unlinked_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear unlinked list.",
+		 function );
+
+		memory_free(
+		 *unlinked_list );
+
+		*unlinked_list = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *unlinked_list != NULL )
+	{
+		memory_free(
+		 *unlinked_list );
+
+		*unlinked_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an unlinked list
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_free(
+     libfsxfs_unlinked_list_t **unlinked_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unlinked_list_free";
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unlinked_list != NULL )
+	{
+		if( ( *unlinked_list )->inode_numbers != NULL )
+		{
+			memory_free(
+			 ( *unlinked_list )->inode_numbers );
+		}
+		memory_free(
+		 *unlinked_list );
+
+		*unlinked_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an unlinked inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_append_inode_number(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	uint64_t *safe_inode_numbers      = NULL;
+	static char *function             = "libfsxfs_unlinked_list_append_inode_number";
+	int safe_maximum_number_of_inodes = 0;
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( unlinked_list->number_of_inodes >= unlinked_list->maximum_number_of_inodes )
+	{
+		if( unlinked_list->maximum_number_of_inodes == 0 )
+		{
+			safe_maximum_number_of_inodes = LIBFSXFS_UNLINKED_LIST_INITIAL_NUMBER_OF_INODES;
+		}
+		else
+		{
+			safe_maximum_number_of_inodes = unlinked_list->maximum_number_of_inodes * 2;
+		}
+		if( ( safe_maximum_number_of_inodes <= unlinked_list->maximum_number_of_inodes )
+		 || ( (size_t) safe_maximum_number_of_inodes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of inodes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_inode_numbers = (uint64_t *) memory_reallocate(
+		                                   unlinked_list->inode_numbers,
+		                                   sizeof( uint64_t ) * safe_maximum_number_of_inodes );
+
+		if( safe_inode_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inode numbers.",
+			 function );
+
+			return( -1 );
+		}
+		unlinked_list->inode_numbers            = safe_inode_numbers;
+		unlinked_list->maximum_number_of_inodes = safe_maximum_number_of_inodes;
+	}
+	unlinked_list->inode_numbers[ unlinked_list->number_of_inodes ] = inode_number;
+
+	unlinked_list->number_of_inodes += 1;
+
+	return( 1 );
+}
+
+/* Reads the chain of unlinked inodes of a specific unlinked hash bucket
+ * The inodes are read directly since their location follows from the inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_read_bucket(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     uint32_t relative_inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode                = NULL;
+	static char *function                  = "libfsxfs_unlinked_list_read_bucket";
+	off64_t allocation_group_offset        = 0;
+	off64_t file_offset                    = 0;
+	uint64_t inode_number                  = 0;
+	uint64_t maximum_relative_inode_number = 0;
+	int first_inode_index                  = 0;
+	int inode_index                        = 0;
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_offset       = (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size;
+	maximum_relative_inode_number = ( (uint64_t) io_handle->allocation_group_size * io_handle->block_size ) / io_handle->inode_size;
+
+	first_inode_index = unlinked_list->number_of_inodes;
+
+	while( relative_inode_number != LIBFSXFS_UNLINKED_LIST_END_OF_CHAIN )
+	{
+		if( (uint64_t) relative_inode_number >= maximum_relative_inode_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid relative inode number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		inode_number = ( (uint64_t) allocation_group_index << io_handle->number_of_relative_inode_number_bits )
+		             | relative_inode_number;
+
+		/* Guard against a corrupted chain that loops back on itself
+		 */
+		for( inode_index = first_inode_index;
+		     inode_index < unlinked_list->number_of_inodes;
+		     inode_index++ )
+		{
+			if( unlinked_list->inode_numbers[ inode_index ] == inode_number )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid unlinked inode: %" PRIu64 " already in chain.",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+		}
+		file_offset = allocation_group_offset + ( (off64_t) relative_inode_number * io_handle->inode_size );
+
+		if( libfsxfs_inode_initialize(
+		     &inode,
+		     io_handle->inode_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_read_file_io_handle(
+		     inode,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 inode_number,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libfsxfs_unlinked_list_append_inode_number(
+		     unlinked_list,
+		     inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append unlinked inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		relative_inode_number = inode->next_unlinked_inode_number;
+
+		if( libfsxfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the unlinked inodes of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_read_allocation_group(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     off64_t inode_information_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_unlinked_list_read_allocation_group";
+	int bucket_index                                = 0;
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_information_initialize(
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_information_read_file_io_handle(
+	     inode_information,
+	     io_handle,
+	     file_io_handle,
+	     inode_information_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode information of allocation group: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 allocation_group_index,
+		 inode_information_offset,
+		 inode_information_offset );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBFSXFS_NUMBER_OF_UNLINKED_BUCKETS;
+	     bucket_index++ )
+	{
+		if( inode_information->unlinked_buckets[ bucket_index ] == LIBFSXFS_UNLINKED_LIST_END_OF_CHAIN )
+		{
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: allocation group: %" PRIu32 " unlinked bucket: %d first inode: %" PRIu32 "\n",
+			 function,
+			 allocation_group_index,
+			 bucket_index,
+			 inode_information->unlinked_buckets[ bucket_index ] );
+		}
+#endif
+		if( libfsxfs_unlinked_list_read_bucket(
+		     unlinked_list,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     inode_information->unlinked_buckets[ bucket_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unlinked bucket: %d of allocation group: %" PRIu32 ".",
+			 function,
+			 bucket_index,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_inode_information_free(
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode_information != NULL )
+	{
+		libfsxfs_inode_information_free(
+		 &inode_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the unlinked inodes of all allocation groups
+ * Only the inode information (AGI) of every allocation group and the unlinked inodes are read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_read_file_system(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     uint16_t sector_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsxfs_unlinked_list_read_file_system";
+	off64_t allocation_group_offset  = 0;
+	off64_t inode_information_offset = 0;
+	uint32_t allocation_group_index  = 0;
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+		allocation_group_offset = (off64_t) allocation_group_index * io_handle->allocation_group_size * io_handle->block_size;
+
+		/* The inode information (AGI) is stored in the third sector of the allocation group
+		 */
+		inode_information_offset = allocation_group_offset + ( 2 * (off64_t) sector_size );
+
+		if( libfsxfs_unlinked_list_read_allocation_group(
+		     unlinked_list,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     inode_information_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unlinked inodes of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of unlinked inodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_get_number_of_inodes(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     int *number_of_inodes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unlinked_list_get_number_of_inodes";
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_inodes = unlinked_list->number_of_inodes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific unlinked inode number
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_unlinked_list_get_inode_number_by_index(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     int inode_index,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_unlinked_list_get_inode_number_by_index";
+
+	if( unlinked_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unlinked list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_index < 0 )
+	 || ( inode_index >= unlinked_list->number_of_inodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_number = unlinked_list->inode_numbers[ inode_index ];
+
+	return( 1 );
+}
+
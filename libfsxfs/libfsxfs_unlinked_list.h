@@ -0,0 +1,107 @@
+/*
+ * Unlinked inode list functions
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_UNLINKED_LIST_H )
+#define _LIBFSXFS_UNLINKED_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_inode_information.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_unlinked_list libfsxfs_unlinked_list_t;
+
+struct libfsxfs_unlinked_list
+{
+	/* The (absolute) inode numbers of the unlinked inodes
+	 */
+	uint64_t *inode_numbers;
+
+	/* The number of unlinked inodes
+	 */
+	int number_of_inodes;
+
+	/* The maximum number of unlinked inodes
+	 */
+	int maximum_number_of_inodes;
+};
+
+int libfsxfs_unlinked_list_initialize(
+     libfsxfs_unlinked_list_t **unlinked_list,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_free(
+     libfsxfs_unlinked_list_t **unlinked_list,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_append_inode_number(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_read_bucket(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     uint32_t relative_inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_read_allocation_group(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     off64_t inode_information_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_read_file_system(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t number_of_allocation_groups,
+     uint16_t sector_size,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_get_number_of_inodes(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     int *number_of_inodes,
+     libcerror_error_t **error );
+
+int libfsxfs_unlinked_list_get_inode_number_by_index(
+     libfsxfs_unlinked_list_t *unlinked_list,
+     int inode_index,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_UNLINKED_LIST_H ) */
+
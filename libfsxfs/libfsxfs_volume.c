@@ -26,18 +26,36 @@
 #include <wide_string.h>
 
 #include "libfsxfs_debug.h"
+#include "libfsxfs_data_stream.h"
 #include "libfsxfs_definitions.h"
+#include "libfsxfs_direct_io_handle.h"
+#include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_file_system.h"
+#include "libfsxfs_free_space_btree.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_allocation_map.h"
+#include "libfsxfs_io_engine.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfdata.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_metadata_table.h"
+#include "libfsxfs_owner_map.h"
+#include "libfsxfs_quota_record.h"
+#include "libfsxfs_quota_usage.h"
+#include "libfsxfs_read_batch.h"
+#include "libfsxfs_read_queue.h"
+#include "libfsxfs_sidecar_index.h"
+#include "libfsxfs_space_map.h"
+#include "libfsxfs_space_usage.h"
+#include "libfsxfs_statistics.h"
 #include "libfsxfs_superblock.h"
+#include "libfsxfs_unlinked_list.h"
 #include "libfsxfs_volume.h"
 
 /* Creates a volume
@@ -223,6 +241,22 @@ int libfsxfs_volume_free(
 
 			result = -1;
 		}
+		if( internal_volume->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_volume->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -281,6 +315,10 @@ int libfsxfs_volume_open(
 	libfsxfs_internal_volume_t *internal_volume = NULL;
 	static char *function                       = "libfsxfs_volume_open";
 
+#if defined( HAVE_LIBFSXFS_DIRECT_IO )
+	libfsxfs_direct_io_handle_t *direct_io_handle = NULL;
+#endif
+
 	if( volume == NULL )
 	{
 		libcerror_error_set(
@@ -328,18 +366,66 @@ int libfsxfs_volume_open(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_DIRECT_IO ) != 0 )
 	{
+#if defined( HAVE_LIBFSXFS_DIRECT_IO )
+		if( libfsxfs_direct_io_file_initialize(
+		     &file_io_handle,
+		     &direct_io_handle,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#else
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO not supported.",
 		 function );
 
 		goto on_error;
+#endif
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     narrow_string_length(
+		      filename ) + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
@@ -357,22 +443,6 @@ int libfsxfs_volume_open(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
-		 function );
-
-		goto on_error;
-	}
 	if( libfsxfs_volume_open_file_io_handle(
 	     volume,
 	     file_io_handle,
@@ -389,6 +459,83 @@ int libfsxfs_volume_open(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSXFS_DIRECT_IO )
+	if( direct_io_handle != NULL )
+	{
+		/* The superblock is read using the default alignment, subsequent reads
+		 * are aligned to the sector size of the file system
+		 */
+		if( libfsxfs_direct_io_handle_set_sector_size(
+		     direct_io_handle,
+		     (uint32_t) internal_volume->superblock->sector_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sector size in direct IO handle.",
+			 function );
+
+			libfsxfs_volume_close(
+			 volume,
+			 NULL );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( internal_volume->number_of_io_engine_workers > 0 )
+	{
+		/* The IO engine is only used with a file IO handle created by the library
+		 * since its workers read using clones of the file IO handle
+		 */
+		if( libfsxfs_io_engine_initialize(
+		     &( internal_volume->io_handle->io_engine ),
+		     file_io_handle,
+		     internal_volume->number_of_io_engine_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO engine.",
+			 function );
+
+			libfsxfs_volume_close(
+			 volume,
+			 NULL );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFSXFS_IO_URING )
+		/* The direct IO handle is read using io_uring if supported by the kernel,
+		 * otherwise the IO engine falls back to its workers
+		 */
+		if( direct_io_handle != NULL )
+		{
+			if( libfsxfs_io_engine_set_direct_io_handle(
+			     internal_volume->io_handle->io_engine,
+			     direct_io_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set direct IO handle in IO engine.",
+				 function );
+
+				libfsxfs_volume_close(
+				 volume,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -497,6 +644,17 @@ int libfsxfs_volume_open_wide(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_DIRECT_IO ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: direct IO currently not supported.",
+		 function );
+
+		return( -1 );
+	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -558,6 +716,31 @@ int libfsxfs_volume_open_wide(
 
 		goto on_error;
 	}
+	if( internal_volume->number_of_io_engine_workers > 0 )
+	{
+		/* The IO engine is only used with a file IO handle created by the library
+		 * since its workers read using clones of the file IO handle
+		 */
+		if( libfsxfs_io_engine_initialize(
+		     &( internal_volume->io_handle->io_engine ),
+		     file_io_handle,
+		     internal_volume->number_of_io_engine_workers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO engine.",
+			 function );
+
+			libfsxfs_volume_close(
+			 volume,
+			 NULL );
+
+			goto on_error;
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -813,6 +996,25 @@ int libfsxfs_volume_close(
 
 		return( -1 );
 	}
+	/* The pending asynchronous reads are cancelled before the lock is grabbed
+	 * so that their callbacks can use the volume
+	 */
+	if( internal_volume->io_handle->read_queue != NULL )
+	{
+		if( libfsxfs_read_queue_cancel_requests(
+		     internal_volume->io_handle->read_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to cancel pending reads.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -885,6 +1087,38 @@ int libfsxfs_volume_close(
 	}
 	internal_volume->file_io_handle = NULL;
 
+	if( internal_volume->io_handle->io_engine != NULL )
+	{
+		if( libfsxfs_io_engine_free(
+		     &( internal_volume->io_handle->io_engine ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO engine.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->io_handle->read_queue != NULL )
+	{
+		if( libfsxfs_read_queue_free(
+		     &( internal_volume->io_handle->read_queue ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read queue.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( libfsxfs_io_handle_clear(
 	     internal_volume->io_handle,
 	     error ) != 1 )
@@ -930,6 +1164,102 @@ int libfsxfs_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->unallocated_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_volume->unallocated_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unallocated data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->space_map != NULL )
+	{
+		if( libfsxfs_space_map_free(
+		     &( internal_volume->space_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->space_usage != NULL )
+	{
+		if( libfsxfs_space_usage_free(
+		     &( internal_volume->space_usage ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free space usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->quota_usage != NULL )
+	{
+		if( libfsxfs_quota_usage_free(
+		     &( internal_volume->quota_usage ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free quota usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->unlinked_list != NULL )
+	{
+		if( libfsxfs_unlinked_list_free(
+		     &( internal_volume->unlinked_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unlinked list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->owner_map != NULL )
+	{
+		if( libfsxfs_owner_map_free(
+		     &( internal_volume->owner_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free owner map.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -961,7 +1291,9 @@ int libfsxfs_internal_volume_open_read(
 	off64_t allocation_group_size     = 0;
 	off64_t inode_information_offset  = 0;
 	off64_t superblock_offset         = 0;
+	uint64_t read_start_timestamp     = 0;
 	uint32_t allocation_group_index   = 0;
+	int result                        = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -1007,14 +1339,27 @@ int libfsxfs_internal_volume_open_read(
 
 		return( -1 );
 	}
-	do
+	if( libfsxfs_statistics_clear(
+	     internal_volume->io_handle->statistics,
+	     error ) != 1 )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading superblock: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
 			 superblock_offset,
 			 superblock_offset );
 		}
@@ -1033,6 +1378,9 @@ int libfsxfs_internal_volume_open_read(
 
 			goto on_error;
 		}
+		read_start_timestamp = libfsxfs_io_handle_get_timestamp(
+		                       internal_volume->io_handle );
+
 		if( libfsxfs_superblock_read_file_io_handle(
 		     superblock,
 		     file_io_handle,
@@ -1051,6 +1399,27 @@ int libfsxfs_internal_volume_open_read(
 
 			goto on_error;
 		}
+		/* The superblock is read and decoded in one pass hence its decode time is accounted as read time
+		 */
+		if( libfsxfs_io_handle_add_read(
+		     internal_volume->io_handle,
+		     LIBFSXFS_READ_CATEGORY_SUPERBLOCK,
+		     superblock_offset,
+		     512,
+		     0,
+		     read_start_timestamp,
+		     libfsxfs_io_handle_get_timestamp( internal_volume->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add read to IO handle.",
+			 function );
+
+			goto on_error;
+		}
 		if( internal_volume->superblock == NULL )
 		{
 			internal_volume->superblock                                      = superblock;
@@ -1063,6 +1432,20 @@ int libfsxfs_internal_volume_open_read(
 			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
 			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
 
+			/* Stripe geometry that does not fit the read-ahead data is ignored
+			 */
+			if( ( superblock->raid_unit_size != 0 )
+			 && ( superblock->raid_unit_size <= ( ( LIBFSXFS_BLOCK_DATA_MAXIMUM_READ_AHEAD_SIZE / 2 ) / superblock->block_size ) ) )
+			{
+				internal_volume->io_handle->stripe_unit_size = superblock->raid_unit_size * superblock->block_size;
+
+				if( ( superblock->raid_width != 0 )
+				 && ( ( superblock->raid_width % superblock->raid_unit_size ) == 0 )
+				 && ( superblock->raid_width <= ( LIBFSXFS_BLOCK_DATA_MAXIMUM_READ_AHEAD_SIZE / superblock->block_size ) ) )
+				{
+					internal_volume->io_handle->stripe_width = superblock->raid_width * superblock->block_size;
+				}
+			}
 			superblock = NULL;
 		}
 		inode_information_offset = superblock_offset + 2 * internal_volume->superblock->sector_size;
@@ -1157,6 +1540,59 @@ int libfsxfs_internal_volume_open_read(
 
 		goto on_error;
 	}
+	/* The inode information of every allocation group is read since it is only a sector
+	 * per allocation group, a matching sidecar index is used to skip the inode B+ tree
+	 * and directory walks
+	 */
+	if( internal_volume->index_file_io_handle != NULL )
+	{
+		result = libfsxfs_internal_volume_read_sidecar_index(
+		          internal_volume,
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sidecar index.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfsxfs_internal_volume_build_sidecar_index(
+			     internal_volume,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build sidecar index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfsxfs_read_queue_initialize(
+	     &( internal_volume->io_handle->read_queue ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -1181,269 +1617,374 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the format version
- * Returns 1 if successful or -1 on error
+/* Reads the sidecar index
+ * A sidecar index that cannot be read or that does not match the volume is ignored
+ * Returns 1 if successful, 0 if no matching sidecar index is available or -1 on error
  */
-int libfsxfs_volume_get_format_version(
-     libfsxfs_volume_t *volume,
-     uint8_t *format_version,
+int libfsxfs_internal_volume_read_sidecar_index(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_format_version";
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	static char *function                   = "libfsxfs_internal_volume_read_sidecar_index";
+	size64_t media_size                     = 0;
+	int result                              = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( internal_volume->io_handle == NULL )
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 "%s: invalid internal volume - missing file system.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( internal_volume->file_system->sidecar_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal volume - invalid file system - sidecar index value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &media_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*format_version = internal_volume->io_handle->format_version;
-
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	/* A missing sidecar index is not considered an error
+	 */
+	if( libbfio_handle_open(
+	     internal_volume->index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_sidecar_index_initialize(
+	     &sidecar_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( 1 );
+	/* A sidecar index that cannot be read is rebuilt
+	 */
+	if( libfsxfs_sidecar_index_read_file_io_handle(
+	     sidecar_index,
+	     internal_volume->index_file_io_handle,
+	     NULL ) == 1 )
+	{
+		result = libfsxfs_sidecar_index_matches(
+		          sidecar_index,
+		          internal_volume->superblock,
+		          media_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if sidecar index matches volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_close(
+	     internal_volume->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		internal_volume->file_system->sidecar_index = sidecar_index;
+	}
+	else
+	{
+		if( libfsxfs_sidecar_index_free(
+		     &sidecar_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sidecar index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded label
- * The returned size includes the end of string character
+/* Builds the sidecar index and writes it to the index file
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_utf8_label_size(
-     libfsxfs_volume_t *volume,
-     size_t *utf8_string_size,
+int libfsxfs_internal_volume_build_sidecar_index(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf8_label_size";
-	int result                                  = 1;
+	libfsxfs_metadata_table_t *metadata_table = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index   = NULL;
+	static char *function                     = "libfsxfs_internal_volume_build_sidecar_index";
+	size64_t media_size                       = 0;
+	int file_io_handle_is_open                = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid internal volume.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 "%s: invalid internal volume - missing file system.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->file_system->sidecar_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid internal volume - invalid file system - sidecar index value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsxfs_superblock_get_utf8_volume_label_size(
-	     internal_volume->superblock,
-	     utf8_string_size,
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &media_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume label string size.",
+		 "%s: unable to retrieve media size.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsxfs_metadata_table_initialize(
+	     &metadata_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the UTF-8 encoded label
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_volume_get_utf8_label(
-     libfsxfs_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf8_label";
-	int result                                  = 1;
-
-	if( volume == NULL )
+	if( libfsxfs_internal_volume_read_metadata_table(
+	     internal_volume,
+	     file_io_handle,
+	     metadata_table,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsxfs_internal_volume_t *) volume;
-
-	if( internal_volume->superblock == NULL )
+	if( libfsxfs_sidecar_index_initialize(
+	     &sidecar_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsxfs_sidecar_index_build(
+	     sidecar_index,
+	     internal_volume->io_handle,
+	     file_io_handle,
+	     internal_volume->superblock,
+	     media_size,
+	     internal_volume->file_system->inode_btree,
+	     metadata_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build sidecar index.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libfsxfs_superblock_get_utf8_volume_label(
-	     internal_volume->superblock,
-	     utf8_string,
-	     utf8_string_size,
+	if( libfsxfs_metadata_table_free(
+	     &metadata_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume label string.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata table.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libbfio_handle_open(
+	     internal_volume->index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	file_io_handle_is_open = 1;
+
+	if( libfsxfs_sidecar_index_write_file_io_handle(
+	     sidecar_index,
+	     internal_volume->index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write sidecar index.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     internal_volume->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->file_system->sidecar_index = sidecar_index;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 internal_volume->index_file_io_handle,
+		 NULL );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	if( metadata_table != NULL )
+	{
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded label
- * The returned size includes the end of string character
+/* Retrieves the format version
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_utf16_label_size(
+int libfsxfs_volume_get_format_version(
      libfsxfs_volume_t *volume,
-     size_t *utf16_string_size,
+     uint8_t *format_version,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf16_label_size";
-	int result                                  = 1;
+	static char *function                       = "libfsxfs_volume_get_format_version";
 
 	if( volume == NULL )
 	{
@@ -1458,13 +1999,24 @@ int libfsxfs_volume_get_utf16_label_size(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal volume - missing superblock.",
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
 		 function );
 
 		return( -1 );
@@ -1484,20 +2036,8 @@ int libfsxfs_volume_get_utf16_label_size(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_superblock_get_utf16_volume_label_size(
-	     internal_volume->superblock,
-	     utf16_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume label string size.",
-		 function );
+	*format_version = internal_volume->io_handle->format_version;
 
-		result = -1;
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -1513,21 +2053,20 @@ int libfsxfs_volume_get_utf16_label_size(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded label
- * The size should include the end of string character
+/* Retrieves the size of the UTF-8 encoded label
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_utf16_label(
+int libfsxfs_volume_get_utf8_label_size(
      libfsxfs_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_utf16_label";
+	static char *function                       = "libfsxfs_volume_get_utf8_label_size";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1569,17 +2108,16 @@ int libfsxfs_volume_get_utf16_label(
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_superblock_get_utf16_volume_label(
+	if( libfsxfs_superblock_get_utf8_volume_label_size(
 	     internal_volume->superblock,
-	     utf16_string,
-	     utf16_string_size,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume label string.",
+		 "%s: unable to retrieve UTF-8 volume label string size.",
 		 function );
 
 		result = -1;
@@ -1602,19 +2140,21 @@ int libfsxfs_volume_get_utf16_label(
 	return( result );
 }
 
-/* Retrieves the file entry of a specific inode
+/* Retrieves the UTF-8 encoded label
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_inode(
-     libfsxfs_internal_volume_t *internal_volume,
-     uint64_t inode_number,
-     libfsxfs_file_entry_t **file_entry,
+int libfsxfs_volume_get_utf8_label(
+     libfsxfs_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *inode = NULL;
-	static char *function   = "libfsxfs_internal_volume_get_file_entry_by_inode";
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_utf8_label";
+	int result                                  = 1;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1625,90 +2165,78 @@ int libfsxfs_internal_volume_get_file_entry_by_inode(
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsxfs_file_system_get_inode_by_number(
-	     internal_volume->file_system,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     inode_number,
-	     &inode,
+#endif
+	if( libfsxfs_superblock_get_utf8_volume_label(
+	     internal_volume->superblock,
+	     utf8_string,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 inode_number );
+		 "%s: unable to retrieve UTF-8 volume label string.",
+		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	/* libfsxfs_file_entry_initialize takes over management of inode
-	 */
-	if( libfsxfs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->file_system,
-	     inode_number,
-	     inode,
-	     NULL,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( inode != NULL )
-	{
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( result );
 }
 
-/* Retrieves the file entry of a specific inode
+/* Retrieves the size of the UTF-16 encoded label
+ * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_file_entry_by_inode(
+int libfsxfs_volume_get_utf16_label_size(
      libfsxfs_volume_t *volume,
-     uint64_t inode_number,
-     libfsxfs_file_entry_t **file_entry,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_inode";
+	static char *function                       = "libfsxfs_volume_get_utf16_label_size";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1724,30 +2252,19 @@ int libfsxfs_volume_get_file_entry_by_inode(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1755,30 +2272,28 @@ int libfsxfs_volume_get_file_entry_by_inode(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_internal_volume_get_file_entry_by_inode(
-	     internal_volume,
-	     inode_number,
-	     file_entry,
+	if( libfsxfs_superblock_get_utf16_volume_label_size(
+	     internal_volume->superblock,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 inode_number );
+		 "%s: unable to retrieve UTF-16 volume label string size.",
+		 function );
 
 		result = -1;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1786,30 +2301,27 @@ int libfsxfs_volume_get_file_entry_by_inode(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the root directory file entry
+/* Retrieves the UTF-16 encoded label
+ * The size should include the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_root_directory(
+int libfsxfs_volume_get_utf16_label(
      libfsxfs_volume_t *volume,
-     libfsxfs_file_entry_t **file_entry,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *inode                     = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_root_directory";
+	static char *function                       = "libfsxfs_volume_get_utf16_label";
 	int result                                  = 1;
 
 	if( volume == NULL )
@@ -1836,30 +2348,8 @@ int libfsxfs_volume_get_root_directory(
 
 		return( -1 );
 	}
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1867,55 +2357,29 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_file_system_get_inode_by_number(
-	     internal_volume->file_system,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->superblock->root_directory_inode_number,
-	     &inode,
+	if( libfsxfs_superblock_get_utf16_volume_label(
+	     internal_volume->superblock,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 internal_volume->superblock->root_directory_inode_number );
-
-		result = -1;
-	}
-	else if( libfsxfs_file_entry_initialize(
-	          file_entry,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          internal_volume->file_system,
-	          internal_volume->superblock->root_directory_inode_number,
-	          inode,
-	          NULL,
-	          error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 "%s: unable to retrieve UTF-16 volume label string.",
 		 function );
 
-		libfsxfs_inode_free(
-		 &inode,
-		 NULL );
-
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1923,34 +2387,26 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+int libfsxfs_internal_volume_get_file_entry_by_inode(
      libfsxfs_internal_volume_t *internal_volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
+     uint64_t inode_number,
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *directory_entry = NULL;
-	libfsxfs_inode_t *inode                     = NULL;
-	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf8_path";
-	uint64_t inode_number                       = 0;
-	int result                                  = 0;
+	libfsxfs_inode_t *inode = NULL;
+	static char *function   = "libfsxfs_internal_volume_get_file_entry_by_inode";
 
 	if( internal_volume == NULL )
 	{
@@ -1963,53 +2419,68 @@ int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
-	result = libfsxfs_file_system_get_directory_entry_by_utf8_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf8_string,
-	          utf8_string_length,
-	          &inode_number,
-	          &inode,
-	          &directory_entry,
-	          error );
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-8 path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
+		return( -1 );
+	}
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
 		goto on_error;
 	}
-	else if( result != 0 )
+	/* libfsxfs_file_entry_initialize takes over management of inode
+	 */
+	if( libfsxfs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     inode_number,
+	     inode,
+	     NULL,
+	     error ) != 1 )
 	{
-		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
-		 */
-		if( libfsxfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->file_system,
-		     inode_number,
-		     inode,
-		     directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
 
 on_error:
 	if( inode != NULL )
@@ -2018,28 +2489,21 @@ on_error:
 		 &inode,
 		 NULL );
 	}
-	if( directory_entry != NULL )
-	{
-		libfsxfs_directory_entry_free(
-		 &directory_entry,
-		 NULL );
-	}
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the file entry of a specific inode
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_file_entry_by_utf8_path(
+int libfsxfs_volume_get_file_entry_by_inode(
      libfsxfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
+     uint64_t inode_number,
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf8_path";
-	int result                                  = 0;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_inode";
+	int result                                  = 1;
 
 	if( volume == NULL )
 	{
@@ -2077,7 +2541,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2085,32 +2549,30 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfsxfs_internal_volume_get_file_entry_by_utf8_path(
-	          internal_volume,
-	          utf8_string,
-	          utf8_string_length,
-	          file_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsxfs_internal_volume_get_file_entry_by_inode(
+	     internal_volume,
+	     inode_number,
+	     file_entry,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
-		 function );
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2118,7 +2580,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsxfs_file_entry_free(
@@ -2131,21 +2593,15 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 	return( result );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Reads the inode allocation map from the inode B+ trees of the allocation groups
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+int libfsxfs_internal_volume_read_inode_allocation_map(
      libfsxfs_internal_volume_t *internal_volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_entry_t *directory_entry = NULL;
-	libfsxfs_inode_t *inode                     = NULL;
-	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf16_path";
-	uint64_t inode_number                       = 0;
-	int result                                  = 0;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	static char *function                                 = "libfsxfs_internal_volume_read_inode_allocation_map";
 
 	if( internal_volume == NULL )
 	{
@@ -2158,83 +2614,5067 @@ int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	result = libfsxfs_file_system_get_directory_entry_by_utf16_path(
-	          internal_volume->file_system,
-	          internal_volume->io_handle,
-	          internal_volume->file_io_handle,
-	          utf16_string,
-	          utf16_string_length,
-	          &inode_number,
-	          &inode,
-	          &directory_entry,
-	          error );
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by UTF-16 path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	if( internal_volume->file_system->inode_allocation_map != NULL )
 	{
-		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
-		 */
-		if( libfsxfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - inode allocation map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_allocation_map_initialize(
+	     &inode_allocation_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_allocation_map_read_file_system(
+	     inode_allocation_map,
+	     internal_volume->file_system->inode_btree,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file system only uses the inode allocation map after it has been read completely
+	 */
+	internal_volume->file_system->inode_allocation_map = inode_allocation_map;
+
+	return( 1 );
+
+on_error:
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a specific inode is allocated
+ * The inode allocation map is read on the first call, after which unallocated
+ * inodes are also rejected by libfsxfs_volume_get_file_entry_by_inode without reading the inode
+ * Only the first call takes the read/write lock for writing, to read the inode allocation map
+ * Returns 1 if the inode is allocated, 0 if not or -1 on error
+ */
+int libfsxfs_volume_is_inode_allocated(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_is_inode_allocated";
+	int read_inode_allocation_map               = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_system->inode_allocation_map == NULL )
+	{
+		read_inode_allocation_map = 1;
+	}
+	else
+	{
+		result = libfsxfs_inode_allocation_map_is_inode_allocated(
+		          internal_volume->file_system->inode_allocation_map,
+		          inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if inode: %" PRIu64 " is allocated.",
+			 function,
+			 inode_number );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_inode_allocation_map == 0 )
+	{
+		return( result );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have read the inode allocation map in the meantime
+	 */
+	if( internal_volume->file_system->inode_allocation_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_inode_allocation_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode allocation map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		result = libfsxfs_inode_allocation_map_is_inode_allocated(
+		          internal_volume->file_system->inode_allocation_map,
+		          inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if inode: %" PRIu64 " is allocated.",
+			 function,
+			 inode_number );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the block owner map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_owner_map(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_volume_read_owner_map";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->owner_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - owner map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_owner_map_initialize(
+	     &( internal_volume->owner_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create owner map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_owner_map_read_file_system(
+	     internal_volume->owner_map,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read owner map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &( internal_volume->owner_map ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry that owns a specific volume offset
+ * The block owner map is read on the first call
+ * Returns 1 if successful, 0 if the offset is not owned by a file entry or -1 on error
+ */
+int libfsxfs_volume_get_file_entry_by_offset(
+     libfsxfs_volume_t *volume,
+     off64_t offset,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_offset";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->owner_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_owner_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read owner map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		result = libfsxfs_owner_map_get_inode_number_by_offset(
+		          internal_volume->owner_map,
+		          offset,
+		          &inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode number of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_internal_volume_get_file_entry_by_inode(
+		     internal_volume,
+		     inode_number,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the space map from the free space B+ trees of the allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_space_map(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsxfs_free_space_btree_t *free_space_btree = NULL;
+	static char *function                         = "libfsxfs_internal_volume_read_space_map";
+	off64_t free_space_information_offset         = 0;
+	uint32_t allocation_group_index               = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->space_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - space map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_free_space_btree_initialize(
+	     &free_space_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free space B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_space_map_initialize(
+	     &( internal_volume->space_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create space map.",
+		 function );
+
+		goto on_error;
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < internal_volume->superblock->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( internal_volume->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		/* The free space information is stored in the second sector of the allocation group
+		 */
+		free_space_information_offset = ( (off64_t) allocation_group_index * internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size )
+		                              + internal_volume->superblock->sector_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading free space information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 allocation_group_index,
+			 free_space_information_offset,
+			 free_space_information_offset );
+		}
+#endif
+		if( libfsxfs_free_space_btree_read_free_space_information(
+		     free_space_btree,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     free_space_information_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read free space information: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_free_space_btree_get_extents(
+		     free_space_btree,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     (int) allocation_group_index,
+		     internal_volume->space_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve free extents of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_free_space_btree_free(
+	     &free_space_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free free space B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->space_map != NULL )
+	{
+		libfsxfs_space_map_free(
+		 &( internal_volume->space_map ),
+		 NULL );
+	}
+	if( free_space_btree != NULL )
+	{
+		libfsxfs_free_space_btree_free(
+		 &free_space_btree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of free extents
+ * The space map is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_free_extents(
+     libfsxfs_volume_t *volume,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_free_extents";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		*number_of_extents = internal_volume->space_map->number_of_free_extents;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific free extent
+ * The extents are sorted by their offset
+ * The space map is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_free_extent_by_index(
+     libfsxfs_volume_t *volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_free_extent_by_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( ( extent_index < 0 )
+		 || ( extent_index >= internal_volume->space_map->number_of_free_extents ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent index value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*extent_offset = internal_volume->space_map->free_extents[ extent_index ].offset;
+			*extent_size   = internal_volume->space_map->free_extents[ extent_index ].size;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of allocated extents
+ * The space map is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_allocated_extents(
+     libfsxfs_volume_t *volume,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_allocated_extents";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		*number_of_extents = internal_volume->space_map->number_of_allocated_extents;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific allocated extent
+ * The extents are sorted by their offset
+ * The space map is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_allocated_extent_by_index(
+     libfsxfs_volume_t *volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_allocated_extent_by_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( ( extent_index < 0 )
+		 || ( extent_index >= internal_volume->space_map->number_of_allocated_extents ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extent index value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*extent_offset = internal_volume->space_map->allocated_extents[ extent_index ].offset;
+			*extent_size   = internal_volume->space_map->allocated_extents[ extent_index ].size;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_allocation_groups(
+     libfsxfs_volume_t *volume,
+     uint32_t *number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_allocation_groups";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocation_groups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocation groups.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of blocks of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_get_allocation_group_number_of_blocks(
+     libfsxfs_internal_volume_t *internal_volume,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libfsxfs_internal_volume_get_allocation_group_number_of_blocks";
+	uint64_t allocation_group_block_number = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= internal_volume->superblock->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_block_number = (uint64_t) allocation_group_index * internal_volume->superblock->allocation_group_size;
+
+	if( allocation_group_block_number >= internal_volume->superblock->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The last allocation group can be smaller than the others
+	 */
+	*number_of_blocks = internal_volume->superblock->number_of_blocks - allocation_group_block_number;
+
+	if( *number_of_blocks > internal_volume->superblock->allocation_group_size )
+	{
+		*number_of_blocks = internal_volume->superblock->allocation_group_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the allocation bitmap of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_allocation_bitmap_size(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     size_t *bitmap_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_allocation_bitmap_size";
+	uint64_t number_of_blocks                   = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( bitmap_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bitmap size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_volume_get_allocation_group_number_of_blocks(
+	     internal_volume,
+	     allocation_group_index,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks of allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+	else
+	{
+		*bitmap_size = (size_t) ( ( number_of_blocks + 7 ) / 8 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the allocation bitmap of a specific allocation group
+ * The bitmap contains a bit per block, where a set bit indicates the block is allocated
+ * The space map is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_allocation_bitmap(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_allocation_bitmap";
+	off64_t allocation_group_offset             = 0;
+	uint64_t number_of_blocks                   = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_volume_get_allocation_group_number_of_blocks(
+	     internal_volume,
+	     allocation_group_index,
+	     &number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of blocks of allocation group: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+	if( ( result == 1 )
+	 && ( internal_volume->space_map == NULL ) )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		allocation_group_offset = (off64_t) allocation_group_index * internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size;
+
+		if( libfsxfs_space_map_get_allocation_bitmap(
+		     internal_volume->space_map,
+		     allocation_group_offset,
+		     number_of_blocks,
+		     internal_volume->io_handle->block_size,
+		     bitmap,
+		     bitmap_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve allocation bitmap of allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the unallocated data stream
+ * The space map is read if not already available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_unallocated_data_stream(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_volume_read_unallocated_data_stream";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->unallocated_data_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - unallocated data stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->space_map == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_map(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_data_stream_initialize_from_space_map(
+	     &( internal_volume->unallocated_data_stream ),
+	     internal_volume->io_handle,
+	     internal_volume->space_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unallocated data stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the unallocated data
+ * The unallocated data consists of the free extents concatenated in volume offset order
+ * The unallocated data stream is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_unallocated_data_size(
+     libfsxfs_volume_t *volume,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_unallocated_data_size";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->unallocated_data_stream == NULL )
+	{
+		if( libfsxfs_internal_volume_read_unallocated_data_stream(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unallocated data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfdata_stream_get_size(
+		     internal_volume->unallocated_data_stream,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of unallocated data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads unallocated data at a specific offset
+ * The offset is relative to the start of the unallocated data
+ * The unallocated data stream is read on the first call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_volume_read_unallocated_buffer_at_offset(
+         libfsxfs_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_read_unallocated_buffer_at_offset";
+	ssize_t read_count                          = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->unallocated_data_stream == NULL )
+	{
+		if( libfsxfs_internal_volume_read_unallocated_data_stream(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unallocated data stream.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+	if( read_count == 0 )
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_volume->unallocated_data_stream,
+		              (intptr_t *) internal_volume->file_io_handle,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from unallocated data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Retrieves the volume offset of a specific unallocated data offset
+ * The unallocated data stream is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_unallocated_data_volume_offset(
+     libfsxfs_volume_t *volume,
+     off64_t unallocated_data_offset,
+     off64_t *volume_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_unallocated_data_volume_offset";
+	size64_t segment_size                       = 0;
+	off64_t segment_data_offset                 = 0;
+	off64_t segment_offset                      = 0;
+	uint32_t segment_flags                      = 0;
+	int result                                  = 1;
+	int segment_file_index                      = 0;
+	int segment_index                           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->unallocated_data_stream == NULL )
+	{
+		if( libfsxfs_internal_volume_read_unallocated_data_stream(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unallocated data stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfdata_stream_get_segment_index_at_offset(
+		     internal_volume->unallocated_data_stream,
+		     unallocated_data_offset,
+		     &segment_index,
+		     &segment_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment index at unallocated data offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 unallocated_data_offset,
+			 unallocated_data_offset );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfdata_stream_get_segment_by_index(
+		     internal_volume->unallocated_data_stream,
+		     segment_index,
+		     &segment_file_index,
+		     &segment_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 segment_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		*volume_offset = segment_offset + segment_data_offset;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the quota usage from the quota inodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_quota_usage(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_volume_read_quota_usage";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->quota_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - quota usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_quota_usage_initialize(
+	     &( internal_volume->quota_usage ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create quota usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_quota_usage_read_file_system(
+	     internal_volume->quota_usage,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read quota usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->quota_usage != NULL )
+	{
+		libfsxfs_quota_usage_free(
+		 &( internal_volume->quota_usage ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of quota records
+ * Only quota records with block or inode usage are included
+ * The quota usage is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_quota_records(
+     libfsxfs_volume_t *volume,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_quota_records";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->quota_usage == NULL )
+	{
+		if( libfsxfs_internal_volume_read_quota_usage(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read quota usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_quota_usage_get_number_of_records(
+		     internal_volume->quota_usage,
+		     number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of quota records.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific quota record
+ * The quota type contains a LIBFSXFS_QUOTA_TYPE value and the identifier
+ * the corresponding user, group or project identifier
+ * The quota usage is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_quota_record_by_index(
+     libfsxfs_volume_t *volume,
+     int record_index,
+     uint8_t *quota_type,
+     uint32_t *identifier,
+     uint64_t *number_of_blocks,
+     uint64_t *number_of_inodes,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_quota_record_t *quota_record       = NULL;
+	static char *function                       = "libfsxfs_volume_get_quota_record_by_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( quota_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid quota type.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->quota_usage == NULL )
+	{
+		if( libfsxfs_internal_volume_read_quota_usage(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read quota usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_quota_usage_get_record_by_index(
+		     internal_volume->quota_usage,
+		     record_index,
+		     &quota_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve quota record: %d.",
+			 function,
+			 record_index );
+
+			result = -1;
+		}
+		else if( quota_record == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing quota record: %d.",
+			 function,
+			 record_index );
+
+			result = -1;
+		}
+		else
+		{
+			*quota_type       = quota_record->quota_type;
+			*identifier       = quota_record->identifier;
+			*number_of_blocks = quota_record->number_of_blocks;
+			*number_of_inodes = quota_record->number_of_inodes;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the space usage from the inodes of the allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_space_usage(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_volume_read_space_usage";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->space_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - space usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_usage_initialize(
+	     &( internal_volume->space_usage ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create space usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_space_usage_read_file_system(
+	     internal_volume->space_usage,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read space usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &( internal_volume->space_usage ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of space usage entries of a specific space usage type
+ * The space usage is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_space_usage_entries(
+     libfsxfs_volume_t *volume,
+     int usage_type,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_space_usage_entries";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_usage == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_usage(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_space_usage_get_number_of_entries(
+		     internal_volume->space_usage,
+		     usage_type,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of space usage entries.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific space usage entry of a specific space usage type
+ * The key contains the owner identifier, group identifier, file type or size bucket
+ * The space usage is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_space_usage_entry_by_index(
+     libfsxfs_volume_t *volume,
+     int usage_type,
+     int entry_index,
+     uint32_t *key,
+     uint64_t *number_of_inodes,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_space_usage_entry_by_index";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->space_usage == NULL )
+	{
+		if( libfsxfs_internal_volume_read_space_usage(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read space usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_space_usage_get_entry_by_index(
+		     internal_volume->space_usage,
+		     usage_type,
+		     entry_index,
+		     key,
+		     number_of_inodes,
+		     number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve space usage entry: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the unlinked inode list from the unlinked hash buckets of the allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_unlinked_list(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_volume_read_unlinked_list";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->unlinked_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - unlinked list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_unlinked_list_initialize(
+	     &( internal_volume->unlinked_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unlinked list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_unlinked_list_read_file_system(
+	     internal_volume->unlinked_list,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     internal_volume->superblock->sector_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read unlinked list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &( internal_volume->unlinked_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of unlinked inodes
+ * Unlinked inodes are inodes that were removed from their directory while still in use
+ * The unlinked list is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_unlinked_inodes(
+     libfsxfs_volume_t *volume,
+     int *number_of_inodes,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_unlinked_inodes";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->unlinked_list == NULL )
+	{
+		if( libfsxfs_internal_volume_read_unlinked_list(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unlinked list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_unlinked_list_get_number_of_inodes(
+		     internal_volume->unlinked_list,
+		     number_of_inodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of unlinked inodes.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry of a specific unlinked inode
+ * The data streams of the file entry provide access to the data of the unlinked inode
+ * The unlinked list is read on the first call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_unlinked_file_entry_by_index(
+     libfsxfs_volume_t *volume,
+     int inode_index,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_unlinked_file_entry_by_index";
+	uint64_t inode_number                       = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->unlinked_list == NULL )
+	{
+		if( libfsxfs_internal_volume_read_unlinked_list(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unlinked list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_unlinked_list_get_inode_number_by_index(
+		     internal_volume->unlinked_list,
+		     inode_index,
+		     &inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unlinked inode: %d number.",
+			 function,
+			 inode_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfsxfs_internal_volume_get_file_entry_by_inode(
+		     internal_volume,
+		     inode_number,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unlinked inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_root_directory(
+     libfsxfs_volume_t *volume,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_root_directory";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->root_directory_inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 internal_volume->superblock->root_directory_inode_number );
+
+		result = -1;
+	}
+	else if( libfsxfs_file_entry_initialize(
+	          file_entry,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->root_directory_inode_number,
+	          inode,
+	          NULL,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+     libfsxfs_internal_volume_t *internal_volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf8_path";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_get_directory_entry_by_utf8_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf8_string,
+	          utf8_string_length,
+	          &inode_number,
+	          &inode,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
+		 */
+		if( libfsxfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     inode_number,
+		     inode,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_volume_get_file_entry_by_utf8_path(
+     libfsxfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf8_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsxfs_internal_volume_get_file_entry_by_utf8_path(
+	          internal_volume,
+	          utf8_string,
+	          utf8_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-8 encoded path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+     libfsxfs_internal_volume_t *internal_volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	static char *function                       = "libfsxfs_internal_volume_get_file_entry_by_utf16_path";
+	uint64_t inode_number                       = 0;
+	int result                                  = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_get_directory_entry_by_utf16_path(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          utf16_string,
+	          utf16_string_length,
+	          &inode_number,
+	          &inode,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* libfsxfs_file_entry_initialize takes over management of inode and directory_entry
+		 */
+		if( libfsxfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     internal_volume->file_io_handle,
+		     internal_volume->file_system,
+		     inode_number,
+		     inode,
+		     directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsxfs_volume_get_file_entry_by_utf16_path(
+     libfsxfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf16_path";
+	int result                                  = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsxfs_internal_volume_get_file_entry_by_utf16_path(
+	          internal_volume,
+	          utf16_string,
+	          utf16_string_length,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsxfs_file_entry_free(
+		 file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+
+/* Retrieves the read statistics of a specific read category
+ * The statistics are retained after close until the volume is opened again
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_read_statistics(
+     libfsxfs_volume_t *volume,
+     int read_category,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_read_statistics";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_statistics_get_read_values(
+	     internal_volume->io_handle->statistics,
+	     read_category,
+	     number_of_reads,
+	     number_of_bytes_read,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_cache_hits,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_cache_statistics";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_statistics_get_cache_values(
+	     internal_volume->io_handle->statistics,
+	     number_of_cache_hits,
+	     number_of_cache_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the time statistics
+ * The read and decode times are in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_time_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *read_time,
+     uint64_t *decode_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_time_statistics";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_statistics_get_time_values(
+	     internal_volume->io_handle->statistics,
+	     read_time,
+	     decode_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets if statistics should be collected
+ * Statistics are not collected by default since collecting them requires
+ * a timestamp and a lock per read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_collect_statistics(
+     libfsxfs_volume_t *volume,
+     uint8_t collect_statistics,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_collect_statistics";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( collect_statistics != 0 )
+	{
+		internal_volume->io_handle->collect_statistics = 1;
+	}
+	else
+	{
+		internal_volume->io_handle->collect_statistics = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of IO engine workers
+ * The IO engine is not used by default and only used by a volume opened using a filename
+ * The number of workers is applied the next time the volume is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_number_of_io_engine_workers(
+     libfsxfs_volume_t *volume,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_number_of_io_engine_workers";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( ( number_of_workers < 0 )
+	 || ( number_of_workers > LIBFSXFS_IO_ENGINE_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->number_of_io_engine_workers = number_of_workers;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the read trace callback
+ * The callback is called for every metadata and data read with the offset and size
+ * of the read, the read category, the inode number or 0 if the read is not specific
+ * to an inode and the latency of the read in nano seconds.
+ * The callback is called from the thread that performs the read, hence it must be
+ * thread-safe when the volume is used from multiple threads.
+ * Set the callback to NULL to disable tracing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_read_trace_callback(
+     libfsxfs_volume_t *volume,
+     void (*callback)(
+            intptr_t *callback_data,
+            off64_t offset,
+            size64_t size,
+            int read_category,
+            uint64_t inode_number,
+            uint64_t latency ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_read_trace_callback";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->io_handle->read_trace_callback      = callback;
+	internal_volume->io_handle->read_trace_callback_data = callback_data;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the progress callback
+ * The callback is called while reading a directory, the extents of a file entry
+ * or file entry data with the progress type, the inode number and the number of
+ * directory entries, extents or bytes processed so far by the operation.
+ * The callback is called from the thread that performs the operation, hence it must
+ * be thread-safe when the volume is used from multiple threads. It can use
+ * libfsxfs_volume_signal_abort to cancel the operation.
+ * Set the callback to NULL to disable progress reporting
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_progress_callback(
+     libfsxfs_volume_t *volume,
+     void (*callback)(
+            intptr_t *callback_data,
+            int progress_type,
+            uint64_t inode_number,
+            uint64_t number_processed ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_progress_callback";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->io_handle->progress_callback      = callback;
+	internal_volume->io_handle->progress_callback_data = callback_data;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the requests that are pending in the read queue
+ * At most maximum_number_of_requests requests are popped from the read queue and stored
+ * in the requests array. The requests are read as a batch, where the result of every
+ * request is stored in its read count. On error the read count of the requests is -1,
+ * the requests must be completed by the caller in both cases.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_queued_requests(
+     libfsxfs_internal_volume_t *internal_volume,
+     libfsxfs_read_queue_request_t **requests,
+     int maximum_number_of_requests,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *range_error                      = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsxfs_read_batch_t *read_batch                   = NULL;
+	static char *function                               = "libfsxfs_internal_volume_read_queued_requests";
+	int request_index                                   = 0;
+	int safe_number_of_requests                         = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requests = 0;
+
+	if( libfsxfs_read_queue_pop_requests(
+	     internal_volume->io_handle->read_queue,
+	     requests,
+	     maximum_number_of_requests,
+	     &safe_number_of_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop requests from read queue.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_requests = safe_number_of_requests;
+
+	if( safe_number_of_requests == 0 )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_read_batch_initialize(
+	     &read_batch,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extents of every request are resolved before any data is read
+	 * so that the reads of all the requests are issued as one batch
+	 */
+	for( request_index = 0;
+	     request_index < safe_number_of_requests;
+	     request_index++ )
+	{
+		internal_file_entry = (libfsxfs_internal_file_entry_t *) requests[ request_index ]->file_entry;
+
+		if( libfsxfs_read_batch_add_range(
+		     read_batch,
+		     internal_file_entry->inode,
+		     internal_file_entry->data_size,
+		     requests[ request_index ]->buffer,
+		     requests[ request_index ]->buffer_size,
+		     requests[ request_index ]->offset,
+		     &( requests[ request_index ]->read_count ),
+		     &range_error ) != 1 )
+		{
+			/* A request that cannot be resolved fails on its own
+			 */
+			requests[ request_index ]->read_count = -1;
+
+			libcerror_error_free(
+			 &range_error );
+		}
+	}
+	if( libfsxfs_read_batch_flush(
+	     read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_batch != NULL )
+	{
+		libfsxfs_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	for( request_index = 0;
+	     request_index < safe_number_of_requests;
+	     request_index++ )
+	{
+		requests[ request_index ]->read_count = -1;
+	}
+	return( -1 );
+}
+
+/* Polls the asynchronous reads
+ * Reads a batch of the pending reads and calls their callbacks. The callbacks are
+ * called from the thread that polls, after the reads of the batch have completed.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_poll_reads(
+     libfsxfs_volume_t *volume,
+     int *number_of_completed_reads,
+     libcerror_error_t **error )
+{
+	libfsxfs_read_queue_request_t *requests[ LIBFSXFS_READ_QUEUE_MAXIMUM_NUMBER_OF_REQUESTS_PER_POLL ];
+
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_poll_reads";
+	int number_of_requests                      = 0;
+	int request_index                           = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_completed_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of completed reads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->io_handle->read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing read queue.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_internal_volume_read_queued_requests(
+	          internal_volume,
+	          requests,
+	          LIBFSXFS_READ_QUEUE_MAXIMUM_NUMBER_OF_REQUESTS_PER_POLL,
+	          &number_of_requests,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read queued requests.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	/* The callbacks are called without holding the lock so that they can use the volume
+	 */
+	for( request_index = 0;
+	     request_index < number_of_requests;
+	     request_index++ )
+	{
+		if( libfsxfs_read_queue_complete_request(
+		     &( requests[ request_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to complete request: %d.",
+			 function,
+			 request_index );
+
+			result = -1;
+		}
+	}
+	*number_of_completed_reads = number_of_requests;
+
+	return( result );
+}
+
+/* Waits for the asynchronous reads
+ * Polls the reads until no reads are pending, including reads that are submitted
+ * by the callbacks while waiting
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_wait_reads(
+     libfsxfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsxfs_volume_wait_reads";
+	int number_of_completed_reads = 0;
+
+	do
+	{
+		if( libfsxfs_volume_poll_reads(
+		     volume,
+		     &number_of_completed_reads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to poll reads.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( number_of_completed_reads > 0 );
+
+	return( 1 );
+}
+
+/* Retrieves the number of pending asynchronous reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_number_of_pending_reads(
+     libfsxfs_volume_t *volume,
+     int *number_of_reads,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_pending_reads";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle->read_queue == NULL )
+	{
+		*number_of_reads = 0;
+
+		return( 1 );
+	}
+	if( libfsxfs_read_queue_get_number_of_requests(
+	     internal_volume->io_handle->read_queue,
+	     number_of_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of requests from read queue.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the metadata of all the inodes reachable from the root directory into a metadata table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_volume_read_metadata_table(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_metadata_table_t *metadata_table,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_t *directory             = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_inode_t *sub_inode                 = NULL;
+	static char *function                       = "libfsxfs_internal_volume_read_metadata_table";
+	uint64_t inode_number                       = 0;
+	uint64_t sub_inode_number                   = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+	int row_index                               = 0;
+	int sub_row_index                           = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata table.",
+		 function );
+
+		return( -1 );
+	}
+	inode_number = internal_volume->superblock->root_directory_inode_number;
+
+	if( libfsxfs_file_system_get_inode_by_number(
+	     internal_volume->file_system,
+	     internal_volume->io_handle,
+	     file_io_handle,
+	     inode_number,
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	/* The parent of the root directory is the root directory itself
+	 */
+	if( libfsxfs_metadata_table_append_row(
+	     metadata_table,
+	     inode_number,
+	     inode_number,
+	     -1,
+	     inode,
+	     NULL,
+	     &row_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root directory row.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_free(
+	     &inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root directory inode.",
+		 function );
+
+		goto on_error;
+	}
+	/* The rows are processed in the order they are appended, which results
+	 * in a breadth-first traversal without a separate list of directories
+	 */
+	for( row_index = 0;
+	     row_index < metadata_table->number_of_rows;
+	     row_index++ )
+	{
+		if( ( metadata_table->rows[ row_index ].file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+		{
+			continue;
+		}
+		inode_number = metadata_table->rows[ row_index ].inode_number;
+
+		result = libfsxfs_metadata_table_has_ancestor(
+		          metadata_table,
+		          metadata_table->rows[ row_index ].parent_row_index,
+		          inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory: %" PRIu64 " is its own ancestor.",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* Do not descend into a directory loop
+			 */
+			continue;
+		}
+		if( libfsxfs_io_handle_update_progress(
+		     internal_volume->io_handle,
+		     LIBFSXFS_PROGRESS_TYPE_INODES,
+		     inode_number,
+		     (uint64_t) metadata_table->number_of_rows,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update progress.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_system_get_inode_by_number(
 		     internal_volume->file_system,
+		     internal_volume->io_handle,
+		     file_io_handle,
 		     inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_initialize(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_read_file_io_handle(
+		     directory,
+		     internal_volume->io_handle,
+		     file_io_handle,
 		     inode,
-		     directory_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory for inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_get_number_of_entries(
+		     directory,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory entries.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libfsxfs_directory_get_entry_by_index(
+			     directory,
+			     entry_index,
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_directory_entry_get_inode_number(
+			     directory_entry,
+			     &sub_inode_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry: %d inode number.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_system_get_inode_by_number(
+			     internal_volume->file_system,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     sub_inode_number,
+			     &sub_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve inode: %" PRIu64 ".",
+				 function,
+				 sub_inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_metadata_table_append_row(
+			     metadata_table,
+			     sub_inode_number,
+			     inode_number,
+			     row_index,
+			     sub_inode,
+			     directory_entry,
+			     &sub_row_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append row for inode: %" PRIu64 ".",
+				 function,
+				 sub_inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_free(
+			     &sub_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode: %" PRIu64 ".",
+				 function,
+				 sub_inode_number );
+
+				goto on_error;
+			}
+		}
+		if( libfsxfs_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode: %" PRIu64 ".",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &sub_inode,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the metadata of all the inodes reachable from the root directory
+ * to a columnar metadata table file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_export_metadata(
+     libfsxfs_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsxfs_volume_export_metadata";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_export_metadata_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export metadata to: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Exports the metadata of all the inodes reachable from the root directory
+ * to a columnar metadata table file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_export_metadata_wide(
+     libfsxfs_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfsxfs_volume_export_metadata_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_export_metadata_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export metadata to: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Exports the metadata of all the inodes reachable from the root directory
+ * to a columnar metadata table file using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing, and truncated, if it is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_export_metadata_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_metadata_table_t *metadata_table   = NULL;
+	static char *function                       = "libfsxfs_volume_export_metadata_file_io_handle";
+	int file_io_handle_is_open                  = 0;
+	int file_io_handle_opened_in_library        = 0;
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_metadata_table_initialize(
+	     &metadata_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfsxfs_internal_volume_read_metadata_table(
+	     internal_volume,
+	     internal_volume->file_io_handle,
+	     metadata_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata table.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsxfs_metadata_table_write_file_io_handle(
+	     metadata_table,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata table.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	return( result );
+	if( libfsxfs_metadata_table_free(
+	     &metadata_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
 
 on_error:
-	if( inode != NULL )
+	if( file_io_handle_opened_in_library != 0 )
 	{
-		libfsxfs_inode_free(
-		 &inode,
+		libbfio_handle_close(
+		 file_io_handle,
 		 NULL );
 	}
-	if( directory_entry != NULL )
+	if( metadata_table != NULL )
 	{
-		libfsxfs_directory_entry_free(
-		 &directory_entry,
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Sets the sidecar index file
+ * The sidecar index is read when the volume is opened and (re)built when it is missing or does not match the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_get_file_entry_by_utf16_path(
+int libfsxfs_volume_set_index_file(
      libfsxfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsxfs_file_entry_t **file_entry,
+     const char *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_get_file_entry_by_utf16_path";
-	int result                                  = 0;
+	static char *function                       = "libfsxfs_volume_set_index_file";
 
 	if( volume == NULL )
 	{
@@ -2249,27 +7689,56 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( internal_volume->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -2283,27 +7752,176 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
+		goto on_error;
+	}
+#endif
+	if( internal_volume->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_volume->read_write_lock,
+			 NULL );
+#endif
+			goto on_error;
+		}
+	}
+	internal_volume->index_file_io_handle = file_io_handle;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
 #endif
-	result = libfsxfs_internal_volume_get_file_entry_by_utf16_path(
-	          internal_volume,
-	          utf16_string,
-	          utf16_string_length,
-	          file_entry,
-	          error );
+	return( 1 );
 
-	if( result == -1 )
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the sidecar index file
+ * The sidecar index is read when the volume is opened and (re)built when it is missing or does not match the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_index_file_wide(
+     libfsxfs_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_index_file_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry by UTF-16 encoded path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file IO handle already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( internal_volume->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_volume->read_write_lock,
+			 NULL );
+#endif
+			goto on_error;
+		}
 	}
+	internal_volume->index_file_io_handle = file_io_handle;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2316,13 +7934,20 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		libfsxfs_file_entry_free(
-		 file_entry,
-		 NULL );
-
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
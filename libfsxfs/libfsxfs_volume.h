@@ -33,8 +33,17 @@
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfdata.h"
+#include "libfsxfs_metadata_table.h"
+#include "libfsxfs_owner_map.h"
+#include "libfsxfs_quota_usage.h"
+#include "libfsxfs_read_queue.h"
+#include "libfsxfs_sidecar_index.h"
+#include "libfsxfs_space_map.h"
+#include "libfsxfs_space_usage.h"
 #include "libfsxfs_superblock.h"
 #include "libfsxfs_types.h"
+#include "libfsxfs_unlinked_list.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -72,6 +81,38 @@ struct libfsxfs_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The sidecar index file IO handle
+	 */
+	libbfio_handle_t *index_file_io_handle;
+
+	/* The block owner map
+	 */
+	libfsxfs_owner_map_t *owner_map;
+
+	/* The space map
+	 */
+	libfsxfs_space_map_t *space_map;
+
+	/* The unallocated data stream
+	 */
+	libfdata_stream_t *unallocated_data_stream;
+
+	/* The quota usage
+	 */
+	libfsxfs_quota_usage_t *quota_usage;
+
+	/* The space usage
+	 */
+	libfsxfs_space_usage_t *space_usage;
+
+	/* The unlinked inode list
+	 */
+	libfsxfs_unlinked_list_t *unlinked_list;
+
+	/* The number of IO engine workers
+	 */
+	int number_of_io_engine_workers;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -129,6 +170,16 @@ int libfsxfs_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsxfs_internal_volume_read_sidecar_index(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_build_sidecar_index(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_get_format_version(
      libfsxfs_volume_t *volume,
@@ -174,6 +225,169 @@ int libfsxfs_volume_get_file_entry_by_inode(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsxfs_internal_volume_read_inode_allocation_map(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_is_inode_allocated(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_owner_map(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_file_entry_by_offset(
+     libfsxfs_volume_t *volume,
+     off64_t offset,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_space_map(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_free_extents(
+     libfsxfs_volume_t *volume,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_free_extent_by_index(
+     libfsxfs_volume_t *volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_allocated_extents(
+     libfsxfs_volume_t *volume,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_allocated_extent_by_index(
+     libfsxfs_volume_t *volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_allocation_groups(
+     libfsxfs_volume_t *volume,
+     uint32_t *number_of_allocation_groups,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_get_allocation_group_number_of_blocks(
+     libfsxfs_internal_volume_t *internal_volume,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_allocation_bitmap_size(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     size_t *bitmap_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_allocation_bitmap(
+     libfsxfs_volume_t *volume,
+     uint32_t allocation_group_index,
+     uint8_t *bitmap,
+     size_t bitmap_size,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_unallocated_data_stream(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_unallocated_data_size(
+     libfsxfs_volume_t *volume,
+     size64_t *data_size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+ssize_t libfsxfs_volume_read_unallocated_buffer_at_offset(
+         libfsxfs_volume_t *volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_unallocated_data_volume_offset(
+     libfsxfs_volume_t *volume,
+     off64_t unallocated_data_offset,
+     off64_t *volume_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_quota_usage(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_quota_records(
+     libfsxfs_volume_t *volume,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_quota_record_by_index(
+     libfsxfs_volume_t *volume,
+     int record_index,
+     uint8_t *quota_type,
+     uint32_t *identifier,
+     uint64_t *number_of_blocks,
+     uint64_t *number_of_inodes,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_space_usage(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_space_usage_entries(
+     libfsxfs_volume_t *volume,
+     int usage_type,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_space_usage_entry_by_index(
+     libfsxfs_volume_t *volume,
+     int usage_type,
+     int entry_index,
+     uint32_t *key,
+     uint64_t *number_of_inodes,
+     uint64_t *number_of_blocks,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_unlinked_list(
+     libfsxfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_unlinked_inodes(
+     libfsxfs_volume_t *volume,
+     int *number_of_inodes,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_unlinked_file_entry_by_index(
+     libfsxfs_volume_t *volume,
+     int inode_index,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_get_root_directory(
      libfsxfs_volume_t *volume,
@@ -210,6 +424,132 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_read_statistics(
+     libfsxfs_volume_t *volume,
+     int read_category,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_cache_hits,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_time_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *read_time,
+     uint64_t *decode_time,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_collect_statistics(
+     libfsxfs_volume_t *volume,
+     uint8_t collect_statistics,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_number_of_io_engine_workers(
+     libfsxfs_volume_t *volume,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_read_trace_callback(
+     libfsxfs_volume_t *volume,
+     void (*callback)(
+            intptr_t *callback_data,
+            off64_t offset,
+            size64_t size,
+            int read_category,
+            uint64_t inode_number,
+            uint64_t latency ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_progress_callback(
+     libfsxfs_volume_t *volume,
+     void (*callback)(
+            intptr_t *callback_data,
+            int progress_type,
+            uint64_t inode_number,
+            uint64_t number_processed ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_queued_requests(
+     libfsxfs_internal_volume_t *internal_volume,
+     libfsxfs_read_queue_request_t **requests,
+     int maximum_number_of_requests,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_poll_reads(
+     libfsxfs_volume_t *volume,
+     int *number_of_completed_reads,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_wait_reads(
+     libfsxfs_volume_t *volume,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_pending_reads(
+     libfsxfs_volume_t *volume,
+     int *number_of_reads,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_volume_read_metadata_table(
+     libfsxfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_metadata_table_t *metadata_table,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_export_metadata(
+     libfsxfs_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_export_metadata_wide(
+     libfsxfs_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_export_metadata_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_index_file(
+     libfsxfs_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_index_file_wide(
+     libfsxfs_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -28,6 +28,8 @@
 #endif
 
 #include "pyfsxfs.h"
+#include "pyfsxfs_directory_entries.h"
+#include "pyfsxfs_directory_entry.h"
 #include "pyfsxfs_error.h"
 #include "pyfsxfs_file_entries.h"
 #include "pyfsxfs_file_entry.h"
@@ -38,6 +40,7 @@
 #include "pyfsxfs_python.h"
 #include "pyfsxfs_unused.h"
 #include "pyfsxfs_volume.h"
+#include "pyfsxfs_walk.h"
 
 #if !defined( LIBFSXFS_HAVE_BFIO )
 
@@ -595,6 +598,40 @@ PyMODINIT_FUNC initpyfsxfs(
 #endif
 	gil_state = PyGILState_Ensure();
 
+	/* Setup the directory_entries type object
+	 */
+	pyfsxfs_directory_entries_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsxfs_directory_entries_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsxfs_directory_entries_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "directory_entries",
+	 (PyObject *) &pyfsxfs_directory_entries_type_object );
+
+	/* Setup the directory_entry type object
+	 */
+	pyfsxfs_directory_entry_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsxfs_directory_entry_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsxfs_directory_entry_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "directory_entry",
+	 (PyObject *) &pyfsxfs_directory_entry_type_object );
+
 	/* Setup the file_entries type object
 	 */
 	pyfsxfs_file_entries_type_object.tp_new = PyType_GenericNew;
@@ -646,6 +683,23 @@ PyMODINIT_FUNC initpyfsxfs(
 	 "volume",
 	 (PyObject *) &pyfsxfs_volume_type_object );
 
+	/* Setup the walk type object
+	 */
+	pyfsxfs_walk_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsxfs_walk_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsxfs_walk_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "walk",
+	 (PyObject *) &pyfsxfs_walk_type_object );
+
 	PyGILState_Release(
 	 gil_state );
 
@@ -0,0 +1,725 @@
+/*
+ * Python object definition of a directory entry of a file entry
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsxfs_directory_entry.h"
+#include "pyfsxfs_error.h"
+#include "pyfsxfs_file_entry.h"
+#include "pyfsxfs_integer.h"
+#include "pyfsxfs_libcerror.h"
+#include "pyfsxfs_libfsxfs.h"
+#include "pyfsxfs_python.h"
+#include "pyfsxfs_unused.h"
+
+PyMethodDef pyfsxfs_directory_entry_object_methods[] = {
+
+	{ "get_name",
+	  (PyCFunction) pyfsxfs_directory_entry_get_name,
+	  METH_NOARGS,
+	  "get_name() -> Unicode string\n"
+	  "\n"
+	  "Retrieves the name." },
+
+	{ "get_inode_number",
+	  (PyCFunction) pyfsxfs_directory_entry_get_inode_number,
+	  METH_NOARGS,
+	  "get_inode_number() -> Integer\n"
+	  "\n"
+	  "Retrieves the inode number." },
+
+	{ "get_file_type",
+	  (PyCFunction) pyfsxfs_directory_entry_get_file_type,
+	  METH_NOARGS,
+	  "get_file_type() -> Integer or None\n"
+	  "\n"
+	  "Retrieves the file type as recorded by the directory, in the form of the file type bits of the file mode." },
+
+	{ "is_directory",
+	  (PyCFunction) pyfsxfs_directory_entry_is_directory,
+	  METH_NOARGS,
+	  "is_directory() -> Boolean\n"
+	  "\n"
+	  "Determines if the directory entry refers to a directory.\n"
+	  "The inode is only read if the directory does not record the file type." },
+
+	{ "is_file",
+	  (PyCFunction) pyfsxfs_directory_entry_is_file,
+	  METH_NOARGS,
+	  "is_file() -> Boolean\n"
+	  "\n"
+	  "Determines if the directory entry refers to a regular file.\n"
+	  "The inode is only read if the directory does not record the file type." },
+
+	{ "is_symbolic_link",
+	  (PyCFunction) pyfsxfs_directory_entry_is_symbolic_link,
+	  METH_NOARGS,
+	  "is_symbolic_link() -> Boolean\n"
+	  "\n"
+	  "Determines if the directory entry refers to a symbolic link.\n"
+	  "The inode is only read if the directory does not record the file type." },
+
+	{ "get_file_entry",
+	  (PyCFunction) pyfsxfs_directory_entry_get_file_entry,
+	  METH_NOARGS,
+	  "get_file_entry() -> Object\n"
+	  "\n"
+	  "Retrieves the file entry, which reads the inode." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsxfs_directory_entry_object_get_set_definitions[] = {
+
+	{ "name",
+	  (getter) pyfsxfs_directory_entry_get_name,
+	  (setter) 0,
+	  "The name.",
+	  NULL },
+
+	{ "inode_number",
+	  (getter) pyfsxfs_directory_entry_get_inode_number,
+	  (setter) 0,
+	  "The inode number.",
+	  NULL },
+
+	{ "file_type",
+	  (getter) pyfsxfs_directory_entry_get_file_type,
+	  (setter) 0,
+	  "The file type as recorded by the directory.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyfsxfs_directory_entry_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsxfs.directory_entry",
+	/* tp_basicsize */
+	sizeof( pyfsxfs_directory_entry_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsxfs_directory_entry_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsxfs directory entry object (name, inode number and file type of a sub file entry)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsxfs_directory_entry_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsxfs_directory_entry_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsxfs_directory_entry_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new directory entry object
+ * The inode of the sub file entry is not read
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_new(
+           PyObject *parent_object,
+           int sub_file_entry_index )
+{
+	pyfsxfs_directory_entry_t *pyfsxfs_directory_entry = NULL;
+	static char *function                              = "pyfsxfs_directory_entry_new";
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyfsxfs_directory_entry = PyObject_New(
+	                           struct pyfsxfs_directory_entry,
+	                           &pyfsxfs_directory_entry_type_object );
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize directory entry.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsxfs_directory_entry->parent_object        = parent_object;
+	pyfsxfs_directory_entry->sub_file_entry_index = sub_file_entry_index;
+
+	Py_IncRef(
+	 pyfsxfs_directory_entry->parent_object );
+
+	return( (PyObject *) pyfsxfs_directory_entry );
+}
+
+/* Initializes a directory entry object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsxfs_directory_entry_init(
+     pyfsxfs_directory_entry_t *pyfsxfs_directory_entry )
+{
+	static char *function = "pyfsxfs_directory_entry_init";
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the parent object is set to NULL
+	 */
+	pyfsxfs_directory_entry->parent_object = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of directory entry not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a directory entry object
+ */
+void pyfsxfs_directory_entry_free(
+      pyfsxfs_directory_entry_t *pyfsxfs_directory_entry )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfsxfs_directory_entry_free";
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsxfs_directory_entry );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsxfs_directory_entry->parent_object != NULL )
+	{
+		Py_DecRef(
+		 pyfsxfs_directory_entry->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsxfs_directory_entry );
+}
+
+/* Retrieves the name
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_get_name(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object           = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	uint8_t *name                     = NULL;
+	const char *errors                = NULL;
+	static char *function             = "pyfsxfs_directory_entry_get_name";
+	size_t name_size                  = 0;
+	int result                        = 0;
+
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( NULL );
+	}
+	file_entry = ( (pyfsxfs_file_entry_t *) pyfsxfs_directory_entry->parent_object )->file_entry;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_file_entry_get_utf8_sub_file_entry_name_size_by_index(
+	          file_entry,
+	          pyfsxfs_directory_entry->sub_file_entry_index,
+	          &name_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( name_size == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	name = (uint8_t *) PyMem_Malloc(
+	                    sizeof( uint8_t ) * name_size );
+
+	if( name == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_file_entry_get_utf8_sub_file_entry_name_by_index(
+	          file_entry,
+	          pyfsxfs_directory_entry->sub_file_entry_index,
+	          name,
+	          name_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8
+	 * otherwise it makes the end of string character is part
+	 * of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+			 (char *) name,
+			 (Py_ssize_t) name_size - 1,
+			 errors );
+
+	PyMem_Free(
+	 name );
+
+	return( string_object );
+
+on_error:
+	if( name != NULL )
+	{
+		PyMem_Free(
+		 name );
+	}
+	return( NULL );
+}
+
+/* Retrieves the inode number
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_get_inode_number(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsxfs_directory_entry_get_inode_number";
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_file_entry_get_sub_file_entry_inode_number_by_index(
+	          ( (pyfsxfs_file_entry_t *) pyfsxfs_directory_entry->parent_object )->file_entry,
+	          pyfsxfs_directory_entry->sub_file_entry_index,
+	          &value_64bit,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsxfs_integer_unsigned_new_from_64bit(
+	                  value_64bit );
+
+	return( integer_object );
+}
+
+/* Retrieves the file type value
+ * If the directory does not record the file type and read_inode is set
+ * the file type is determined from the file mode of the inode
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int pyfsxfs_directory_entry_get_file_type_value(
+     pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+     uint8_t read_inode,
+     uint16_t *file_type )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *file_entry     = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "pyfsxfs_directory_entry_get_file_type_value";
+	uint16_t file_mode                    = 0;
+	int result                            = 0;
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry = ( (pyfsxfs_file_entry_t *) pyfsxfs_directory_entry->parent_object )->file_entry;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+	          file_entry,
+	          pyfsxfs_directory_entry->sub_file_entry_index,
+	          file_type,
+	          &error );
+
+	if( ( result == 0 )
+	 && ( read_inode != 0 ) )
+	{
+		result = libfsxfs_file_entry_get_sub_file_entry_by_index(
+		          file_entry,
+		          pyfsxfs_directory_entry->sub_file_entry_index,
+		          &sub_file_entry,
+		          &error );
+
+		if( result == 1 )
+		{
+			result = libfsxfs_file_entry_get_file_mode(
+			          sub_file_entry,
+			          &file_mode,
+			          &error );
+		}
+		if( sub_file_entry != NULL )
+		{
+			if( libfsxfs_file_entry_free(
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		*file_type = file_mode & 0xf000;
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the file type as recorded by the directory
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_get_file_type(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	uint16_t file_type       = 0;
+	int result               = 0;
+
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	result = pyfsxfs_directory_entry_get_file_type_value(
+	          pyfsxfs_directory_entry,
+	          0,
+	          &file_type );
+
+	if( result == -1 )
+	{
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) file_type );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) file_type );
+#endif
+	return( integer_object );
+}
+
+/* Determines if the directory entry refers to a specific file type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_is_file_type(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           uint16_t file_type )
+{
+	uint16_t entry_file_type = 0;
+	int result               = 0;
+
+	result = pyfsxfs_directory_entry_get_file_type_value(
+	          pyfsxfs_directory_entry,
+	          1,
+	          &entry_file_type );
+
+	if( result == -1 )
+	{
+		return( NULL );
+	}
+	if( ( result != 0 )
+	 && ( entry_file_type == file_type ) )
+	{
+		Py_IncRef(
+		 (PyObject *) Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 (PyObject *) Py_False );
+
+	return( Py_False );
+}
+
+/* Determines if the directory entry refers to a directory
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_is_directory(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyfsxfs_directory_entry_is_file_type(
+	         pyfsxfs_directory_entry,
+	         LIBFSXFS_FILE_TYPE_DIRECTORY ) );
+}
+
+/* Determines if the directory entry refers to a regular file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_is_file(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyfsxfs_directory_entry_is_file_type(
+	         pyfsxfs_directory_entry,
+	         LIBFSXFS_FILE_TYPE_REGULAR_FILE ) );
+}
+
+/* Determines if the directory entry refers to a symbolic link
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_is_symbolic_link(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyfsxfs_directory_entry_is_file_type(
+	         pyfsxfs_directory_entry,
+	         LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK ) );
+}
+
+/* Retrieves the file entry
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_directory_entry_get_file_entry(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyfsxfs_directory_entry_get_file_entry";
+
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsxfs_directory_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( NULL );
+	}
+	return( pyfsxfs_file_entry_get_sub_file_entry_by_index(
+	         pyfsxfs_directory_entry->parent_object,
+	         pyfsxfs_directory_entry->sub_file_entry_index ) );
+}
+
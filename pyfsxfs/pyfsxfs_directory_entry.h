@@ -0,0 +1,107 @@
+/*
+ * Python object definition of a directory entry of a file entry
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSXFS_DIRECTORY_ENTRY_H )
+#define _PYFSXFS_DIRECTORY_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsxfs_libfsxfs.h"
+#include "pyfsxfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsxfs_directory_entry pyfsxfs_directory_entry_t;
+
+struct pyfsxfs_directory_entry
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent (directory file entry) object
+	 */
+	PyObject *parent_object;
+
+	/* The sub file entry index
+	 */
+	int sub_file_entry_index;
+};
+
+extern PyMethodDef pyfsxfs_directory_entry_object_methods[];
+extern PyTypeObject pyfsxfs_directory_entry_type_object;
+
+PyObject *pyfsxfs_directory_entry_new(
+           PyObject *parent_object,
+           int sub_file_entry_index );
+
+int pyfsxfs_directory_entry_init(
+     pyfsxfs_directory_entry_t *pyfsxfs_directory_entry );
+
+void pyfsxfs_directory_entry_free(
+      pyfsxfs_directory_entry_t *pyfsxfs_directory_entry );
+
+PyObject *pyfsxfs_directory_entry_get_name(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+PyObject *pyfsxfs_directory_entry_get_inode_number(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+int pyfsxfs_directory_entry_get_file_type_value(
+     pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+     uint8_t read_inode,
+     uint16_t *file_type );
+
+PyObject *pyfsxfs_directory_entry_get_file_type(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+PyObject *pyfsxfs_directory_entry_is_file_type(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           uint16_t file_type );
+
+PyObject *pyfsxfs_directory_entry_is_directory(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+PyObject *pyfsxfs_directory_entry_is_file(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+PyObject *pyfsxfs_directory_entry_is_symbolic_link(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+PyObject *pyfsxfs_directory_entry_get_file_entry(
+           pyfsxfs_directory_entry_t *pyfsxfs_directory_entry,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSXFS_DIRECTORY_ENTRY_H ) */
+
@@ -28,6 +28,8 @@
 #endif
 
 #include "pyfsxfs_datetime.h"
+#include "pyfsxfs_directory_entries.h"
+#include "pyfsxfs_directory_entry.h"
 #include "pyfsxfs_error.h"
 #include "pyfsxfs_file_entries.h"
 #include "pyfsxfs_file_entry.h"
@@ -158,6 +160,15 @@ PyMethodDef pyfsxfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Retrieves the sub file entry for an UTF-8 encoded name specified by the name." },
 
+	{ "scandir",
+	  (PyCFunction) pyfsxfs_file_entry_scandir,
+	  METH_NOARGS,
+	  "scandir() -> Object\n"
+	  "\n"
+	  "Retrieves a sequence and iterator object of the directory entries.\n"
+	  "The inodes of the sub file entries are not read until the file entry\n"
+	  "of a directory entry is retrieved." },
+
 	{ "read_buffer",
 	  (PyCFunction) pyfsxfs_file_entry_read_buffer,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -172,6 +183,14 @@ PyMethodDef pyfsxfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_buffer_into",
+	  (PyCFunction) pyfsxfs_file_entry_read_buffer_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_buffer_into(buffer, offset=None) -> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer at the current offset or at a specific offset\n"
+	  "and returns the number of bytes read." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsxfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -193,6 +212,13 @@ PyMethodDef pyfsxfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at the current offset." },
 
+	{ "readinto",
+	  (PyCFunction) pyfsxfs_file_entry_readinto,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "readinto(buffer) -> Integer\n"
+	  "\n"
+	  "Reads data into a writable buffer at the current offset and returns the number of bytes read." },
+
 	{ "seek",
 	  (PyCFunction) pyfsxfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -1639,6 +1665,72 @@ PyObject *pyfsxfs_file_entry_get_sub_file_entries(
 	return( sequence_object );
 }
 
+/* Retrieves a sequence and iterator object for the directory entries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_file_entry_scandir(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments PYFSXFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object      = NULL;
+	libcerror_error_t *error       = NULL;
+	static char *function          = "pyfsxfs_file_entry_scandir";
+	int number_of_sub_file_entries = 0;
+	int result                     = 0;
+
+	PYFSXFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsxfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	/* The directory blocks are decoded when the number of sub file entries is first retrieved
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_file_entry_get_number_of_sub_file_entries(
+	          pyfsxfs_file_entry->file_entry,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyfsxfs_directory_entries_new(
+	                   (PyObject *) pyfsxfs_file_entry,
+	                   &pyfsxfs_directory_entry_new,
+	                   number_of_sub_file_entries );
+
+	if( sequence_object == NULL )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
 /* Retrieves the sub file entry for an UTF-8 encoded name specified by the name
  * Returns a Python object if successful or NULL on error
  */
@@ -2162,6 +2254,191 @@ PyObject *pyfsxfs_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data into a caller provided writable buffer object
+ * The data is read at the current offset if the read offset is -1
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_file_entry_read_buffer_into_object(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *buffer_object,
+           int64_t read_offset )
+{
+	Py_buffer buffer_view;
+
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsxfs_file_entry_read_buffer_into_object";
+	ssize_t read_count       = 0;
+
+	if( pyfsxfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	/* The buffer must be writable and C contiguous so that it can be filled directly
+	 */
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer_view,
+	     PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS ) != 0 )
+	{
+		return( NULL );
+	}
+	if( buffer_view.len > (Py_ssize_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		PyBuffer_Release(
+		 &buffer_view );
+
+		return( NULL );
+	}
+	if( buffer_view.len > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		if( read_offset >= 0 )
+		{
+			read_count = libfsxfs_file_entry_read_buffer_at_offset(
+			              pyfsxfs_file_entry->file_entry,
+			              (uint8_t *) buffer_view.buf,
+			              (size_t) buffer_view.len,
+			              (off64_t) read_offset,
+			              &error );
+		}
+		else
+		{
+			read_count = libfsxfs_file_entry_read_buffer(
+			              pyfsxfs_file_entry->file_entry,
+			              (uint8_t *) buffer_view.buf,
+			              (size_t) buffer_view.len,
+			              &error );
+		}
+		Py_END_ALLOW_THREADS
+	}
+	PyBuffer_Release(
+	 &buffer_view );
+
+	if( read_count == -1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsxfs_integer_signed_new_from_64bit(
+	                  (int64_t) read_count );
+
+	return( integer_object );
+}
+
+/* Reads data into a caller provided writable buffer
+ * The data is read at the current offset or at the offset if specified
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_file_entry_read_buffer_into(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	PyObject *offset_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsxfs_file_entry_read_buffer_into";
+	static char *keyword_list[] = { "buffer", "offset", NULL };
+	int64_t read_offset         = -1;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|O",
+	     keyword_list,
+	     &buffer_object,
+	     &offset_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( offset_object != NULL )
+	 && ( offset_object != Py_None ) )
+	{
+		if( pyfsxfs_integer_signed_copy_to_64bit(
+		     offset_object,
+		     &read_offset,
+		     &error ) != 1 )
+		{
+			pyfsxfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert integer object into read offset.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+		if( read_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid read offset value less than zero.",
+			 function );
+
+			return( NULL );
+		}
+	}
+	integer_object = pyfsxfs_file_entry_read_buffer_into_object(
+	                  pyfsxfs_file_entry,
+	                  buffer_object,
+	                  read_offset );
+
+	return( integer_object );
+}
+
+/* Reads data into a caller provided writable buffer at the current offset
+ * Implements the readinto method of the io.RawIOBase interface, hence it only takes the buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_file_entry_readinto(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffer_object     = NULL;
+	PyObject *integer_object    = NULL;
+	static char *keyword_list[] = { "buffer", NULL };
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	integer_object = pyfsxfs_file_entry_read_buffer_into_object(
+	                  pyfsxfs_file_entry,
+	                  buffer_object,
+	                  -1 );
+
+	return( integer_object );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -135,6 +135,10 @@ PyObject *pyfsxfs_file_entry_get_sub_file_entries(
            pyfsxfs_file_entry_t *pyfsxfs_file_entry,
            PyObject *arguments );
 
+PyObject *pyfsxfs_file_entry_scandir(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments );
+
 PyObject *pyfsxfs_file_entry_get_sub_file_entry_by_name(
            pyfsxfs_file_entry_t *pyfsxfs_file_entry,
            PyObject *arguments,
@@ -150,6 +154,21 @@ PyObject *pyfsxfs_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsxfs_file_entry_read_buffer_into_object(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *buffer_object,
+           int64_t read_offset );
+
+PyObject *pyfsxfs_file_entry_read_buffer_into(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsxfs_file_entry_readinto(
+           pyfsxfs_file_entry_t *pyfsxfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsxfs_file_entry_seek_offset(
            pyfsxfs_file_entry_t *pyfsxfs_file_entry,
            PyObject *arguments,
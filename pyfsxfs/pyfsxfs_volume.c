@@ -36,6 +36,7 @@
 #include "pyfsxfs_python.h"
 #include "pyfsxfs_unused.h"
 #include "pyfsxfs_volume.h"
+#include "pyfsxfs_walk.h"
 
 #if !defined( LIBFSXFS_HAVE_BFIO )
 
@@ -92,6 +93,13 @@ PyMethodDef pyfsxfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the file entry specified by the inode number." },
 
+	{ "get_file_entry_by_offset",
+	  (PyCFunction) pyfsxfs_volume_get_file_entry_by_offset,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_file_entry_by_offset(offset) -> Object or None\n"
+	  "\n"
+	  "Retrieves the file entry that owns the data at the volume offset." },
+
 	{ "get_root_directory",
 	  (PyCFunction) pyfsxfs_volume_get_root_directory,
 	  METH_NOARGS,
@@ -106,6 +114,15 @@ PyMethodDef pyfsxfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the file entry for an UTF-8 encoded path specified by the path." },
 
+	{ "walk",
+	  (PyCFunction) pyfsxfs_volume_walk,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "walk(top='/') -> Object\n"
+	  "\n"
+	  "Retrieves an iterator that walks the directory tree starting at the UTF-8 encoded path specified by top.\n"
+	  "For every directory it returns a (path, directory names, file names) tuple, parent directories before their sub directories.\n"
+	  "The directory entries are read without holding the GIL." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -1009,6 +1026,96 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the file entry that owns a specific volume offset
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_volume_get_file_entry_by_offset(
+           pyfsxfs_volume_t *pyfsxfs_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *file_entry_object       = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	static char *function             = "pyfsxfs_volume_get_file_entry_by_offset";
+	static char *keyword_list[]       = { "offset", NULL };
+	off64_t offset                    = 0;
+	int result                        = 0;
+
+	if( pyfsxfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "L",
+	     keyword_list,
+	     &offset ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_volume_get_file_entry_by_offset(
+	          ( (pyfsxfs_volume_t *) pyfsxfs_volume )->volume,
+	          offset,
+	          &file_entry,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file entry of offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	file_entry_object = pyfsxfs_file_entry_new(
+	                     file_entry,
+	                     (PyObject *) pyfsxfs_volume );
+
+	if( file_entry_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file entry object.",
+		 function );
+
+		goto on_error;
+	}
+	return( file_entry_object );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( NULL );
+}
+
 /* Retrieves the root directory file entry
  * Returns a Python object if successful or NULL on error
  */
@@ -1181,3 +1288,129 @@ on_error:
 	return( NULL );
 }
 
+/* Walks the directory tree
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_volume_walk(
+           pyfsxfs_volume_t *pyfsxfs_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *walk_object             = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_file_entry_t *file_entry = NULL;
+	static char *function             = "pyfsxfs_volume_walk";
+	static char *keyword_list[]       = { "top", NULL };
+	char *utf8_path                   = "/";
+	size_t utf8_path_length           = 0;
+	uint64_t inode_number             = 0;
+	uint16_t file_mode                = 0;
+	int result                        = 0;
+
+	if( pyfsxfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|s",
+	     keyword_list,
+	     &utf8_path ) == 0 )
+	{
+		goto on_error;
+	}
+	utf8_path_length = narrow_string_length(
+	                    utf8_path );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsxfs_volume_get_file_entry_by_utf8_path(
+	          pyfsxfs_volume->volume,
+	          (uint8_t *) utf8_path,
+	          utf8_path_length,
+	          &file_entry,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libfsxfs_file_entry_get_inode_number(
+		          file_entry,
+		          &inode_number,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libfsxfs_file_entry_get_file_mode(
+		          file_entry,
+		          &file_mode,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file entry for an UTF-8 encoded path.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( ( file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid top value not a directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to free file entry.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	walk_object = pyfsxfs_walk_new(
+	               (PyObject *) pyfsxfs_volume,
+	               pyfsxfs_volume->volume,
+	               (uint8_t *) utf8_path,
+	               utf8_path_length,
+	               inode_number );
+
+	if( walk_object == NULL )
+	{
+		goto on_error;
+	}
+	return( walk_object );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( NULL );
+}
+
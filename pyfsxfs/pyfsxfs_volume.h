@@ -86,6 +86,11 @@ PyObject *pyfsxfs_volume_get_file_entry_by_inode(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsxfs_volume_get_file_entry_by_offset(
+           pyfsxfs_volume_t *pyfsxfs_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsxfs_volume_get_root_directory(
            pyfsxfs_volume_t *pyfsxfs_volume,
            PyObject *arguments );
@@ -95,6 +100,11 @@ PyObject *pyfsxfs_volume_get_file_entry_by_path(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsxfs_volume_walk(
+           pyfsxfs_volume_t *pyfsxfs_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
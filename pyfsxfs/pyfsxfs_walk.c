@@ -0,0 +1,1212 @@
+/*
+ * Python object definition of the volume walk iterator
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsxfs_error.h"
+#include "pyfsxfs_libcerror.h"
+#include "pyfsxfs_libfsxfs.h"
+#include "pyfsxfs_python.h"
+#include "pyfsxfs_walk.h"
+
+PyTypeObject pyfsxfs_walk_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsxfs.walk",
+	/* tp_basicsize */
+	sizeof( pyfsxfs_walk_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsxfs_walk_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyfsxfs iterator object of a volume walk",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyfsxfs_walk_iter,
+	/* tp_iternext */
+	(iternextfunc) pyfsxfs_walk_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsxfs_walk_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new walk iterator object
+ * The walk starts at the directory with the inode number, which is reported as the UTF-8 encoded path
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsxfs_walk_new(
+           PyObject *parent_object,
+           libfsxfs_volume_t *volume,
+           const uint8_t *utf8_path,
+           size_t utf8_path_length,
+           uint64_t inode_number )
+{
+	libcerror_error_t *error     = NULL;
+	pyfsxfs_walk_t *pyfsxfs_walk = NULL;
+	uint8_t *path                = NULL;
+	static char *function        = "pyfsxfs_walk_new";
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( utf8_path == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( NULL );
+	}
+	if( utf8_path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid UTF-8 path length value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+	/* Make sure the walk values are initialized
+	 */
+	pyfsxfs_walk = PyObject_New(
+	                struct pyfsxfs_walk,
+	                &pyfsxfs_walk_type_object );
+
+	if( pyfsxfs_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create walk object.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsxfs_walk->parent_object                   = parent_object;
+	pyfsxfs_walk->volume                          = volume;
+	pyfsxfs_walk->directories                     = NULL;
+	pyfsxfs_walk->number_of_directories           = 0;
+	pyfsxfs_walk->number_of_allocated_directories = 0;
+
+	Py_IncRef(
+	 (PyObject *) pyfsxfs_walk->parent_object );
+
+	path = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( utf8_path_length + 1 ) );
+
+	if( path == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_path_length > 0 )
+	{
+		if( memory_copy(
+		     path,
+		     utf8_path,
+		     utf8_path_length ) == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	path[ utf8_path_length ] = 0;
+
+	if( pyfsxfs_walk_push_directory(
+	     pyfsxfs_walk,
+	     path,
+	     utf8_path_length + 1,
+	     inode_number,
+	     &error ) != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to push directory.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( (PyObject *) pyfsxfs_walk );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( pyfsxfs_walk != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsxfs_walk );
+	}
+	return( NULL );
+}
+
+/* Initializes a walk iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsxfs_walk_init(
+     pyfsxfs_walk_t *pyfsxfs_walk )
+{
+	static char *function = "pyfsxfs_walk_init";
+
+	if( pyfsxfs_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the walk values are initialized
+	 */
+	pyfsxfs_walk->parent_object                   = NULL;
+	pyfsxfs_walk->volume                          = NULL;
+	pyfsxfs_walk->directories                     = NULL;
+	pyfsxfs_walk->number_of_directories           = 0;
+	pyfsxfs_walk->number_of_allocated_directories = 0;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of walk not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a walk iterator object
+ */
+void pyfsxfs_walk_free(
+      pyfsxfs_walk_t *pyfsxfs_walk )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfsxfs_walk_free";
+
+	if( pyfsxfs_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsxfs_walk );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsxfs_walk->directories != NULL )
+	{
+		pyfsxfs_walk_free_entries(
+		 pyfsxfs_walk->directories,
+		 pyfsxfs_walk->number_of_directories );
+
+		pyfsxfs_walk->directories = NULL;
+	}
+	if( pyfsxfs_walk->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsxfs_walk->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsxfs_walk );
+}
+
+/* Frees an array of walk entries and their names
+ */
+void pyfsxfs_walk_free_entries(
+      pyfsxfs_walk_entry_t *entries,
+      int number_of_entries )
+{
+	int entry_index = 0;
+
+	if( entries == NULL )
+	{
+		return;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entries[ entry_index ].name != NULL )
+		{
+			memory_free(
+			 entries[ entry_index ].name );
+		}
+	}
+	memory_free(
+	 entries );
+}
+
+/* Pushes a directory onto the stack of directories that remain to be walked
+ * On success the walk takes ownership of the path
+ * This function does not use the Python API and can be called without the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsxfs_walk_push_directory(
+     pyfsxfs_walk_t *pyfsxfs_walk,
+     uint8_t *path,
+     size_t path_size,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	pyfsxfs_walk_entry_t *directories   = NULL;
+	static char *function               = "pyfsxfs_walk_push_directory";
+	size_t directories_size             = 0;
+	int number_of_allocated_directories = 0;
+
+	if( pyfsxfs_walk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid walk.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyfsxfs_walk->number_of_directories >= pyfsxfs_walk->number_of_allocated_directories )
+	{
+		if( pyfsxfs_walk->number_of_allocated_directories == 0 )
+		{
+			number_of_allocated_directories = 16;
+		}
+		else
+		{
+			if( pyfsxfs_walk->number_of_allocated_directories > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of allocated directories value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_directories = pyfsxfs_walk->number_of_allocated_directories * 2;
+		}
+		directories_size = sizeof( pyfsxfs_walk_entry_t ) * number_of_allocated_directories;
+
+		if( directories_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid directories size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		directories = (pyfsxfs_walk_entry_t *) memory_reallocate(
+		                                        pyfsxfs_walk->directories,
+		                                        directories_size );
+
+		if( directories == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize directories.",
+			 function );
+
+			return( -1 );
+		}
+		pyfsxfs_walk->directories                     = directories;
+		pyfsxfs_walk->number_of_allocated_directories = number_of_allocated_directories;
+	}
+	directories = &( pyfsxfs_walk->directories[ pyfsxfs_walk->number_of_directories ] );
+
+	directories->name         = path;
+	directories->name_size    = path_size;
+	directories->inode_number = inode_number;
+	directories->is_directory = 1;
+
+	pyfsxfs_walk->number_of_directories += 1;
+
+	return( 1 );
+}
+
+/* Reads the names, inode numbers and types of the entries of a directory
+ * This function does not use the Python API and can be called without the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsxfs_walk_read_directory(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     pyfsxfs_walk_entry_t **entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *file_entry     = NULL;
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	pyfsxfs_walk_entry_t *safe_entries    = NULL;
+	static char *function                 = "pyfsxfs_walk_read_directory";
+	size_t entries_size                   = 0;
+	uint16_t file_mode                    = 0;
+	uint16_t file_type                    = 0;
+	int entry_index                       = 0;
+	int number_of_sub_file_entries        = 0;
+	int result                            = 0;
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_get_file_entry_by_inode(
+	     volume,
+	     inode_number,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_file_entries > 0 )
+	{
+		entries_size = sizeof( pyfsxfs_walk_entry_t ) * number_of_sub_file_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		safe_entries = (pyfsxfs_walk_entry_t *) memory_allocate(
+		                                         entries_size );
+
+		if( safe_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_entries,
+		     0,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			memory_free(
+			 safe_entries );
+
+			safe_entries = NULL;
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_sub_file_entries;
+	     entry_index++ )
+	{
+		if( libfsxfs_file_entry_get_utf8_sub_file_entry_name_size_by_index(
+		     file_entry,
+		     entry_index,
+		     &( safe_entries[ entry_index ].name_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d UTF-8 name size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( safe_entries[ entry_index ].name_size == 0 )
+		 || ( safe_entries[ entry_index ].name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub file entry: %d UTF-8 name size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		safe_entries[ entry_index ].name = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * safe_entries[ entry_index ].name_size );
+
+		if( safe_entries[ entry_index ].name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub file entry: %d name.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_get_utf8_sub_file_entry_name_by_index(
+		     file_entry,
+		     entry_index,
+		     safe_entries[ entry_index ].name,
+		     safe_entries[ entry_index ].name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d UTF-8 name.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_get_sub_file_entry_inode_number_by_index(
+		     file_entry,
+		     entry_index,
+		     &( safe_entries[ entry_index ].inode_number ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d inode number.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		result = libfsxfs_file_entry_get_sub_file_entry_file_type_by_index(
+		          file_entry,
+		          entry_index,
+		          &file_type,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d file type.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The directory entry does not record the file type, read it from the inode
+			 */
+			if( libfsxfs_file_entry_get_sub_file_entry_by_index(
+			     file_entry,
+			     entry_index,
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_entry_get_file_mode(
+			     sub_file_entry,
+			     &file_mode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d file mode.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsxfs_file_entry_free(
+			     &sub_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			file_type = file_mode & 0xf000;
+		}
+		if( file_type == LIBFSXFS_FILE_TYPE_DIRECTORY )
+		{
+			safe_entries[ entry_index ].is_directory = 1;
+		}
+	}
+	if( libfsxfs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	*entries           = safe_entries;
+	*number_of_entries = number_of_sub_file_entries;
+
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( safe_entries != NULL )
+	{
+		pyfsxfs_walk_free_entries(
+		 safe_entries,
+		 number_of_sub_file_entries );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pushes the sub directories of a directory onto the stack of directories that remain to be walked
+ * The sub directories are pushed in reverse order so that they are walked in directory order
+ * This function does not use the Python API and can be called without the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsxfs_walk_push_sub_directories(
+     pyfsxfs_walk_t *pyfsxfs_walk,
+     const uint8_t *path,
+     size_t path_size,
+     pyfsxfs_walk_entry_t *entries,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	uint8_t *sub_path     = NULL;
+	static char *function = "pyfsxfs_walk_push_sub_directories";
+	size_t path_length    = 0;
+	size_t sub_path_index = 0;
+	size_t sub_path_size  = 0;
+	uint8_t add_separator = 0;
+	int entry_index       = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_size == 0 )
+	 || ( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entries == NULL )
+	 && ( number_of_entries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = path_size - 1;
+
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] != (uint8_t) '/' ) )
+	{
+		add_separator = 1;
+	}
+	for( entry_index = number_of_entries - 1;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		if( entries[ entry_index ].is_directory == 0 )
+		{
+			continue;
+		}
+		sub_path_size = path_length + add_separator + entries[ entry_index ].name_size;
+
+		sub_path = (uint8_t *) memory_allocate(
+		                        sizeof( uint8_t ) * sub_path_size );
+
+		if( sub_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub path.",
+			 function );
+
+			goto on_error;
+		}
+		sub_path_index = 0;
+
+		if( path_length > 0 )
+		{
+			if( memory_copy(
+			     sub_path,
+			     path,
+			     path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy path.",
+				 function );
+
+				goto on_error;
+			}
+			sub_path_index = path_length;
+		}
+		if( add_separator != 0 )
+		{
+			sub_path[ sub_path_index++ ] = (uint8_t) '/';
+		}
+		if( memory_copy(
+		     &( sub_path[ sub_path_index ] ),
+		     entries[ entry_index ].name,
+		     entries[ entry_index ].name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			goto on_error;
+		}
+		if( pyfsxfs_walk_push_directory(
+		     pyfsxfs_walk,
+		     sub_path,
+		     sub_path_size,
+		     entries[ entry_index ].inode_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push sub directory: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		sub_path = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
+	return( -1 );
+}
+
+/* The walk iter() function
+ */
+PyObject *pyfsxfs_walk_iter(
+           pyfsxfs_walk_t *pyfsxfs_walk )
+{
+	static char *function = "pyfsxfs_walk_iter";
+
+	if( pyfsxfs_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsxfs_walk );
+
+	return( (PyObject *) pyfsxfs_walk );
+}
+
+/* The walk iternext() function
+ * Returns a (path, directory names, file names) tuple for the next directory
+ */
+PyObject *pyfsxfs_walk_iternext(
+           pyfsxfs_walk_t *pyfsxfs_walk )
+{
+	PyObject *directory_names_object = NULL;
+	PyObject *file_names_object      = NULL;
+	PyObject *name_object            = NULL;
+	PyObject *path_object            = NULL;
+	PyObject *tuple_object           = NULL;
+	libcerror_error_t *error         = NULL;
+	pyfsxfs_walk_entry_t *entries    = NULL;
+	pyfsxfs_walk_entry_t directory;
+	static char *function            = "pyfsxfs_walk_iternext";
+	int entry_index                  = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+
+	if( pyfsxfs_walk == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid walk.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsxfs_walk->number_of_directories <= 0 )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	pyfsxfs_walk->number_of_directories -= 1;
+
+	directory = pyfsxfs_walk->directories[ pyfsxfs_walk->number_of_directories ];
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = pyfsxfs_walk_read_directory(
+	          pyfsxfs_walk->volume,
+	          directory.inode_number,
+	          &entries,
+	          &number_of_entries,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = pyfsxfs_walk_push_sub_directories(
+		          pyfsxfs_walk,
+		          directory.name,
+		          directory.name_size,
+		          entries,
+		          number_of_entries,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsxfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to walk directory: %" PRIu64 ".",
+		 function,
+		 directory.inode_number );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	path_object = PyUnicode_DecodeUTF8(
+	               (char *) directory.name,
+	               (Py_ssize_t) directory.name_size - 1,
+	               NULL );
+
+	if( path_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 path into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	directory_names_object = PyList_New(
+	                          0 );
+
+	if( directory_names_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create directory names list.",
+		 function );
+
+		goto on_error;
+	}
+	file_names_object = PyList_New(
+	                     0 );
+
+	if( file_names_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file names list.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		/* Pass the string length to PyUnicode_DecodeUTF8
+		 * otherwise it makes the end of string character is part
+		 * of the string
+		 */
+		name_object = PyUnicode_DecodeUTF8(
+		               (char *) entries[ entry_index ].name,
+		               (Py_ssize_t) entries[ entry_index ].name_size - 1,
+		               NULL );
+
+		if( name_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to convert UTF-8 name: %d into Unicode object.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( entries[ entry_index ].is_directory != 0 )
+		{
+			result = PyList_Append(
+			          directory_names_object,
+			          name_object );
+		}
+		else
+		{
+			result = PyList_Append(
+			          file_names_object,
+			          name_object );
+		}
+		Py_DecRef(
+		 name_object );
+
+		name_object = NULL;
+
+		if( result != 0 )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to append name: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	tuple_object = PyTuple_New(
+	                3 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple.",
+		 function );
+
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 path_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 directory_names_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 2,
+	 file_names_object );
+
+	pyfsxfs_walk_free_entries(
+	 entries,
+	 number_of_entries );
+
+	memory_free(
+	 directory.name );
+
+	return( tuple_object );
+
+on_error:
+	if( file_names_object != NULL )
+	{
+		Py_DecRef(
+		 file_names_object );
+	}
+	if( directory_names_object != NULL )
+	{
+		Py_DecRef(
+		 directory_names_object );
+	}
+	if( path_object != NULL )
+	{
+		Py_DecRef(
+		 path_object );
+	}
+	if( entries != NULL )
+	{
+		pyfsxfs_walk_free_entries(
+		 entries,
+		 number_of_entries );
+	}
+	if( directory.name != NULL )
+	{
+		memory_free(
+		 directory.name );
+	}
+	return( NULL );
+}
+
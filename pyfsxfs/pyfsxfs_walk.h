@@ -0,0 +1,138 @@
+/*
+ * Python object definition of the volume walk iterator
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSXFS_WALK_H )
+#define _PYFSXFS_WALK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsxfs_libcerror.h"
+#include "pyfsxfs_libfsxfs.h"
+#include "pyfsxfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsxfs_walk_entry pyfsxfs_walk_entry_t;
+
+struct pyfsxfs_walk_entry
+{
+	/* The UTF-8 encoded name or path
+	 */
+	uint8_t *name;
+
+	/* The name size including the end-of-string character
+	 */
+	size_t name_size;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* Value to indicate the entry is a directory
+	 */
+	uint8_t is_directory;
+};
+
+typedef struct pyfsxfs_walk pyfsxfs_walk_t;
+
+struct pyfsxfs_walk
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent (volume) object
+	 */
+	PyObject *parent_object;
+
+	/* The libfsxfs volume
+	 */
+	libfsxfs_volume_t *volume;
+
+	/* The directories that remain to be walked
+	 */
+	pyfsxfs_walk_entry_t *directories;
+
+	/* The number of directories that remain to be walked
+	 */
+	int number_of_directories;
+
+	/* The number of allocated directories
+	 */
+	int number_of_allocated_directories;
+};
+
+extern PyTypeObject pyfsxfs_walk_type_object;
+
+PyObject *pyfsxfs_walk_new(
+           PyObject *parent_object,
+           libfsxfs_volume_t *volume,
+           const uint8_t *utf8_path,
+           size_t utf8_path_length,
+           uint64_t inode_number );
+
+int pyfsxfs_walk_init(
+     pyfsxfs_walk_t *pyfsxfs_walk );
+
+void pyfsxfs_walk_free(
+      pyfsxfs_walk_t *pyfsxfs_walk );
+
+void pyfsxfs_walk_free_entries(
+      pyfsxfs_walk_entry_t *entries,
+      int number_of_entries );
+
+int pyfsxfs_walk_push_directory(
+     pyfsxfs_walk_t *pyfsxfs_walk,
+     uint8_t *path,
+     size_t path_size,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int pyfsxfs_walk_read_directory(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     pyfsxfs_walk_entry_t **entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int pyfsxfs_walk_push_sub_directories(
+     pyfsxfs_walk_t *pyfsxfs_walk,
+     const uint8_t *path,
+     size_t path_size,
+     pyfsxfs_walk_entry_t *entries,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+PyObject *pyfsxfs_walk_iter(
+           pyfsxfs_walk_t *pyfsxfs_walk );
+
+PyObject *pyfsxfs_walk_iternext(
+           pyfsxfs_walk_t *pyfsxfs_walk );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSXFS_WALK_H ) */
+
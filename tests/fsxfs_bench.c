@@ -0,0 +1,1431 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_TIME_H ) || defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+
+/* The default number of iterations of each workload
+ */
+#define FSXFS_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	16
+
+/* The size of the buffer used by the sequential reads
+ */
+#define FSXFS_BENCH_SEQUENTIAL_READ_SIZE		65536
+
+/* The size of the buffer used by the random reads
+ */
+#define FSXFS_BENCH_RANDOM_READ_SIZE			4096
+
+/* The number of random reads per iteration
+ */
+#define FSXFS_BENCH_NUMBER_OF_RANDOM_READS		1024
+
+typedef struct fsxfs_bench_result fsxfs_bench_result_t;
+
+struct fsxfs_bench_result
+{
+	/* The workload name
+	 */
+	const char *name;
+
+	/* The number of iterations
+	 */
+	uint32_t number_of_iterations;
+
+	/* The total elapsed time in nanoseconds
+	 */
+	uint64_t total_time;
+
+	/* The minimum elapsed time of an iteration in nanoseconds
+	 */
+	uint64_t minimum_time;
+
+	/* The maximum elapsed time of an iteration in nanoseconds
+	 */
+	uint64_t maximum_time;
+
+	/* The number of bytes processed by an iteration
+	 */
+	uint64_t number_of_bytes;
+
+	/* The number of items (entries, reads or path segments) processed by an iteration
+	 */
+	uint64_t number_of_items;
+};
+
+/* The state of the deterministic pseudo random number generator
+ */
+uint64_t fsxfs_bench_random_state = 1;
+
+/* Prints usage information
+ */
+void fsxfs_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsxfs_bench to measure the performance of libfsxfs.\n\n" );
+
+	fprintf( stream, "Usage: fsxfs_bench [ -f path ] [ -i inode_number ] [ -n iterations ]\n"
+	                 "                   [ -p path ] [ -r path ] [ -s seed ] [ -h ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file or device\n\n" );
+
+	fprintf( stream, "\t-f:     path of the file used by the read workloads\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     inode number used by the lookup workloads\n"
+	                 "\t        (default is the root directory inode)\n" );
+	fprintf( stream, "\t-n:     number of iterations of each workload (default is %d)\n",
+	         FSXFS_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+	fprintf( stream, "\t-p:     path used by the path resolution workload\n" );
+	fprintf( stream, "\t-r:     path of the directory used by the enumeration workload\n"
+	                 "\t        (default is the root directory)\n" );
+	fprintf( stream, "\t-s:     seed of the random read workload (default is 1)\n" );
+}
+
+/* Retrieves the current value of a monotonic clock in nanoseconds
+ */
+uint64_t fsxfs_bench_get_time(
+          void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000UL ) + (uint64_t) time_specification.tv_nsec );
+
+#elif defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#else
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+
+#endif
+}
+
+/* Retrieves a deterministic pseudo random number
+ */
+uint64_t fsxfs_bench_get_random(
+          void )
+{
+	/* 64-bit linear congruential generator (MMIX constants)
+	 */
+	fsxfs_bench_random_state = ( fsxfs_bench_random_state * 6364136223846793005UL ) + 1442695040888963407UL;
+
+	return( fsxfs_bench_random_state >> 16 );
+}
+
+/* Initializes a benchmark result
+ */
+void fsxfs_bench_result_initialize(
+      fsxfs_bench_result_t *result,
+      const char *name )
+{
+	result->name                 = name;
+	result->number_of_iterations = 0;
+	result->total_time           = 0;
+	result->minimum_time         = 0;
+	result->maximum_time         = 0;
+	result->number_of_bytes      = 0;
+	result->number_of_items      = 0;
+}
+
+/* Adds the elapsed time of an iteration to a benchmark result
+ */
+void fsxfs_bench_result_add_iteration(
+      fsxfs_bench_result_t *result,
+      uint64_t start_time,
+      uint64_t end_time )
+{
+	uint64_t elapsed_time = 0;
+
+	if( end_time > start_time )
+	{
+		elapsed_time = end_time - start_time;
+	}
+	if( ( result->number_of_iterations == 0 )
+	 || ( elapsed_time < result->minimum_time ) )
+	{
+		result->minimum_time = elapsed_time;
+	}
+	if( elapsed_time > result->maximum_time )
+	{
+		result->maximum_time = elapsed_time;
+	}
+	result->total_time           += elapsed_time;
+	result->number_of_iterations += 1;
+}
+
+/* Prints a benchmark result as a JSON object
+ */
+void fsxfs_bench_result_fprint(
+      fsxfs_bench_result_t *result,
+      int is_last,
+      FILE *stream )
+{
+	uint64_t mean_time = 0;
+
+	if( result->number_of_iterations > 0 )
+	{
+		mean_time = result->total_time / result->number_of_iterations;
+	}
+	fprintf( stream, "    {\n" );
+	fprintf( stream, "      \"name\": \"%s\",\n", result->name );
+	fprintf( stream, "      \"iterations\": %" PRIu32 ",\n", result->number_of_iterations );
+	fprintf( stream, "      \"total_ns\": %" PRIu64 ",\n", result->total_time );
+	fprintf( stream, "      \"min_ns\": %" PRIu64 ",\n", result->minimum_time );
+	fprintf( stream, "      \"max_ns\": %" PRIu64 ",\n", result->maximum_time );
+	fprintf( stream, "      \"mean_ns\": %" PRIu64 ",\n", mean_time );
+	fprintf( stream, "      \"bytes\": %" PRIu64 ",\n", result->number_of_bytes );
+	fprintf( stream, "      \"items\": %" PRIu64 "\n", result->number_of_items );
+
+	if( is_last == 0 )
+	{
+		fprintf( stream, "    },\n" );
+	}
+	else
+	{
+		fprintf( stream, "    }\n" );
+	}
+}
+
+/* Opens a volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_open_volume(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_bench_open_volume";
+
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsxfs_volume_open_wide(
+	     *volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsxfs_volume_open(
+	     *volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_close_volume(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_bench_close_volume";
+	int result            = 1;
+
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves a file entry by its (UTF-8) path or the root directory if no path is set
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int fsxfs_bench_get_file_entry(
+     libfsxfs_volume_t *volume,
+     const char *path,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	if( path == NULL )
+	{
+		return( libfsxfs_volume_get_root_directory(
+		         volume,
+		         file_entry,
+		         error ) );
+	}
+	return( libfsxfs_volume_get_file_entry_by_utf8_path(
+	         volume,
+	         (uint8_t *) path,
+	         narrow_string_length(
+	          path ),
+	         file_entry,
+	         error ) );
+}
+
+/* Enumerates the sub file entries of a directory recursively
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_enumerate_directory(
+     libfsxfs_file_entry_t *file_entry,
+     int recursion_depth,
+     uint64_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *sub_file_entry = NULL;
+	static char *function                 = "fsxfs_bench_enumerate_directory";
+	int number_of_sub_file_entries        = 0;
+	int sub_file_entry_index              = 0;
+
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( libfsxfs_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+		*number_of_entries += 1;
+
+		if( fsxfs_bench_enumerate_directory(
+		     sub_file_entry,
+		     recursion_depth + 1,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libfsxfs_file_entry_free(
+			 &sub_file_entry,
+			 NULL );
+
+			return( -1 );
+		}
+		if( libfsxfs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Benchmarks opening the volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_volume_open(
+     const system_character_t *source,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsxfs_volume_t *volume = NULL;
+	uint64_t start_time       = 0;
+	uint32_t iteration        = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "volume_open" );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		start_time = fsxfs_bench_get_time();
+
+		if( fsxfs_bench_open_volume(
+		     &volume,
+		     source,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		if( fsxfs_bench_close_volume(
+		     &volume,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a file entry by inode number and measures the elapsed time
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_lookup_inode(
+     libfsxfs_volume_t *volume,
+     uint64_t inode_number,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *file_entry = NULL;
+	uint64_t start_time               = 0;
+
+	start_time = fsxfs_bench_get_time();
+
+	if( libfsxfs_volume_get_file_entry_by_inode(
+	     volume,
+	     inode_number,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result != NULL )
+	{
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+	}
+	if( libfsxfs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Benchmarks retrieving a file entry by inode number
+ * A cold lookup is the first lookup on a freshly opened volume, a warm lookup
+ * is a repeated lookup on the same volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_inode_lookup(
+     const system_character_t *source,
+     uint64_t inode_number,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *cold_result,
+     fsxfs_bench_result_t *warm_result,
+     libcerror_error_t **error )
+{
+	libfsxfs_volume_t *volume = NULL;
+	uint32_t iteration        = 0;
+	int result                = 0;
+
+	fsxfs_bench_result_initialize(
+	 cold_result,
+	 "inode_lookup_cold" );
+
+	fsxfs_bench_result_initialize(
+	 warm_result,
+	 "inode_lookup_warm" );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( fsxfs_bench_open_volume(
+		     &volume,
+		     source,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		result = fsxfs_bench_lookup_inode(
+		          volume,
+		          inode_number,
+		          cold_result,
+		          error );
+
+		if( fsxfs_bench_close_volume(
+		     &volume,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	if( fsxfs_bench_open_volume(
+	     &volume,
+	     source,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The first lookup warms up the volume and is not measured
+	 */
+	result = fsxfs_bench_lookup_inode(
+	          volume,
+	          inode_number,
+	          NULL,
+	          error );
+
+	for( iteration = 0;
+	     ( result == 1 ) && ( iteration < number_of_iterations );
+	     iteration++ )
+	{
+		result = fsxfs_bench_lookup_inode(
+		          volume,
+		          inode_number,
+		          warm_result,
+		          error );
+	}
+	if( fsxfs_bench_close_volume(
+	     &volume,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Benchmarks resolving a path
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_path_resolution(
+     libfsxfs_volume_t *volume,
+     const char *path,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *file_entry = NULL;
+	static char *function             = "fsxfs_bench_path_resolution";
+	size_t path_index                 = 0;
+	uint64_t start_time               = 0;
+	uint32_t iteration                = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "path_resolution" );
+
+	/* The number of items is the depth of the path
+	 */
+	for( path_index = 0;
+	     path[ path_index ] != 0;
+	     path_index++ )
+	{
+		if( ( path[ path_index ] == '/' )
+		 && ( path[ path_index + 1 ] != '/' )
+		 && ( path[ path_index + 1 ] != 0 ) )
+		{
+			result->number_of_items += 1;
+		}
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		start_time = fsxfs_bench_get_time();
+
+		if( fsxfs_bench_get_file_entry(
+		     volume,
+		     path,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry: %s.",
+			 function,
+			 path );
+
+			return( -1 );
+		}
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		if( libfsxfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Benchmarks enumerating a directory hierarchy
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_directory_enumeration(
+     libfsxfs_volume_t *volume,
+     const char *path,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *file_entry = NULL;
+	static char *function             = "fsxfs_bench_directory_enumeration";
+	uint64_t number_of_entries        = 0;
+	uint64_t start_time               = 0;
+	uint32_t iteration                = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "directory_enumeration" );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		number_of_entries = 0;
+
+		start_time = fsxfs_bench_get_time();
+
+		if( fsxfs_bench_get_file_entry(
+		     volume,
+		     path,
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory.",
+			 function );
+
+			return( -1 );
+		}
+		if( fsxfs_bench_enumerate_directory(
+		     file_entry,
+		     0,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libfsxfs_file_entry_free(
+			 &file_entry,
+			 NULL );
+
+			return( -1 );
+		}
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		if( libfsxfs_file_entry_free(
+		     &file_entry,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		result->number_of_items = number_of_entries;
+	}
+	return( 1 );
+}
+
+/* Benchmarks decoding the inode and extent map of a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_extent_map_decode(
+     libfsxfs_volume_t *volume,
+     libfsxfs_file_entry_t *file_entry,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *decoded_file_entry = NULL;
+	static char *function                     = "fsxfs_bench_extent_map_decode";
+	uint64_t inode_number                     = 0;
+	uint64_t start_time                       = 0;
+	size64_t file_size                        = 0;
+	uint32_t iteration                        = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "extent_map_decode" );
+
+	if( libfsxfs_file_entry_get_inode_number(
+	     file_entry,
+	     &inode_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		return( -1 );
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		start_time = fsxfs_bench_get_time();
+
+		/* Retrieving the file entry reads the inode, decodes its extent
+		 * list or extent B+ tree and builds the data stream
+		 */
+		if( libfsxfs_volume_get_file_entry_by_inode(
+		     volume,
+		     inode_number,
+		     &decoded_file_entry,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfsxfs_file_entry_get_size(
+		     decoded_file_entry,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libfsxfs_file_entry_free(
+			 &decoded_file_entry,
+			 NULL );
+
+			return( -1 );
+		}
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		if( libfsxfs_file_entry_free(
+		     &decoded_file_entry,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	result->number_of_bytes = (uint64_t) file_size;
+
+	return( 1 );
+}
+
+/* Benchmarks reading a file sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_sequential_read(
+     libfsxfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	uint64_t number_of_bytes = 0;
+	uint64_t start_time      = 0;
+	ssize_t read_count       = 0;
+	uint32_t iteration       = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "sequential_read" );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		number_of_bytes = 0;
+
+		start_time = fsxfs_bench_get_time();
+
+		if( libfsxfs_file_entry_seek_offset(
+		     file_entry,
+		     0,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+		do
+		{
+			read_count = libfsxfs_file_entry_read_buffer(
+			              file_entry,
+			              buffer,
+			              FSXFS_BENCH_SEQUENTIAL_READ_SIZE,
+			              error );
+
+			if( read_count < 0 )
+			{
+				return( -1 );
+			}
+			number_of_bytes += (uint64_t) read_count;
+		}
+		while( read_count > 0 );
+
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		result->number_of_bytes = number_of_bytes;
+	}
+	return( 1 );
+}
+
+/* Benchmarks reading a file at random offsets
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_bench_random_read(
+     libfsxfs_file_entry_t *file_entry,
+     uint8_t *buffer,
+     uint64_t seed,
+     uint32_t number_of_iterations,
+     fsxfs_bench_result_t *result,
+     libcerror_error_t **error )
+{
+	static char *function    = "fsxfs_bench_random_read";
+	uint64_t number_of_bytes = 0;
+	uint64_t start_time      = 0;
+	size64_t file_size       = 0;
+	off64_t read_offset      = 0;
+	ssize_t read_count       = 0;
+	uint32_t iteration       = 0;
+	uint32_t read_index      = 0;
+
+	fsxfs_bench_result_initialize(
+	 result,
+	 "random_read" );
+
+	if( libfsxfs_file_entry_get_size(
+	     file_entry,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == 0 )
+	{
+		return( 1 );
+	}
+	fsxfs_bench_random_state = seed;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		number_of_bytes = 0;
+
+		start_time = fsxfs_bench_get_time();
+
+		for( read_index = 0;
+		     read_index < FSXFS_BENCH_NUMBER_OF_RANDOM_READS;
+		     read_index++ )
+		{
+			read_offset = (off64_t) ( fsxfs_bench_get_random() % file_size );
+
+			read_count = libfsxfs_file_entry_read_buffer_at_offset(
+			              file_entry,
+			              buffer,
+			              FSXFS_BENCH_RANDOM_READ_SIZE,
+			              read_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				return( -1 );
+			}
+			number_of_bytes += (uint64_t) read_count;
+		}
+		fsxfs_bench_result_add_iteration(
+		 result,
+		 start_time,
+		 fsxfs_bench_get_time() );
+
+		result->number_of_bytes = number_of_bytes;
+		result->number_of_items = FSXFS_BENCH_NUMBER_OF_RANDOM_READS;
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsxfs_bench_result_t results[ 8 ];
+
+	char directory_path[ 1024 ];
+	char file_path[ 1024 ];
+	char resolution_path[ 1024 ];
+
+	libfsxfs_file_entry_t *file_entry                = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsxfs_volume_t *volume                        = NULL;
+	system_character_t *option_directory_path        = NULL;
+	system_character_t *option_file_path             = NULL;
+	system_character_t *option_inode_number          = NULL;
+	system_character_t *option_number_of_iterations  = NULL;
+	system_character_t *option_resolution_path       = NULL;
+	system_character_t *option_seed                  = NULL;
+	system_character_t *source                       = NULL;
+	uint8_t *buffer                                  = NULL;
+	uint64_t inode_number                            = 0;
+	uint64_t seed                                    = 1;
+	uint64_t value_64bit                             = 0;
+	system_integer_t option                          = 0;
+	int number_of_results                            = 0;
+	int result_index                                 = 0;
+	uint32_t number_of_iterations                    = FSXFS_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "f:hi:n:p:r:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				fsxfs_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'f':
+				option_file_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fsxfs_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_inode_number = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_resolution_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_directory_path = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file or device.\n" );
+
+		fsxfs_bench_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	if( option_number_of_iterations != NULL )
+	{
+		if( fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+		     option_number_of_iterations,
+		     system_string_length(
+		      option_number_of_iterations ) + 1,
+		     &value_64bit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations.\n" );
+
+			goto on_error;
+		}
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) UINT32_MAX ) )
+		{
+			fprintf(
+			 stderr,
+			 "Number of iterations value out of bounds.\n" );
+
+			goto on_error;
+		}
+		number_of_iterations = (uint32_t) value_64bit;
+	}
+	if( option_seed != NULL )
+	{
+		if( fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+		     option_seed,
+		     system_string_length(
+		      option_seed ) + 1,
+		     &seed,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported seed.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_inode_number != NULL )
+	{
+		if( fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+		     option_inode_number,
+		     system_string_length(
+		      option_inode_number ) + 1,
+		     &inode_number,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported inode number.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_directory_path != NULL )
+	{
+		if( fsxfs_test_get_narrow_source(
+		     option_directory_path,
+		     directory_path,
+		     1024,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported directory path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_file_path != NULL )
+	{
+		if( fsxfs_test_get_narrow_source(
+		     option_file_path,
+		     file_path,
+		     1024,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported file path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_resolution_path != NULL )
+	{
+		if( fsxfs_test_get_narrow_source(
+		     option_resolution_path,
+		     resolution_path,
+		     1024,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fsxfs_bench_volume_open(
+	     source,
+	     number_of_iterations,
+	     &( results[ number_of_results++ ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark volume open.\n" );
+
+		goto on_error;
+	}
+	if( fsxfs_bench_open_volume(
+	     &volume,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open volume.\n" );
+
+		goto on_error;
+	}
+	if( option_inode_number == NULL )
+	{
+		if( libfsxfs_volume_get_root_directory(
+		     volume,
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve root directory.\n" );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_get_inode_number(
+		     file_entry,
+		     &inode_number,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve root directory inode number.\n" );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_entry_free(
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( fsxfs_bench_inode_lookup(
+	     source,
+	     inode_number,
+	     number_of_iterations,
+	     &( results[ number_of_results ] ),
+	     &( results[ number_of_results + 1 ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark inode lookup.\n" );
+
+		goto on_error;
+	}
+	number_of_results += 2;
+
+	if( option_resolution_path != NULL )
+	{
+		if( fsxfs_bench_path_resolution(
+		     volume,
+		     resolution_path,
+		     number_of_iterations,
+		     &( results[ number_of_results++ ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark path resolution.\n" );
+
+			goto on_error;
+		}
+	}
+	if( fsxfs_bench_directory_enumeration(
+	     volume,
+	     ( option_directory_path != NULL ) ? directory_path : NULL,
+	     number_of_iterations,
+	     &( results[ number_of_results++ ] ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark directory enumeration.\n" );
+
+		goto on_error;
+	}
+	if( option_file_path != NULL )
+	{
+		if( fsxfs_bench_get_file_entry(
+		     volume,
+		     file_path,
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve file entry.\n" );
+
+			goto on_error;
+		}
+		buffer = (uint8_t *) memory_allocate(
+		                      sizeof( uint8_t ) * FSXFS_BENCH_SEQUENTIAL_READ_SIZE );
+
+		if( buffer == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create buffer.\n" );
+
+			goto on_error;
+		}
+		if( fsxfs_bench_extent_map_decode(
+		     volume,
+		     file_entry,
+		     number_of_iterations,
+		     &( results[ number_of_results++ ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark extent map decode.\n" );
+
+			goto on_error;
+		}
+		if( fsxfs_bench_sequential_read(
+		     file_entry,
+		     buffer,
+		     number_of_iterations,
+		     &( results[ number_of_results++ ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark sequential read.\n" );
+
+			goto on_error;
+		}
+		if( fsxfs_bench_random_read(
+		     file_entry,
+		     buffer,
+		     seed,
+		     number_of_iterations,
+		     &( results[ number_of_results++ ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark random read.\n" );
+
+			goto on_error;
+		}
+		memory_free(
+		 buffer );
+
+		buffer = NULL;
+
+		if( libfsxfs_file_entry_free(
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( fsxfs_bench_close_volume(
+	     &volume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close volume.\n" );
+
+		goto on_error;
+	}
+	fprintf( stdout, "{\n" );
+	fprintf( stdout, "  \"library_version\": \"%s\",\n", LIBFSXFS_VERSION_STRING );
+	fprintf( stdout, "  \"iterations\": %" PRIu32 ",\n", number_of_iterations );
+	fprintf( stdout, "  \"seed\": %" PRIu64 ",\n", seed );
+	fprintf( stdout, "  \"inode_number\": %" PRIu64 ",\n", inode_number );
+	fprintf( stdout, "  \"results\": [\n" );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		fsxfs_bench_result_fprint(
+		 &( results[ result_index ] ),
+		 result_index == ( number_of_results - 1 ),
+		 stdout );
+	}
+	fprintf( stdout, "  ]\n" );
+	fprintf( stdout, "}\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		fsxfs_bench_close_volume(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
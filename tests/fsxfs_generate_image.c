@@ -0,0 +1,4113 @@
+/*
+ * Deterministic synthetic XFS image generator
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libcerror.h"
+
+#include "../libfsxfs/fsxfs_block_directory.h"
+#include "../libfsxfs/fsxfs_btree.h"
+#include "../libfsxfs/fsxfs_inode.h"
+#include "../libfsxfs/fsxfs_inode_information.h"
+#include "../libfsxfs/fsxfs_superblock.h"
+
+#define FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT		0xffffffffUL
+#define FSXFS_GENERATE_NULL_BLOCK_NUMBER_64BIT		0xffffffffffffffffULL
+#define FSXFS_GENERATE_NULL_INODE_NUMBER		0xffffffffffffffffULL
+
+#define FSXFS_GENERATE_SECTOR_SIZE			512
+#define FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK	64
+
+/* The offsets of the version 5 superblock values that are not part of fsxfs_superblock_t
+ */
+#define FSXFS_GENERATE_SUPERBLOCK_V5_FEATURE_FLAGS_READ_ONLY	212
+#define FSXFS_GENERATE_SUPERBLOCK_V5_FEATURE_FLAGS_INCOMPATIBLE	216
+#define FSXFS_GENERATE_SUPERBLOCK_V5_CHECKSUM			224
+#define FSXFS_GENERATE_SUPERBLOCK_V5_PROJECT_QUOTA_INODE_NUMBER	232
+
+/* The sizes and checksum offsets of the version 5 metadata headers
+ */
+#define FSXFS_GENERATE_ALLOCATION_GROUP_FREE_LIST_V5_HEADER_SIZE	36
+#define FSXFS_GENERATE_DIRECTORY_LEAF_V4_HEADER_SIZE			16
+#define FSXFS_GENERATE_DIRECTORY_LEAF_V5_HEADER_SIZE			64
+#define FSXFS_GENERATE_DIRECTORY_FREE_V4_HEADER_SIZE			16
+#define FSXFS_GENERATE_DIRECTORY_FREE_V5_HEADER_SIZE			64
+
+/* The logical offsets of the directory leaf and free index sections
+ */
+#define FSXFS_GENERATE_DIRECTORY_LEAF_OFFSET		0x800000000ULL
+#define FSXFS_GENERATE_DIRECTORY_FREE_OFFSET		0x1000000000ULL
+
+/* The directory entry file types
+ */
+#define FSXFS_GENERATE_FILE_TYPE_REGULAR_FILE		1
+#define FSXFS_GENERATE_FILE_TYPE_DIRECTORY		2
+
+typedef struct fsxfs_generate_extent fsxfs_generate_extent_t;
+
+struct fsxfs_generate_extent
+{
+	/* The logical block number
+	 */
+	uint64_t logical_block_number;
+
+	/* The physical (file system) block number
+	 */
+	uint64_t physical_block_number;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+};
+
+typedef struct fsxfs_generate_directory_entry fsxfs_generate_directory_entry_t;
+
+struct fsxfs_generate_directory_entry
+{
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The data address (data block offset divided by 8)
+	 */
+	uint32_t address;
+};
+
+typedef struct fsxfs_generate_image fsxfs_generate_image_t;
+
+struct fsxfs_generate_image
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The seed
+	 */
+	uint64_t seed;
+
+	/* The format version
+	 */
+	uint8_t format_version;
+
+	/* Value to indicate directory entries contain a file type
+	 */
+	uint8_t has_file_type;
+
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The block size log2
+	 */
+	uint8_t block_size_log2;
+
+	/* The inode size
+	 */
+	uint16_t inode_size;
+
+	/* The inode size log2
+	 */
+	uint8_t inode_size_log2;
+
+	/* The size of the inode core
+	 */
+	uint16_t inode_core_size;
+
+	/* The number of inodes per block log2
+	 */
+	uint8_t inodes_per_block_log2;
+
+	/* The allocation group size in blocks
+	 */
+	uint32_t allocation_group_size;
+
+	/* The allocation group size log2
+	 */
+	uint8_t allocation_group_size_log2;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The number of blocks per inode chunk
+	 */
+	uint32_t blocks_per_chunk;
+
+	/* The number of allocation group header blocks
+	 */
+	uint32_t number_of_header_blocks;
+
+	/* The relative block number of the first inode chunk per allocation group
+	 */
+	uint32_t first_chunk_block_number;
+
+	/* The file system identifier
+	 */
+	uint8_t file_system_identifier[ 16 ];
+
+	/* The journal block number (relative to allocation group 0)
+	 */
+	uint32_t journal_block_number;
+
+	/* The journal size in blocks
+	 */
+	uint32_t journal_size;
+
+	/* The next free relative block number per allocation group
+	 */
+	uint32_t *next_free_block_number;
+
+	/* The number of inode chunks per allocation group
+	 */
+	uint32_t *number_of_chunks;
+
+	/* The number of objects (inodes in use)
+	 */
+	uint32_t number_of_objects;
+
+	/* The number of container directories
+	 */
+	uint32_t number_of_directories;
+
+	/* The depth of the nested directory chain
+	 */
+	uint32_t directory_depth;
+
+	/* The number of regular files
+	 */
+	uint32_t number_of_files;
+
+	/* The maximum number of files per container directory
+	 */
+	uint32_t entries_per_directory;
+
+	/* The number of extents per regular file
+	 */
+	uint32_t extents_per_file;
+
+	/* The number of blocks per extent
+	 */
+	uint32_t blocks_per_extent;
+
+	/* Value to indicate regular files should contain holes
+	 */
+	uint8_t sparse;
+
+	/* Value to indicate regular file data should not be written
+	 */
+	uint8_t metadata_only;
+
+	/* A block buffer
+	 */
+	uint8_t *block_data;
+
+	/* An inode buffer
+	 */
+	uint8_t *inode_data;
+};
+
+/* The CRC-32C table
+ */
+uint32_t fsxfs_generate_crc32c_table[ 256 ];
+
+/* Prints usage information
+ */
+void fsxfs_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fsxfs_generate_image to write a deterministic synthetic XFS image.\n\n" );
+
+	fprintf( stream, "Usage: fsxfs_generate_image [ -a number ] [ -b size ] [ -d number ]\n"
+	                 "                            [ -e number ] [ -f number ] [ -g size ]\n"
+	                 "                            [ -i size ] [ -l depth ] [ -s seed ]\n"
+	                 "                            [ -v version ] [ -x number ] [ -hmS ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the image file to write\n\n" );
+
+	fprintf( stream, "\t-a:     number of allocation groups (default is 4)\n" );
+	fprintf( stream, "\t-b:     block size (default is 4096)\n" );
+	fprintf( stream, "\t-d:     maximum number of files per directory (default is 100)\n" );
+	fprintf( stream, "\t-e:     number of extents per file (default is 1)\n" );
+	fprintf( stream, "\t-f:     number of files (default is 1000)\n" );
+	fprintf( stream, "\t-g:     allocation group size in blocks (default is 16384)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     inode size (default is 256 for version 4 and 512 for version 5)\n" );
+	fprintf( stream, "\t-l:     depth of the nested directory chain \"/deep/level001/...\"\n"
+	                 "\t        (default is 0)\n" );
+	fprintf( stream, "\t-m:     only write metadata, file data blocks are left zero\n" );
+	fprintf( stream, "\t-s:     seed (default is 1)\n" );
+	fprintf( stream, "\t-S:     write sparse files, with a hole between every extent\n" );
+	fprintf( stream, "\t-v:     format version, 4 or 5 (default is 5)\n" );
+	fprintf( stream, "\t-x:     number of blocks per extent (default is 1)\n" );
+}
+
+/* Initializes the CRC-32C table
+ */
+void fsxfs_generate_crc32c_initialize(
+      void )
+{
+	uint32_t crc32c      = 0;
+	uint32_t table_index = 0;
+	uint8_t bit_iterator = 0;
+
+	for( table_index = 0;
+	     table_index < 256;
+	     table_index++ )
+	{
+		crc32c = table_index;
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( crc32c & 1 ) != 0 )
+			{
+				crc32c = 0x82f63b78UL ^ ( crc32c >> 1 );
+			}
+			else
+			{
+				crc32c = crc32c >> 1;
+			}
+		}
+		fsxfs_generate_crc32c_table[ table_index ] = crc32c;
+	}
+}
+
+/* Sets the CRC-32C checksum of metadata
+ * The checksum is calculated with the checksum value set to 0 and stored in little-endian
+ */
+void fsxfs_generate_set_checksum(
+      uint8_t *data,
+      size_t data_size,
+      size_t checksum_offset )
+{
+	uint32_t crc32c    = 0xffffffffUL;
+	size_t data_offset = 0;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ checksum_offset ] ),
+	 0 );
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32c = fsxfs_generate_crc32c_table[ ( crc32c ^ data[ data_offset ] ) & 0xff ] ^ ( crc32c >> 8 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ checksum_offset ] ),
+	 crc32c ^ 0xffffffffUL );
+}
+
+/* Mixes a value into a deterministic pseudo random value (splitmix64)
+ */
+uint64_t fsxfs_generate_mix(
+          uint64_t value )
+{
+	value += 0x9e3779b97f4a7c15ULL;
+	value  = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	value  = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+
+	return( value ^ ( value >> 31 ) );
+}
+
+/* Calculates the hash of a directory entry name
+ */
+uint32_t fsxfs_generate_get_name_hash(
+          const uint8_t *name,
+          size_t name_size )
+{
+	uint32_t hash = 0;
+
+	while( name_size >= 4 )
+	{
+		hash = ( (uint32_t) name[ 0 ] << 21 )
+		     ^ ( (uint32_t) name[ 1 ] << 14 )
+		     ^ ( (uint32_t) name[ 2 ] << 7 )
+		     ^ (uint32_t) name[ 3 ]
+		     ^ ( ( hash << 28 ) | ( hash >> 4 ) );
+
+		name      += 4;
+		name_size -= 4;
+	}
+	switch( name_size )
+	{
+		case 3:
+			hash = ( (uint32_t) name[ 0 ] << 14 )
+			     ^ ( (uint32_t) name[ 1 ] << 7 )
+			     ^ (uint32_t) name[ 2 ]
+			     ^ ( ( hash << 21 ) | ( hash >> 11 ) );
+			break;
+
+		case 2:
+			hash = ( (uint32_t) name[ 0 ] << 7 )
+			     ^ (uint32_t) name[ 1 ]
+			     ^ ( ( hash << 14 ) | ( hash >> 18 ) );
+			break;
+
+		case 1:
+			hash = (uint32_t) name[ 0 ]
+			     ^ ( ( hash << 7 ) | ( hash >> 25 ) );
+			break;
+
+		default:
+			break;
+	}
+	return( hash );
+}
+
+/* Compares two directory entries by name hash
+ */
+int fsxfs_generate_directory_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const fsxfs_generate_directory_entry_t *first  = (const fsxfs_generate_directory_entry_t *) first_entry;
+	const fsxfs_generate_directory_entry_t *second = (const fsxfs_generate_directory_entry_t *) second_entry;
+
+	if( first->name_hash < second->name_hash )
+	{
+		return( -1 );
+	}
+	if( first->name_hash > second->name_hash )
+	{
+		return( 1 );
+	}
+	if( first->address < second->address )
+	{
+		return( -1 );
+	}
+	if( first->address > second->address )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines the log2 of a power of 2 value
+ * Returns the log2 or 0 if the value is not a power of 2
+ */
+uint8_t fsxfs_generate_get_log2(
+         uint64_t value )
+{
+	uint8_t value_log2 = 0;
+
+	if( ( value == 0 )
+	 || ( ( value & ( value - 1 ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	while( value > 1 )
+	{
+		value >>= 1;
+		value_log2++;
+	}
+	return( value_log2 );
+}
+
+/* Writes data at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_at_offset(
+     fsxfs_generate_image_t *image,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_generate_write_at_offset";
+
+	if( file_stream_seek_offset(
+	     image->stream,
+	     offset,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     image->stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of a relative block in an allocation group
+ */
+off64_t fsxfs_generate_get_block_offset(
+         fsxfs_generate_image_t *image,
+         uint32_t allocation_group_index,
+         uint32_t relative_block_number )
+{
+	return( (off64_t) ( ( (uint64_t) allocation_group_index * image->allocation_group_size ) + relative_block_number ) * image->block_size );
+}
+
+/* Retrieves the file system block number of a relative block in an allocation group
+ */
+uint64_t fsxfs_generate_get_file_system_block_number(
+          fsxfs_generate_image_t *image,
+          uint32_t allocation_group_index,
+          uint32_t relative_block_number )
+{
+	return( ( (uint64_t) allocation_group_index << image->allocation_group_size_log2 ) | relative_block_number );
+}
+
+/* Writes a block
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_block(
+     fsxfs_generate_image_t *image,
+     uint32_t allocation_group_index,
+     uint32_t relative_block_number,
+     libcerror_error_t **error )
+{
+	return( fsxfs_generate_write_at_offset(
+	         image,
+	         image->block_data,
+	         (size_t) image->block_size,
+	         fsxfs_generate_get_block_offset(
+	          image,
+	          allocation_group_index,
+	          relative_block_number ),
+	         error ) );
+}
+
+/* Allocates contiguous blocks, preferably in a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_allocate_blocks(
+     fsxfs_generate_image_t *image,
+     uint32_t preferred_allocation_group_index,
+     uint32_t number_of_blocks,
+     uint32_t *allocation_group_index,
+     uint32_t *relative_block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_generate_allocate_blocks";
+	uint32_t ag_iterator  = 0;
+	uint32_t ag_index     = 0;
+
+	for( ag_iterator = 0;
+	     ag_iterator < image->number_of_allocation_groups;
+	     ag_iterator++ )
+	{
+		ag_index = ( preferred_allocation_group_index + ag_iterator ) % image->number_of_allocation_groups;
+
+		if( number_of_blocks <= ( image->allocation_group_size - image->next_free_block_number[ ag_index ] ) )
+		{
+			*allocation_group_index = ag_index;
+			*relative_block_number  = image->next_free_block_number[ ag_index ];
+
+			image->next_free_block_number[ ag_index ] += number_of_blocks;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+	 "%s: unable to allocate %" PRIu32 " blocks, image too small.",
+	 function,
+	 number_of_blocks );
+
+	return( -1 );
+}
+
+/* Retrieves the inode number of an object
+ */
+uint64_t fsxfs_generate_get_inode_number(
+          fsxfs_generate_image_t *image,
+          uint32_t object_index )
+{
+	uint32_t allocation_group_index = 0;
+	uint32_t chunk_index            = 0;
+	uint32_t relative_block_number  = 0;
+
+	/* Inode chunks are distributed round-robin over the allocation groups
+	 */
+	chunk_index            = object_index / FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK;
+	allocation_group_index = chunk_index % image->number_of_allocation_groups;
+	relative_block_number  = image->first_chunk_block_number
+	                       + ( ( chunk_index / image->number_of_allocation_groups ) * image->blocks_per_chunk );
+
+	return( ( (uint64_t) allocation_group_index << ( image->allocation_group_size_log2 + image->inodes_per_block_log2 ) )
+	      | ( ( (uint64_t) relative_block_number << image->inodes_per_block_log2 ) + ( object_index % FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK ) ) );
+}
+
+/* Retrieves the allocation group of an object
+ */
+uint32_t fsxfs_generate_get_allocation_group_index(
+          fsxfs_generate_image_t *image,
+          uint32_t object_index )
+{
+	return( ( object_index / FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK ) % image->number_of_allocation_groups );
+}
+
+/* Retrieves the index of the first regular file object
+ */
+uint32_t fsxfs_generate_get_first_file_index(
+          fsxfs_generate_image_t *image )
+{
+	return( 1 + image->number_of_directories + image->directory_depth );
+}
+
+/* Retrieves the parent and children of a directory object
+ * Object 0 is the root directory, followed by the container directories,
+ * the nested directory chain and the regular files
+ */
+void fsxfs_generate_get_directory_hierarchy(
+      fsxfs_generate_image_t *image,
+      uint32_t object_index,
+      uint32_t *parent_index,
+      uint32_t *first_child_index,
+      uint32_t *number_of_children )
+{
+	uint32_t chain_index = 0;
+	uint32_t first_file  = 0;
+
+	first_file = fsxfs_generate_get_first_file_index(
+	              image );
+
+	*first_child_index  = 0;
+	*number_of_children = 0;
+
+	if( object_index == 0 )
+	{
+		*parent_index       = 0;
+		*first_child_index  = 1;
+		*number_of_children = image->number_of_directories;
+
+		if( image->directory_depth > 0 )
+		{
+			*number_of_children += 1;
+		}
+	}
+	else if( object_index <= image->number_of_directories )
+	{
+		*parent_index      = 0;
+		*first_child_index = first_file + ( ( object_index - 1 ) * image->entries_per_directory );
+
+		if( ( image->number_of_files - ( ( object_index - 1 ) * image->entries_per_directory ) ) < image->entries_per_directory )
+		{
+			*number_of_children = image->number_of_files - ( ( object_index - 1 ) * image->entries_per_directory );
+		}
+		else
+		{
+			*number_of_children = image->entries_per_directory;
+		}
+	}
+	else
+	{
+		chain_index = object_index - ( image->number_of_directories + 1 );
+
+		if( chain_index == 0 )
+		{
+			*parent_index = 0;
+		}
+		else
+		{
+			*parent_index = object_index - 1;
+		}
+		if( ( chain_index + 1 ) < image->directory_depth )
+		{
+			*first_child_index  = object_index + 1;
+			*number_of_children = 1;
+		}
+	}
+}
+
+/* Retrieves the name of an object
+ * Returns the size of the name
+ */
+size_t fsxfs_generate_get_name(
+        fsxfs_generate_image_t *image,
+        uint32_t object_index,
+        char *name,
+        size_t name_size )
+{
+	uint32_t first_file = 0;
+	int print_count     = 0;
+
+	first_file = fsxfs_generate_get_first_file_index(
+	              image );
+
+	if( object_index == 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "/" );
+	}
+	else if( object_index <= image->number_of_directories )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "dir%06" PRIu32 "",
+		               object_index - 1 );
+	}
+	else if( object_index == ( image->number_of_directories + 1 ) )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "deep" );
+	}
+	else if( object_index < first_file )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "level%03" PRIu32 "",
+		               object_index - ( image->number_of_directories + 1 ) );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "file%08" PRIu32 "",
+		               object_index - first_file );
+	}
+	if( print_count < 0 )
+	{
+		return( 0 );
+	}
+	return( (size_t) print_count );
+}
+
+/* Writes a short (32-bit) B+ tree header
+ * Returns the size of the header
+ */
+size_t fsxfs_generate_write_short_btree_header(
+        fsxfs_generate_image_t *image,
+        uint8_t *data,
+        const char *signature,
+        uint16_t level,
+        uint16_t number_of_records,
+        uint32_t allocation_group_index,
+        uint32_t relative_block_number,
+        uint32_t previous_block_number,
+        uint32_t next_block_number )
+{
+	memory_copy(
+	 ( (fsxfs_btree_header_v1_32bit_t *) data )->signature,
+	 signature,
+	 4 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 ( (fsxfs_btree_header_v1_32bit_t *) data )->level,
+	 level );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 ( (fsxfs_btree_header_v1_32bit_t *) data )->number_of_records,
+	 number_of_records );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_btree_header_v1_32bit_t *) data )->previous_btree_block_number,
+	 previous_block_number );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_btree_header_v1_32bit_t *) data )->next_btree_block_number,
+	 next_block_number );
+
+	if( image->format_version < 5 )
+	{
+		return( sizeof( fsxfs_btree_header_v1_32bit_t ) );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_btree_header_v5_32bit_t *) data )->block_number,
+	 (uint64_t) fsxfs_generate_get_block_offset( image, allocation_group_index, relative_block_number ) / FSXFS_GENERATE_SECTOR_SIZE );
+
+	memory_copy(
+	 ( (fsxfs_btree_header_v5_32bit_t *) data )->block_type_identifier,
+	 image->file_system_identifier,
+	 16 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_btree_header_v5_32bit_t *) data )->owner_allocation_group,
+	 allocation_group_index );
+
+	return( sizeof( fsxfs_btree_header_v5_32bit_t ) );
+}
+
+/* Writes a short (32-bit) B+ tree, such as the inode or free space B+ trees
+ * The records are stored in leaf blocks that are allocated from the allocation
+ * group, except for the root block, which is stored in root_block_number
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_short_btree(
+     fsxfs_generate_image_t *image,
+     const char *signature,
+     uint32_t allocation_group_index,
+     uint32_t root_block_number,
+     const uint8_t *records,
+     uint32_t number_of_records,
+     size_t record_size,
+     size_t key_size,
+     uint16_t *number_of_levels,
+     libcerror_error_t **error )
+{
+	uint8_t *keys                    = NULL;
+	uint8_t *next_keys               = NULL;
+	uint32_t *block_numbers          = NULL;
+	static char *function            = "fsxfs_generate_write_short_btree";
+	size_t header_size               = 0;
+	size_t maximum_number_of_records = 0;
+	uint32_t block_index             = 0;
+	uint32_t number_of_blocks        = 0;
+	uint32_t number_of_entries       = 0;
+	uint32_t entry_index             = 0;
+	uint32_t entries_in_block        = 0;
+	uint32_t first_entry_index       = 0;
+	uint32_t block_allocation_group  = 0;
+	uint16_t level                   = 0;
+	int result                       = -1;
+
+	if( image->format_version < 5 )
+	{
+		header_size = sizeof( fsxfs_btree_header_v1_32bit_t );
+	}
+	else
+	{
+		header_size = sizeof( fsxfs_btree_header_v5_32bit_t );
+	}
+	/* The keys of the current level, one per entry
+	 */
+	keys = (uint8_t *) memory_allocate(
+	                    key_size * ( (size_t) number_of_records + 1 ) );
+
+	/* The block numbers of the current level followed by those of the next level
+	 */
+	block_numbers = (uint32_t *) memory_allocate(
+	                              sizeof( uint32_t ) * 2 * ( (size_t) number_of_records + 1 ) );
+
+	if( ( keys == NULL )
+	 || ( block_numbers == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_entries = number_of_records;
+
+	for( level = 0;
+	     level < 8;
+	     level++ )
+	{
+		if( level == 0 )
+		{
+			maximum_number_of_records = ( image->block_size - header_size ) / record_size;
+		}
+		else
+		{
+			maximum_number_of_records = ( image->block_size - header_size ) / ( key_size + 4 );
+		}
+		number_of_blocks = (uint32_t) ( ( number_of_entries + maximum_number_of_records - 1 ) / maximum_number_of_records );
+
+		if( number_of_blocks <= 1 )
+		{
+			number_of_blocks = 1;
+
+			block_numbers[ number_of_entries ] = root_block_number;
+		}
+		else
+		{
+			for( block_index = 0;
+			     block_index < number_of_blocks;
+			     block_index++ )
+			{
+				if( fsxfs_generate_allocate_blocks(
+				     image,
+				     allocation_group_index,
+				     1,
+				     &block_allocation_group,
+				     &( block_numbers[ number_of_entries + block_index ] ),
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( block_allocation_group != allocation_group_index )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: allocation group: %" PRIu32 " too small for B+ tree.",
+					 function,
+					 allocation_group_index );
+
+					goto on_error;
+				}
+			}
+		}
+		next_keys = (uint8_t *) memory_allocate(
+		                         key_size * ( (size_t) number_of_blocks + 1 ) );
+
+		if( next_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create next keys.",
+			 function );
+
+			goto on_error;
+		}
+		first_entry_index = 0;
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			entries_in_block = number_of_entries - first_entry_index;
+
+			if( entries_in_block > maximum_number_of_records )
+			{
+				entries_in_block = (uint32_t) maximum_number_of_records;
+			}
+			memory_set(
+			 image->block_data,
+			 0,
+			 image->block_size );
+
+			fsxfs_generate_write_short_btree_header(
+			 image,
+			 image->block_data,
+			 signature,
+			 level,
+			 (uint16_t) entries_in_block,
+			 allocation_group_index,
+			 block_numbers[ number_of_entries + block_index ],
+			 ( block_index == 0 ) ? FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT : block_numbers[ number_of_entries + block_index - 1 ],
+			 ( ( block_index + 1 ) == number_of_blocks ) ? FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT : block_numbers[ number_of_entries + block_index + 1 ] );
+
+			for( entry_index = 0;
+			     entry_index < entries_in_block;
+			     entry_index++ )
+			{
+				if( level == 0 )
+				{
+					memory_copy(
+					 &( image->block_data[ header_size + ( entry_index * record_size ) ] ),
+					 &( records[ ( first_entry_index + entry_index ) * record_size ] ),
+					 record_size );
+				}
+				else
+				{
+					memory_copy(
+					 &( image->block_data[ header_size + ( entry_index * key_size ) ] ),
+					 &( keys[ ( first_entry_index + entry_index ) * key_size ] ),
+					 key_size );
+
+					byte_stream_copy_from_uint32_big_endian(
+					 &( image->block_data[ header_size + ( maximum_number_of_records * key_size ) + ( entry_index * 4 ) ] ),
+					 block_numbers[ first_entry_index + entry_index ] );
+				}
+			}
+			/* The key of a block is the key of its first entry
+			 */
+			if( entries_in_block == 0 )
+			{
+				memory_set(
+				 &( next_keys[ block_index * key_size ] ),
+				 0,
+				 key_size );
+			}
+			else if( level == 0 )
+			{
+				memory_copy(
+				 &( next_keys[ block_index * key_size ] ),
+				 &( records[ first_entry_index * record_size ] ),
+				 key_size );
+			}
+			else
+			{
+				memory_copy(
+				 &( next_keys[ block_index * key_size ] ),
+				 &( keys[ first_entry_index * key_size ] ),
+				 key_size );
+			}
+			if( image->format_version >= 5 )
+			{
+				fsxfs_generate_set_checksum(
+				 image->block_data,
+				 image->block_size,
+				 52 );
+			}
+			if( fsxfs_generate_write_block(
+			     image,
+			     allocation_group_index,
+			     block_numbers[ number_of_entries + block_index ],
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			first_entry_index += entries_in_block;
+		}
+		/* The block numbers of this level become the entries of the next level
+		 */
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			block_numbers[ block_index ] = block_numbers[ number_of_entries + block_index ];
+		}
+		memory_free(
+		 keys );
+
+		keys      = next_keys;
+		next_keys = NULL;
+
+		if( number_of_blocks == 1 )
+		{
+			break;
+		}
+		number_of_entries = number_of_blocks;
+	}
+	if( level >= 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: B+ tree too deep.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_levels = level + 1;
+
+	result = 1;
+
+on_error:
+	if( next_keys != NULL )
+	{
+		memory_free(
+		 next_keys );
+	}
+	if( keys != NULL )
+	{
+		memory_free(
+		 keys );
+	}
+	if( block_numbers != NULL )
+	{
+		memory_free(
+		 block_numbers );
+	}
+	return( result );
+}
+
+/* Writes an extent record (packed 128-bit)
+ */
+void fsxfs_generate_write_extent_record(
+      uint8_t *data,
+      fsxfs_generate_extent_t *extent )
+{
+	uint64_t lower_64bit = 0;
+	uint64_t upper_64bit = 0;
+
+	upper_64bit = ( ( extent->logical_block_number & 0x003fffffffffffffULL ) << 9 )
+	            | ( ( extent->physical_block_number >> 43 ) & 0x01ff );
+
+	lower_64bit = ( ( extent->physical_block_number & 0x000007ffffffffffULL ) << 21 )
+	            | ( extent->number_of_blocks & 0x001fffff );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 data,
+	 upper_64bit );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( data[ 8 ] ),
+	 lower_64bit );
+}
+
+/* Writes the data fork of an inode as an extent list or extent B+ tree
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_data_fork(
+     fsxfs_generate_image_t *image,
+     uint64_t inode_number,
+     uint32_t allocation_group_index,
+     fsxfs_generate_extent_t *extents,
+     uint32_t number_of_extents,
+     uint8_t *fork_type,
+     uint64_t *number_of_btree_blocks,
+     libcerror_error_t **error )
+{
+	uint64_t *block_numbers          = NULL;
+	uint64_t *keys                   = NULL;
+	uint8_t *data_fork               = NULL;
+	static char *function            = "fsxfs_generate_write_data_fork";
+	size_t data_fork_size            = 0;
+	size_t header_size               = 0;
+	size_t maximum_number_of_records = 0;
+	uint64_t file_system_block       = 0;
+	uint32_t block_allocation_group  = 0;
+	uint32_t block_index             = 0;
+	uint32_t entries_in_block        = 0;
+	uint32_t entry_index             = 0;
+	uint32_t first_entry_index       = 0;
+	uint32_t number_of_blocks        = 0;
+	uint32_t number_of_entries       = 0;
+	uint32_t relative_block_number   = 0;
+	uint16_t level                   = 0;
+	int result                       = -1;
+
+	data_fork      = &( image->inode_data[ image->inode_core_size ] );
+	data_fork_size = image->inode_size - image->inode_core_size;
+
+	*number_of_btree_blocks = 0;
+
+	if( ( (size_t) number_of_extents * 16 ) <= data_fork_size )
+	{
+		*fork_type = 2;
+
+		for( entry_index = 0;
+		     entry_index < number_of_extents;
+		     entry_index++ )
+		{
+			fsxfs_generate_write_extent_record(
+			 &( data_fork[ entry_index * 16 ] ),
+			 &( extents[ entry_index ] ) );
+		}
+		return( 1 );
+	}
+	*fork_type = 3;
+
+	if( image->format_version < 5 )
+	{
+		header_size = sizeof( fsxfs_btree_header_v1_64bit_t );
+	}
+	else
+	{
+		header_size = sizeof( fsxfs_btree_header_v5_64bit_t );
+	}
+	keys = (uint64_t *) memory_allocate(
+	                     sizeof( uint64_t ) * ( (size_t) number_of_extents + 1 ) );
+
+	/* The block numbers of the current level followed by those of the next level
+	 */
+	block_numbers = (uint64_t *) memory_allocate(
+	                              sizeof( uint64_t ) * 2 * ( (size_t) number_of_extents + 1 ) );
+
+	if( ( keys == NULL )
+	 || ( block_numbers == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_extents;
+	     entry_index++ )
+	{
+		keys[ entry_index ] = extents[ entry_index ].logical_block_number;
+	}
+	number_of_entries = number_of_extents;
+
+	/* Write the B+ tree blocks bottom-up until the remaining entries fit in the inode
+	 */
+	for( level = 0;
+	     level < 8;
+	     level++ )
+	{
+		if( level > 0 )
+		{
+			maximum_number_of_records = ( data_fork_size - 4 ) / 16;
+
+			if( number_of_entries <= maximum_number_of_records )
+			{
+				break;
+			}
+		}
+		/* Extent records and key and pointer pairs are both 16 bytes in size
+		 */
+		maximum_number_of_records = ( image->block_size - header_size ) / 16;
+
+		number_of_blocks = (uint32_t) ( ( number_of_entries + maximum_number_of_records - 1 ) / maximum_number_of_records );
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( fsxfs_generate_allocate_blocks(
+			     image,
+			     allocation_group_index,
+			     1,
+			     &block_allocation_group,
+			     &relative_block_number,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			block_numbers[ number_of_entries + block_index ] = fsxfs_generate_get_file_system_block_number(
+			                                                    image,
+			                                                    block_allocation_group,
+			                                                    relative_block_number );
+		}
+		*number_of_btree_blocks += number_of_blocks;
+
+		first_entry_index = 0;
+
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			entries_in_block = number_of_entries - first_entry_index;
+
+			if( entries_in_block > maximum_number_of_records )
+			{
+				entries_in_block = (uint32_t) maximum_number_of_records;
+			}
+			memory_set(
+			 image->block_data,
+			 0,
+			 image->block_size );
+
+			memory_copy(
+			 ( (fsxfs_btree_header_v1_64bit_t *) image->block_data )->signature,
+			 ( ( image->format_version < 5 ) ? "BMAP" : "BMA3" ),
+			 4 );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 ( (fsxfs_btree_header_v1_64bit_t *) image->block_data )->level,
+			 level );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 ( (fsxfs_btree_header_v1_64bit_t *) image->block_data )->number_of_records,
+			 (uint16_t) entries_in_block );
+
+			byte_stream_copy_from_uint64_big_endian(
+			 ( (fsxfs_btree_header_v1_64bit_t *) image->block_data )->previous_btree_block_number,
+			 ( block_index == 0 ) ? FSXFS_GENERATE_NULL_BLOCK_NUMBER_64BIT : block_numbers[ number_of_entries + block_index - 1 ] );
+
+			byte_stream_copy_from_uint64_big_endian(
+			 ( (fsxfs_btree_header_v1_64bit_t *) image->block_data )->next_btree_block_number,
+			 ( ( block_index + 1 ) == number_of_blocks ) ? FSXFS_GENERATE_NULL_BLOCK_NUMBER_64BIT : block_numbers[ number_of_entries + block_index + 1 ] );
+
+			file_system_block = block_numbers[ number_of_entries + block_index ];
+
+			if( image->format_version >= 5 )
+			{
+				byte_stream_copy_from_uint64_big_endian(
+				 ( (fsxfs_btree_header_v5_64bit_t *) image->block_data )->block_number,
+				 (uint64_t) fsxfs_generate_get_block_offset(
+				  image,
+				  (uint32_t) ( file_system_block >> image->allocation_group_size_log2 ),
+				  (uint32_t) ( file_system_block & ( ( (uint64_t) 1 << image->allocation_group_size_log2 ) - 1 ) ) ) / FSXFS_GENERATE_SECTOR_SIZE );
+
+				memory_copy(
+				 ( (fsxfs_btree_header_v5_64bit_t *) image->block_data )->block_type_identifier,
+				 image->file_system_identifier,
+				 16 );
+
+				byte_stream_copy_from_uint64_big_endian(
+				 ( (fsxfs_btree_header_v5_64bit_t *) image->block_data )->owner_allocation_group,
+				 inode_number );
+			}
+			for( entry_index = 0;
+			     entry_index < entries_in_block;
+			     entry_index++ )
+			{
+				if( level == 0 )
+				{
+					fsxfs_generate_write_extent_record(
+					 &( image->block_data[ header_size + ( entry_index * 16 ) ] ),
+					 &( extents[ first_entry_index + entry_index ] ) );
+				}
+				else
+				{
+					byte_stream_copy_from_uint64_big_endian(
+					 &( image->block_data[ header_size + ( entry_index * 8 ) ] ),
+					 keys[ first_entry_index + entry_index ] );
+
+					byte_stream_copy_from_uint64_big_endian(
+					 &( image->block_data[ header_size + ( maximum_number_of_records * 8 ) + ( entry_index * 8 ) ] ),
+					 block_numbers[ first_entry_index + entry_index ] );
+				}
+			}
+			if( image->format_version >= 5 )
+			{
+				fsxfs_generate_set_checksum(
+				 image->block_data,
+				 image->block_size,
+				 64 );
+			}
+			if( fsxfs_generate_write_at_offset(
+			     image,
+			     image->block_data,
+			     image->block_size,
+			     fsxfs_generate_get_block_offset(
+			      image,
+			      (uint32_t) ( file_system_block >> image->allocation_group_size_log2 ),
+			      (uint32_t) ( file_system_block & ( ( (uint64_t) 1 << image->allocation_group_size_log2 ) - 1 ) ) ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			/* The key of a block is the key of its first entry
+			 */
+			keys[ block_index ] = keys[ first_entry_index ];
+
+			first_entry_index += entries_in_block;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			block_numbers[ block_index ] = block_numbers[ number_of_entries + block_index ];
+		}
+		number_of_entries = number_of_blocks;
+	}
+	if( level >= 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: extent B+ tree too deep.",
+		 function );
+
+		goto on_error;
+	}
+	/* Write the B+ tree root in the inode
+	 */
+	maximum_number_of_records = ( data_fork_size - 4 ) / 16;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data_fork[ 0 ] ),
+	 level );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data_fork[ 2 ] ),
+	 (uint16_t) number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_from_uint64_big_endian(
+		 &( data_fork[ 4 + ( entry_index * 8 ) ] ),
+		 keys[ entry_index ] );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( data_fork[ 4 + ( maximum_number_of_records * 8 ) + ( entry_index * 8 ) ] ),
+		 block_numbers[ entry_index ] );
+	}
+	result = 1;
+
+on_error:
+	if( keys != NULL )
+	{
+		memory_free(
+		 keys );
+	}
+	if( block_numbers != NULL )
+	{
+		memory_free(
+		 block_numbers );
+	}
+	return( result );
+}
+
+/* Initializes the inode core in the inode buffer
+ */
+void fsxfs_generate_initialize_inode(
+      fsxfs_generate_image_t *image,
+      uint64_t inode_number,
+      uint16_t file_mode,
+      uint32_t number_of_links )
+{
+	uint64_t random_value = 0;
+	uint32_t timestamp    = 0;
+
+	random_value = fsxfs_generate_mix(
+	                image->seed ^ inode_number );
+
+	timestamp = 1500000000UL + (uint32_t) ( random_value % 100000000UL );
+
+	memory_set(
+	 image->inode_data,
+	 0,
+	 image->inode_size );
+
+	memory_copy(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->signature,
+	 "IN",
+	 2 );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->file_mode,
+	 file_mode );
+
+	if( image->format_version < 5 )
+	{
+		( (fsxfs_inode_v2_t *) image->inode_data )->format_version = 2;
+	}
+	else
+	{
+		( (fsxfs_inode_v2_t *) image->inode_data )->format_version = 3;
+	}
+	if( file_mode != 0 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->owner_identifier,
+		 1000 + (uint32_t) ( ( random_value >> 32 ) % 4 ) );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->group_identifier,
+		 1000 + (uint32_t) ( ( random_value >> 40 ) % 4 ) );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->number_of_links,
+		 number_of_links );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->access_time,
+		 timestamp + 2 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->access_time_nano_seconds,
+		 (uint32_t) ( random_value % 1000000000UL ) );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->modification_time,
+		 timestamp + 1 );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->inode_change_time,
+		 timestamp + 1 );
+	}
+	( (fsxfs_inode_v2_t *) image->inode_data )->fork_type = 2;
+
+	( (fsxfs_inode_v2_t *) image->inode_data )->attributes_fork_type = 2;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->generation_number,
+	 (uint32_t) ( random_value >> 16 ) );
+
+	/* The next unlinked inode number
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->next_unlinked_inode_number,
+	 FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT );
+
+	if( image->format_version >= 5 )
+	{
+		if( file_mode != 0 )
+		{
+			byte_stream_copy_from_uint32_big_endian(
+			 ( (fsxfs_inode_v3_t *) image->inode_data )->creation_time,
+			 timestamp );
+		}
+		byte_stream_copy_from_uint64_big_endian(
+		 ( (fsxfs_inode_v3_t *) image->inode_data )->inode_number,
+		 inode_number );
+
+		memory_copy(
+		 ( (fsxfs_inode_v3_t *) image->inode_data )->inode_type_identifier,
+		 image->file_system_identifier,
+		 16 );
+	}
+}
+
+/* Writes the inode buffer
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_inode(
+     fsxfs_generate_image_t *image,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	uint64_t relative_inode_number  = 0;
+	uint32_t allocation_group_index = 0;
+
+	if( image->format_version >= 5 )
+	{
+		fsxfs_generate_set_checksum(
+		 image->inode_data,
+		 image->inode_size,
+		 100 );
+	}
+	allocation_group_index = (uint32_t) ( inode_number >> ( image->allocation_group_size_log2 + image->inodes_per_block_log2 ) );
+	relative_inode_number  = inode_number & ( ( (uint64_t) 1 << ( image->allocation_group_size_log2 + image->inodes_per_block_log2 ) ) - 1 );
+
+	return( fsxfs_generate_write_at_offset(
+	         image,
+	         image->inode_data,
+	         image->inode_size,
+	         fsxfs_generate_get_block_offset(
+	          image,
+	          allocation_group_index,
+	          (uint32_t) ( relative_inode_number >> image->inodes_per_block_log2 ) )
+	         + ( ( relative_inode_number & ( ( 1 << image->inodes_per_block_log2 ) - 1 ) ) * image->inode_size ),
+	         error ) );
+}
+
+/* Writes a regular file
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_file(
+     fsxfs_generate_image_t *image,
+     uint32_t object_index,
+     libcerror_error_t **error )
+{
+	fsxfs_generate_extent_t *extents = NULL;
+	static char *function            = "fsxfs_generate_write_file";
+	uint64_t data_size               = 0;
+	uint64_t inode_number            = 0;
+	uint64_t logical_block_number    = 0;
+	uint64_t number_of_btree_blocks  = 0;
+	uint64_t random_value            = 0;
+	size_t data_offset               = 0;
+	uint32_t allocation_group_index  = 0;
+	uint32_t block_index             = 0;
+	uint32_t extent_index            = 0;
+	uint32_t relative_block_number   = 0;
+	uint8_t fork_type                = 0;
+	int result                       = -1;
+
+	inode_number = fsxfs_generate_get_inode_number(
+	                image,
+	                object_index );
+
+	if( image->extents_per_file > 0 )
+	{
+		extents = (fsxfs_generate_extent_t *) memory_allocate(
+		                                       sizeof( fsxfs_generate_extent_t ) * image->extents_per_file );
+
+		if( extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < image->extents_per_file;
+	     extent_index++ )
+	{
+		/* Allocate an additional block so that consecutive extents are not
+		 * physically adjacent and remain separate extents
+		 */
+		if( fsxfs_generate_allocate_blocks(
+		     image,
+		     fsxfs_generate_get_allocation_group_index(
+		      image,
+		      object_index ),
+		     image->blocks_per_extent + 1,
+		     &allocation_group_index,
+		     &relative_block_number,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extents[ extent_index ].logical_block_number  = logical_block_number;
+		extents[ extent_index ].physical_block_number = fsxfs_generate_get_file_system_block_number(
+		                                                 image,
+		                                                 allocation_group_index,
+		                                                 relative_block_number );
+		extents[ extent_index ].number_of_blocks      = image->blocks_per_extent;
+
+		if( image->metadata_only == 0 )
+		{
+			for( block_index = 0;
+			     block_index < image->blocks_per_extent;
+			     block_index++ )
+			{
+				random_value = fsxfs_generate_mix(
+				                image->seed ^ ( inode_number << 20 ) ^ ( logical_block_number + block_index ) );
+
+				for( data_offset = 0;
+				     data_offset < image->block_size;
+				     data_offset += 8 )
+				{
+					random_value = fsxfs_generate_mix(
+					                random_value );
+
+					byte_stream_copy_from_uint64_big_endian(
+					 &( image->block_data[ data_offset ] ),
+					 random_value );
+				}
+				if( fsxfs_generate_write_block(
+				     image,
+				     allocation_group_index,
+				     relative_block_number + block_index,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+		}
+		logical_block_number += image->blocks_per_extent;
+
+		if( image->sparse != 0 )
+		{
+			logical_block_number += image->blocks_per_extent;
+		}
+	}
+	if( image->extents_per_file > 0 )
+	{
+		if( image->sparse != 0 )
+		{
+			logical_block_number -= image->blocks_per_extent;
+		}
+		/* The last block is partially used
+		 */
+		data_size = ( logical_block_number * image->block_size )
+		          - ( fsxfs_generate_mix( image->seed ^ inode_number ) % ( image->block_size / 2 ) );
+	}
+	fsxfs_generate_initialize_inode(
+	 image,
+	 inode_number,
+	 0x81a4,
+	 1 );
+
+	if( fsxfs_generate_write_data_fork(
+	     image,
+	     inode_number,
+	     fsxfs_generate_get_allocation_group_index(
+	      image,
+	      object_index ),
+	     extents,
+	     image->extents_per_file,
+	     &fork_type,
+	     &number_of_btree_blocks,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (fsxfs_inode_v2_t *) image->inode_data )->fork_type = fork_type;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->data_size,
+	 data_size );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->number_of_blocks,
+	 ( (uint64_t) image->extents_per_file * image->blocks_per_extent ) + number_of_btree_blocks );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->number_of_data_extents,
+	 image->extents_per_file );
+
+	if( fsxfs_generate_write_inode(
+	     image,
+	     inode_number,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	return( result );
+}
+
+/* Retrieves the size of a directory data entry
+ */
+size_t fsxfs_generate_get_directory_data_entry_size(
+        fsxfs_generate_image_t *image,
+        size_t name_size )
+{
+	size_t entry_size = 8 + 1 + name_size + 2;
+
+	if( image->has_file_type != 0 )
+	{
+		entry_size += 1;
+	}
+	return( ( entry_size + 7 ) & ~( (size_t) 7 ) );
+}
+
+/* Writes a directory data entry
+ * Returns the size of the entry
+ */
+size_t fsxfs_generate_write_directory_data_entry(
+        fsxfs_generate_image_t *image,
+        uint8_t *data,
+        size_t data_offset,
+        uint64_t inode_number,
+        const char *name,
+        size_t name_size,
+        uint8_t file_type )
+{
+	size_t entry_size = 0;
+
+	entry_size = fsxfs_generate_get_directory_data_entry_size(
+	              image,
+	              name_size );
+
+	memory_set(
+	 &( data[ data_offset ] ),
+	 0,
+	 entry_size );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( data[ data_offset ] ),
+	 inode_number );
+
+	data[ data_offset + 8 ] = (uint8_t) name_size;
+
+	memory_copy(
+	 &( data[ data_offset + 9 ] ),
+	 name,
+	 name_size );
+
+	if( image->has_file_type != 0 )
+	{
+		data[ data_offset + 9 + name_size ] = file_type;
+	}
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ data_offset + entry_size - 2 ] ),
+	 (uint16_t) data_offset );
+
+	return( entry_size );
+}
+
+/* Writes an unused directory data region and updates the best free values of the data header
+ */
+void fsxfs_generate_write_directory_unused_region(
+      fsxfs_generate_image_t *image,
+      uint8_t *data,
+      size_t data_offset,
+      size_t region_size )
+{
+	size_t header_size = 0;
+
+	if( region_size < 8 )
+	{
+		return;
+	}
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ data_offset ] ),
+	 0xffff );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ data_offset + 2 ] ),
+	 (uint16_t) region_size );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ data_offset + region_size - 2 ] ),
+	 (uint16_t) data_offset );
+
+	if( image->format_version < 5 )
+	{
+		header_size = 4;
+	}
+	else
+	{
+		header_size = 48;
+	}
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ header_size ] ),
+	 (uint16_t) data_offset );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ header_size + 2 ] ),
+	 (uint16_t) region_size );
+}
+
+/* Writes a directory block header
+ * Returns the size of the header
+ */
+size_t fsxfs_generate_write_directory_block_header(
+        fsxfs_generate_image_t *image,
+        uint8_t *data,
+        const char *signature,
+        uint64_t file_system_block,
+        uint64_t inode_number )
+{
+	memory_copy(
+	 data,
+	 signature,
+	 4 );
+
+	if( image->format_version < 5 )
+	{
+		return( sizeof( fsxfs_block_directory_header_v2_t ) );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_block_directory_header_v3_t *) data )->block_number,
+	 (uint64_t) fsxfs_generate_get_block_offset(
+	  image,
+	  (uint32_t) ( file_system_block >> image->allocation_group_size_log2 ),
+	  (uint32_t) ( file_system_block & ( ( (uint64_t) 1 << image->allocation_group_size_log2 ) - 1 ) ) ) / FSXFS_GENERATE_SECTOR_SIZE );
+
+	memory_copy(
+	 ( (fsxfs_block_directory_header_v3_t *) data )->block_type_identifier,
+	 image->file_system_identifier,
+	 16 );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_block_directory_header_v3_t *) data )->owner_inode_number,
+	 inode_number );
+
+	return( sizeof( fsxfs_block_directory_header_v3_t ) );
+}
+
+/* Writes a directory dabtree block information header
+ * Returns the size of the header
+ */
+size_t fsxfs_generate_write_directory_node_header(
+        fsxfs_generate_image_t *image,
+        uint8_t *data,
+        uint16_t signature,
+        uint32_t next_block_number,
+        uint32_t previous_block_number,
+        uint64_t file_system_block,
+        uint64_t inode_number )
+{
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 0 ] ),
+	 next_block_number );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( data[ 4 ] ),
+	 previous_block_number );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 &( data[ 8 ] ),
+	 signature );
+
+	if( image->format_version < 5 )
+	{
+		return( 12 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( data[ 16 ] ),
+	 (uint64_t) fsxfs_generate_get_block_offset(
+	  image,
+	  (uint32_t) ( file_system_block >> image->allocation_group_size_log2 ),
+	  (uint32_t) ( file_system_block & ( ( (uint64_t) 1 << image->allocation_group_size_log2 ) - 1 ) ) ) / FSXFS_GENERATE_SECTOR_SIZE );
+
+	memory_copy(
+	 &( data[ 32 ] ),
+	 image->file_system_identifier,
+	 16 );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( data[ 48 ] ),
+	 inode_number );
+
+	return( 56 );
+}
+
+/* Writes a directory as a short form, block, leaf or node directory
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_directory(
+     fsxfs_generate_image_t *image,
+     uint32_t object_index,
+     libcerror_error_t **error )
+{
+	char name[ 64 ];
+
+	fsxfs_generate_directory_entry_t *leaf_entries = NULL;
+	fsxfs_generate_extent_t extents[ 3 ];
+	uint16_t *best_free_sizes                      = NULL;
+	uint8_t *data_fork                             = NULL;
+	static char *function                          = "fsxfs_generate_write_directory";
+	size_t data_fork_size                          = 0;
+	size_t data_header_size                        = 0;
+	size_t data_offset                             = 0;
+	size_t entry_size                              = 0;
+	size_t leaf_header_size                        = 0;
+	size_t maximum_number_of_entries               = 0;
+	size_t name_size                               = 0;
+	size_t short_form_size                         = 0;
+	uint64_t child_inode_number                    = 0;
+	uint64_t directory_size                        = 0;
+	uint64_t file_system_block                     = 0;
+	uint64_t inode_number                          = 0;
+	uint64_t number_of_btree_blocks                = 0;
+	uint64_t number_of_blocks                      = 0;
+	uint64_t parent_inode_number                   = 0;
+	uint32_t allocation_group_index                = 0;
+	uint32_t block_index                           = 0;
+	uint32_t child_index                           = 0;
+	uint32_t entry_index                           = 0;
+	uint32_t entries_in_block                      = 0;
+	uint32_t first_child_index                     = 0;
+	uint32_t first_entry_index                     = 0;
+	uint32_t first_leaf_block                      = 0;
+	uint32_t number_of_children                    = 0;
+	uint32_t number_of_data_blocks                 = 0;
+	uint32_t number_of_entries                     = 0;
+	uint32_t number_of_extents                     = 0;
+	uint32_t number_of_free_blocks                 = 0;
+	uint32_t number_of_leaf_blocks                 = 0;
+	uint32_t number_of_node_entries                = 0;
+	uint32_t number_of_subdirectories              = 0;
+	uint32_t parent_index                          = 0;
+	uint32_t relative_block_number                 = 0;
+	uint32_t *node_block_numbers                   = NULL;
+	uint32_t *node_hashes                          = NULL;
+	uint16_t level                                 = 0;
+	uint8_t file_type                              = 0;
+	uint8_t fork_type                              = 0;
+	int result                                     = -1;
+
+	fsxfs_generate_get_directory_hierarchy(
+	 image,
+	 object_index,
+	 &parent_index,
+	 &first_child_index,
+	 &number_of_children );
+
+	inode_number = fsxfs_generate_get_inode_number(
+	                image,
+	                object_index );
+
+	parent_inode_number = fsxfs_generate_get_inode_number(
+	                       image,
+	                       parent_index );
+
+	for( child_index = first_child_index;
+	     child_index < ( first_child_index + number_of_children );
+	     child_index++ )
+	{
+		if( child_index < fsxfs_generate_get_first_file_index( image ) )
+		{
+			number_of_subdirectories++;
+		}
+	}
+	data_fork      = &( image->inode_data[ image->inode_core_size ] );
+	data_fork_size = image->inode_size - image->inode_core_size;
+
+	if( image->format_version < 5 )
+	{
+		data_header_size = sizeof( fsxfs_block_directory_header_v2_t );
+		leaf_header_size = FSXFS_GENERATE_DIRECTORY_LEAF_V4_HEADER_SIZE;
+	}
+	else
+	{
+		data_header_size = sizeof( fsxfs_block_directory_header_v3_t );
+		leaf_header_size = FSXFS_GENERATE_DIRECTORY_LEAF_V5_HEADER_SIZE;
+	}
+	/* Determine if the directory fits in the inode as a short form directory
+	 */
+	if( ( ( parent_inode_number >> 32 ) == 0 )
+	 && ( number_of_children < 256 ) )
+	{
+		short_form_size = 6;
+
+		for( child_index = first_child_index;
+		     child_index < ( first_child_index + number_of_children );
+		     child_index++ )
+		{
+			if( ( fsxfs_generate_get_inode_number( image, child_index ) >> 32 ) != 0 )
+			{
+				short_form_size = data_fork_size + 1;
+
+				break;
+			}
+			name_size = fsxfs_generate_get_name(
+			             image,
+			             child_index,
+			             name,
+			             64 );
+
+			short_form_size += 1 + 2 + name_size + 4;
+
+			if( image->has_file_type != 0 )
+			{
+				short_form_size += 1;
+			}
+		}
+	}
+	else
+	{
+		short_form_size = data_fork_size + 1;
+	}
+	fsxfs_generate_initialize_inode(
+	 image,
+	 inode_number,
+	 0x41ed,
+	 2 + number_of_subdirectories );
+
+	if( short_form_size <= data_fork_size )
+	{
+		data_fork[ 0 ] = (uint8_t) number_of_children;
+		data_fork[ 1 ] = 0;
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data_fork[ 2 ] ),
+		 (uint32_t) parent_inode_number );
+
+		data_offset = 6;
+
+		/* The offset values are the offsets the entries would have in a block directory
+		 */
+		entry_size = data_header_size
+		           + fsxfs_generate_get_directory_data_entry_size( image, 1 )
+		           + fsxfs_generate_get_directory_data_entry_size( image, 2 );
+
+		for( child_index = first_child_index;
+		     child_index < ( first_child_index + number_of_children );
+		     child_index++ )
+		{
+			name_size = fsxfs_generate_get_name(
+			             image,
+			             child_index,
+			             name,
+			             64 );
+
+			data_fork[ data_offset ] = (uint8_t) name_size;
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( data_fork[ data_offset + 1 ] ),
+			 (uint16_t) entry_size );
+
+			memory_copy(
+			 &( data_fork[ data_offset + 3 ] ),
+			 name,
+			 name_size );
+
+			data_offset += 3 + name_size;
+
+			if( image->has_file_type != 0 )
+			{
+				if( child_index < fsxfs_generate_get_first_file_index( image ) )
+				{
+					data_fork[ data_offset ] = FSXFS_GENERATE_FILE_TYPE_DIRECTORY;
+				}
+				else
+				{
+					data_fork[ data_offset ] = FSXFS_GENERATE_FILE_TYPE_REGULAR_FILE;
+				}
+				data_offset += 1;
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 &( data_fork[ data_offset ] ),
+			 (uint32_t) fsxfs_generate_get_inode_number( image, child_index ) );
+
+			data_offset += 4;
+			entry_size  += fsxfs_generate_get_directory_data_entry_size( image, name_size );
+		}
+		( (fsxfs_inode_v2_t *) image->inode_data )->fork_type = 1;
+
+		byte_stream_copy_from_uint64_big_endian(
+		 ( (fsxfs_inode_v2_t *) image->inode_data )->data_size,
+		 (uint64_t) data_offset );
+
+		result = fsxfs_generate_write_inode(
+		          image,
+		          inode_number,
+		          error );
+
+		return( result );
+	}
+	/* Lay out the entries in data blocks and collect the leaf entries
+	 */
+	number_of_entries = number_of_children + 2;
+
+	leaf_entries = (fsxfs_generate_directory_entry_t *) memory_allocate(
+	                                                     sizeof( fsxfs_generate_directory_entry_t ) * number_of_entries );
+
+	if( leaf_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create leaf entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the number of data blocks
+	 */
+	data_offset           = data_header_size;
+	number_of_data_blocks = 1;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_index == 0 )
+		{
+			name_size = 1;
+		}
+		else if( entry_index == 1 )
+		{
+			name_size = 2;
+		}
+		else
+		{
+			name_size = fsxfs_generate_get_name(
+			             image,
+			             first_child_index + entry_index - 2,
+			             name,
+			             64 );
+		}
+		entry_size = fsxfs_generate_get_directory_data_entry_size(
+		              image,
+		              name_size );
+
+		if( ( data_offset + entry_size ) > image->block_size )
+		{
+			number_of_data_blocks++;
+
+			data_offset = data_header_size;
+		}
+		data_offset += entry_size;
+	}
+	/* A single block directory stores the leaf entries and a footer in the data block
+	 */
+	if( ( number_of_data_blocks == 1 )
+	 && ( ( data_offset + ( number_of_entries * 8 ) + 8 ) <= image->block_size ) )
+	{
+		number_of_leaf_blocks = 0;
+	}
+	else if( ( leaf_header_size + ( number_of_entries * 8 ) + ( number_of_data_blocks * 2 ) + 4 ) <= image->block_size )
+	{
+		number_of_leaf_blocks = 1;
+	}
+	else
+	{
+		maximum_number_of_entries = ( image->block_size - leaf_header_size ) / 8;
+
+		number_of_leaf_blocks = (uint32_t) ( ( number_of_entries + maximum_number_of_entries - 1 ) / maximum_number_of_entries );
+	}
+	if( number_of_leaf_blocks != 0 )
+	{
+		if( image->format_version < 5 )
+		{
+			maximum_number_of_entries = ( image->block_size - FSXFS_GENERATE_DIRECTORY_FREE_V4_HEADER_SIZE ) / 2;
+		}
+		else
+		{
+			maximum_number_of_entries = ( image->block_size - FSXFS_GENERATE_DIRECTORY_FREE_V5_HEADER_SIZE ) / 2;
+		}
+		best_free_sizes = (uint16_t *) memory_allocate(
+		                                sizeof( uint16_t ) * number_of_data_blocks );
+
+		if( best_free_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create best free sizes.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_leaf_blocks > 1 )
+		{
+			number_of_free_blocks = (uint32_t) ( ( number_of_data_blocks + maximum_number_of_entries - 1 ) / maximum_number_of_entries );
+		}
+	}
+	/* Write the data blocks
+	 */
+	if( fsxfs_generate_allocate_blocks(
+	     image,
+	     fsxfs_generate_get_allocation_group_index(
+	      image,
+	      object_index ),
+	     number_of_data_blocks,
+	     &allocation_group_index,
+	     &relative_block_number,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	extents[ 0 ].logical_block_number  = 0;
+	extents[ 0 ].physical_block_number = fsxfs_generate_get_file_system_block_number(
+	                                      image,
+	                                      allocation_group_index,
+	                                      relative_block_number );
+	extents[ 0 ].number_of_blocks      = number_of_data_blocks;
+
+	number_of_extents = 1;
+	number_of_blocks  = number_of_data_blocks;
+	block_index       = 0;
+	entry_index       = 0;
+
+	while( block_index < number_of_data_blocks )
+	{
+		file_system_block = extents[ 0 ].physical_block_number + block_index;
+
+		memory_set(
+		 image->block_data,
+		 0,
+		 image->block_size );
+
+		if( number_of_leaf_blocks == 0 )
+		{
+			data_offset = fsxfs_generate_write_directory_block_header(
+			               image,
+			               image->block_data,
+			               ( image->format_version < 5 ) ? "XD2B" : "XDB3",
+			               file_system_block,
+			               inode_number );
+		}
+		else
+		{
+			data_offset = fsxfs_generate_write_directory_block_header(
+			               image,
+			               image->block_data,
+			               ( image->format_version < 5 ) ? "XD2D" : "XDD3",
+			               file_system_block,
+			               inode_number );
+		}
+		while( entry_index < number_of_entries )
+		{
+			if( entry_index == 0 )
+			{
+				name_size          = 1;
+				child_inode_number = inode_number;
+				file_type          = FSXFS_GENERATE_FILE_TYPE_DIRECTORY;
+
+				name[ 0 ] = '.';
+			}
+			else if( entry_index == 1 )
+			{
+				name_size          = 2;
+				child_inode_number = parent_inode_number;
+				file_type          = FSXFS_GENERATE_FILE_TYPE_DIRECTORY;
+
+				name[ 0 ] = '.';
+				name[ 1 ] = '.';
+			}
+			else
+			{
+				child_index = first_child_index + entry_index - 2;
+
+				name_size = fsxfs_generate_get_name(
+				             image,
+				             child_index,
+				             name,
+				             64 );
+
+				child_inode_number = fsxfs_generate_get_inode_number(
+				                      image,
+				                      child_index );
+
+				if( child_index < fsxfs_generate_get_first_file_index( image ) )
+				{
+					file_type = FSXFS_GENERATE_FILE_TYPE_DIRECTORY;
+				}
+				else
+				{
+					file_type = FSXFS_GENERATE_FILE_TYPE_REGULAR_FILE;
+				}
+			}
+			entry_size = fsxfs_generate_get_directory_data_entry_size(
+			              image,
+			              name_size );
+
+			if( ( data_offset + entry_size ) > image->block_size )
+			{
+				break;
+			}
+			leaf_entries[ entry_index ].name_hash = fsxfs_generate_get_name_hash(
+			                                         (uint8_t *) name,
+			                                         name_size );
+			leaf_entries[ entry_index ].address   = (uint32_t) ( ( ( (uint64_t) block_index * image->block_size ) + data_offset ) / 8 );
+
+			data_offset += fsxfs_generate_write_directory_data_entry(
+			                image,
+			                image->block_data,
+			                data_offset,
+			                child_inode_number,
+			                name,
+			                name_size,
+			                file_type );
+
+			entry_index++;
+		}
+		if( number_of_leaf_blocks == 0 )
+		{
+			/* The leaf entries are sorted by hash and followed by the footer
+			 */
+			qsort(
+			 leaf_entries,
+			 number_of_entries,
+			 sizeof( fsxfs_generate_directory_entry_t ),
+			 &fsxfs_generate_directory_entry_compare );
+
+			fsxfs_generate_write_directory_unused_region(
+			 image,
+			 image->block_data,
+			 data_offset,
+			 image->block_size - 8 - ( number_of_entries * 8 ) - data_offset );
+
+			data_offset = image->block_size - 8 - ( number_of_entries * 8 );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				byte_stream_copy_from_uint32_big_endian(
+				 &( image->block_data[ data_offset ] ),
+				 leaf_entries[ entry_index ].name_hash );
+
+				byte_stream_copy_from_uint32_big_endian(
+				 &( image->block_data[ data_offset + 4 ] ),
+				 leaf_entries[ entry_index ].address );
+
+				data_offset += 8;
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset ] ),
+			 number_of_entries );
+		}
+		else
+		{
+			fsxfs_generate_write_directory_unused_region(
+			 image,
+			 image->block_data,
+			 data_offset,
+			 image->block_size - data_offset );
+
+			if( data_offset < image->block_size )
+			{
+				best_free_sizes[ block_index ] = (uint16_t) ( image->block_size - data_offset );
+			}
+			else
+			{
+				best_free_sizes[ block_index ] = 0;
+			}
+		}
+		if( image->format_version >= 5 )
+		{
+			fsxfs_generate_set_checksum(
+			 image->block_data,
+			 image->block_size,
+			 4 );
+		}
+		if( fsxfs_generate_write_block(
+		     image,
+		     allocation_group_index,
+		     relative_block_number + block_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		block_index++;
+	}
+	directory_size = (uint64_t) number_of_data_blocks * image->block_size;
+
+	if( number_of_leaf_blocks > 0 )
+	{
+		qsort(
+		 leaf_entries,
+		 number_of_entries,
+		 sizeof( fsxfs_generate_directory_entry_t ),
+		 &fsxfs_generate_directory_entry_compare );
+
+		first_leaf_block = (uint32_t) ( FSXFS_GENERATE_DIRECTORY_LEAF_OFFSET / image->block_size );
+	}
+	if( number_of_leaf_blocks == 1 )
+	{
+		/* Write a single leaf directory block
+		 */
+		if( fsxfs_generate_allocate_blocks(
+		     image,
+		     allocation_group_index,
+		     1,
+		     &allocation_group_index,
+		     &relative_block_number,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extents[ 1 ].logical_block_number  = first_leaf_block;
+		extents[ 1 ].physical_block_number = fsxfs_generate_get_file_system_block_number(
+		                                      image,
+		                                      allocation_group_index,
+		                                      relative_block_number );
+		extents[ 1 ].number_of_blocks      = 1;
+
+		number_of_extents = 2;
+		number_of_blocks += 1;
+
+		memory_set(
+		 image->block_data,
+		 0,
+		 image->block_size );
+
+		data_offset = fsxfs_generate_write_directory_node_header(
+		               image,
+		               image->block_data,
+		               ( image->format_version < 5 ) ? 0xd2f1 : 0x3df1,
+		               0,
+		               0,
+		               extents[ 1 ].physical_block_number,
+		               inode_number );
+
+		byte_stream_copy_from_uint16_big_endian(
+		 &( image->block_data[ leaf_header_size - ( ( image->format_version < 5 ) ? 4 : 8 ) ] ),
+		 (uint16_t) number_of_entries );
+
+		data_offset = leaf_header_size;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset ] ),
+			 leaf_entries[ entry_index ].name_hash );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset + 4 ] ),
+			 leaf_entries[ entry_index ].address );
+
+			data_offset += 8;
+		}
+		/* The best free sizes precede the tail (number of best free sizes)
+		 */
+		data_offset = image->block_size - 4 - ( number_of_data_blocks * 2 );
+
+		for( block_index = 0;
+		     block_index < number_of_data_blocks;
+		     block_index++ )
+		{
+			byte_stream_copy_from_uint16_big_endian(
+			 &( image->block_data[ data_offset ] ),
+			 best_free_sizes[ block_index ] );
+
+			data_offset += 2;
+		}
+		byte_stream_copy_from_uint32_big_endian(
+		 &( image->block_data[ data_offset ] ),
+		 number_of_data_blocks );
+
+		if( image->format_version >= 5 )
+		{
+			fsxfs_generate_set_checksum(
+			 image->block_data,
+			 image->block_size,
+			 12 );
+		}
+		if( fsxfs_generate_write_block(
+		     image,
+		     allocation_group_index,
+		     relative_block_number,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else if( number_of_leaf_blocks > 1 )
+	{
+		/* Write a node directory: the dabtree node blocks followed by the leaf
+		 * blocks in the leaf section and the free index blocks in the free section
+		 */
+		maximum_number_of_entries = ( image->block_size - leaf_header_size ) / 8;
+
+		node_hashes = (uint32_t *) memory_allocate(
+		                            sizeof( uint32_t ) * number_of_leaf_blocks );
+
+		node_block_numbers = (uint32_t *) memory_allocate(
+		                                   sizeof( uint32_t ) * number_of_leaf_blocks );
+
+		if( ( node_hashes == NULL )
+		 || ( node_block_numbers == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create node entries.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the number of dabtree node blocks, the root is stored
+		 * in the first block of the leaf section
+		 */
+		number_of_node_entries = number_of_leaf_blocks;
+		block_index            = 0;
+
+		do
+		{
+			number_of_node_entries = (uint32_t) ( ( number_of_node_entries + ( ( image->block_size - leaf_header_size ) / 8 ) - 1 ) / ( ( image->block_size - leaf_header_size ) / 8 ) );
+
+			block_index += number_of_node_entries;
+		}
+		while( number_of_node_entries > 1 );
+
+		if( fsxfs_generate_allocate_blocks(
+		     image,
+		     allocation_group_index,
+		     block_index + number_of_leaf_blocks,
+		     &allocation_group_index,
+		     &relative_block_number,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extents[ 1 ].logical_block_number  = first_leaf_block;
+		extents[ 1 ].physical_block_number = fsxfs_generate_get_file_system_block_number(
+		                                      image,
+		                                      allocation_group_index,
+		                                      relative_block_number );
+		extents[ 1 ].number_of_blocks      = block_index + number_of_leaf_blocks;
+
+		number_of_blocks += extents[ 1 ].number_of_blocks;
+
+		/* The leaf blocks are stored after the node blocks
+		 */
+		first_entry_index = 0;
+
+		for( child_index = 0;
+		     child_index < number_of_leaf_blocks;
+		     child_index++ )
+		{
+			entries_in_block = number_of_entries - first_entry_index;
+
+			if( entries_in_block > maximum_number_of_entries )
+			{
+				entries_in_block = (uint32_t) maximum_number_of_entries;
+			}
+			memory_set(
+			 image->block_data,
+			 0,
+			 image->block_size );
+
+			fsxfs_generate_write_directory_node_header(
+			 image,
+			 image->block_data,
+			 ( image->format_version < 5 ) ? 0xd2ff : 0x3dff,
+			 ( ( child_index + 1 ) < number_of_leaf_blocks ) ? first_leaf_block + block_index + child_index + 1 : 0,
+			 ( child_index > 0 ) ? first_leaf_block + block_index + child_index - 1 : 0,
+			 extents[ 1 ].physical_block_number + block_index + child_index,
+			 inode_number );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( image->block_data[ leaf_header_size - ( ( image->format_version < 5 ) ? 4 : 8 ) ] ),
+			 (uint16_t) entries_in_block );
+
+			data_offset = leaf_header_size;
+
+			for( entry_index = 0;
+			     entry_index < entries_in_block;
+			     entry_index++ )
+			{
+				byte_stream_copy_from_uint32_big_endian(
+				 &( image->block_data[ data_offset ] ),
+				 leaf_entries[ first_entry_index + entry_index ].name_hash );
+
+				byte_stream_copy_from_uint32_big_endian(
+				 &( image->block_data[ data_offset + 4 ] ),
+				 leaf_entries[ first_entry_index + entry_index ].address );
+
+				data_offset += 8;
+			}
+			if( image->format_version >= 5 )
+			{
+				fsxfs_generate_set_checksum(
+				 image->block_data,
+				 image->block_size,
+				 12 );
+			}
+			if( fsxfs_generate_write_block(
+			     image,
+			     allocation_group_index,
+			     relative_block_number + block_index + child_index,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			/* The hash of a node entry is the largest hash in the child block
+			 */
+			node_hashes[ child_index ]        = leaf_entries[ first_entry_index + entries_in_block - 1 ].name_hash;
+			node_block_numbers[ child_index ] = first_leaf_block + block_index + child_index;
+
+			first_entry_index += entries_in_block;
+		}
+		/* Write the node blocks bottom-up, from the end of the node area towards the root
+		 */
+		number_of_node_entries = number_of_leaf_blocks;
+		maximum_number_of_entries = ( image->block_size - leaf_header_size ) / 8;
+		level                  = 1;
+
+		while( block_index > 0 )
+		{
+			number_of_leaf_blocks = (uint32_t) ( ( number_of_node_entries + maximum_number_of_entries - 1 ) / maximum_number_of_entries );
+
+			block_index      -= number_of_leaf_blocks;
+			first_entry_index = 0;
+
+			for( child_index = 0;
+			     child_index < number_of_leaf_blocks;
+			     child_index++ )
+			{
+				entries_in_block = number_of_node_entries - first_entry_index;
+
+				if( entries_in_block > maximum_number_of_entries )
+				{
+					entries_in_block = (uint32_t) maximum_number_of_entries;
+				}
+				memory_set(
+				 image->block_data,
+				 0,
+				 image->block_size );
+
+				fsxfs_generate_write_directory_node_header(
+				 image,
+				 image->block_data,
+				 ( image->format_version < 5 ) ? 0xfebe : 0x3ebe,
+				 ( ( child_index + 1 ) < number_of_leaf_blocks ) ? first_leaf_block + block_index + child_index + 1 : 0,
+				 ( child_index > 0 ) ? first_leaf_block + block_index + child_index - 1 : 0,
+				 extents[ 1 ].physical_block_number + block_index + child_index,
+				 inode_number );
+
+				byte_stream_copy_from_uint16_big_endian(
+				 &( image->block_data[ leaf_header_size - ( ( image->format_version < 5 ) ? 4 : 8 ) ] ),
+				 (uint16_t) entries_in_block );
+
+				byte_stream_copy_from_uint16_big_endian(
+				 &( image->block_data[ leaf_header_size - ( ( image->format_version < 5 ) ? 2 : 6 ) ] ),
+				 level );
+
+				data_offset = leaf_header_size;
+
+				for( entry_index = 0;
+				     entry_index < entries_in_block;
+				     entry_index++ )
+				{
+					byte_stream_copy_from_uint32_big_endian(
+					 &( image->block_data[ data_offset ] ),
+					 node_hashes[ first_entry_index + entry_index ] );
+
+					byte_stream_copy_from_uint32_big_endian(
+					 &( image->block_data[ data_offset + 4 ] ),
+					 node_block_numbers[ first_entry_index + entry_index ] );
+
+					data_offset += 8;
+				}
+				if( image->format_version >= 5 )
+				{
+					fsxfs_generate_set_checksum(
+					 image->block_data,
+					 image->block_size,
+					 12 );
+				}
+				if( fsxfs_generate_write_block(
+				     image,
+				     allocation_group_index,
+				     relative_block_number + block_index + child_index,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				node_hashes[ child_index ]        = node_hashes[ first_entry_index + entries_in_block - 1 ];
+				node_block_numbers[ child_index ] = first_leaf_block + block_index + child_index;
+
+				first_entry_index += entries_in_block;
+			}
+			number_of_node_entries = number_of_leaf_blocks;
+
+			level++;
+		}
+		/* Write the free index blocks
+		 */
+		if( fsxfs_generate_allocate_blocks(
+		     image,
+		     allocation_group_index,
+		     number_of_free_blocks,
+		     &allocation_group_index,
+		     &relative_block_number,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extents[ 2 ].logical_block_number  = FSXFS_GENERATE_DIRECTORY_FREE_OFFSET / image->block_size;
+		extents[ 2 ].physical_block_number = fsxfs_generate_get_file_system_block_number(
+		                                      image,
+		                                      allocation_group_index,
+		                                      relative_block_number );
+		extents[ 2 ].number_of_blocks      = number_of_free_blocks;
+
+		number_of_extents = 3;
+		number_of_blocks += number_of_free_blocks;
+
+		if( image->format_version < 5 )
+		{
+			maximum_number_of_entries = ( image->block_size - FSXFS_GENERATE_DIRECTORY_FREE_V4_HEADER_SIZE ) / 2;
+		}
+		else
+		{
+			maximum_number_of_entries = ( image->block_size - FSXFS_GENERATE_DIRECTORY_FREE_V5_HEADER_SIZE ) / 2;
+		}
+		first_entry_index = 0;
+
+		for( block_index = 0;
+		     block_index < number_of_free_blocks;
+		     block_index++ )
+		{
+			entries_in_block = number_of_data_blocks - first_entry_index;
+
+			if( entries_in_block > maximum_number_of_entries )
+			{
+				entries_in_block = (uint32_t) maximum_number_of_entries;
+			}
+			memory_set(
+			 image->block_data,
+			 0,
+			 image->block_size );
+
+			data_offset = fsxfs_generate_write_directory_block_header(
+			               image,
+			               image->block_data,
+			               ( image->format_version < 5 ) ? "XD2F" : "XDF3",
+			               extents[ 2 ].physical_block_number + block_index,
+			               inode_number );
+
+			if( image->format_version < 5 )
+			{
+				data_offset = 4;
+			}
+			else
+			{
+				data_offset = 48;
+			}
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset ] ),
+			 first_entry_index );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset + 4 ] ),
+			 entries_in_block );
+
+			byte_stream_copy_from_uint32_big_endian(
+			 &( image->block_data[ data_offset + 8 ] ),
+			 entries_in_block );
+
+			if( image->format_version < 5 )
+			{
+				data_offset = FSXFS_GENERATE_DIRECTORY_FREE_V4_HEADER_SIZE;
+			}
+			else
+			{
+				data_offset = FSXFS_GENERATE_DIRECTORY_FREE_V5_HEADER_SIZE;
+			}
+			for( entry_index = 0;
+			     entry_index < entries_in_block;
+			     entry_index++ )
+			{
+				byte_stream_copy_from_uint16_big_endian(
+				 &( image->block_data[ data_offset ] ),
+				 best_free_sizes[ first_entry_index + entry_index ] );
+
+				data_offset += 2;
+			}
+			if( image->format_version >= 5 )
+			{
+				fsxfs_generate_set_checksum(
+				 image->block_data,
+				 image->block_size,
+				 4 );
+			}
+			if( fsxfs_generate_write_block(
+			     image,
+			     allocation_group_index,
+			     relative_block_number + block_index,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			first_entry_index += entries_in_block;
+		}
+	}
+	if( fsxfs_generate_write_data_fork(
+	     image,
+	     inode_number,
+	     allocation_group_index,
+	     extents,
+	     number_of_extents,
+	     &fork_type,
+	     &number_of_btree_blocks,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (fsxfs_inode_v2_t *) image->inode_data )->fork_type = fork_type;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->data_size,
+	 directory_size );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->number_of_blocks,
+	 number_of_blocks + number_of_btree_blocks );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_v2_t *) image->inode_data )->number_of_data_extents,
+	 number_of_extents );
+
+	result = fsxfs_generate_write_inode(
+	          image,
+	          inode_number,
+	          error );
+
+on_error:
+	if( node_block_numbers != NULL )
+	{
+		memory_free(
+		 node_block_numbers );
+	}
+	if( node_hashes != NULL )
+	{
+		memory_free(
+		 node_hashes );
+	}
+	if( best_free_sizes != NULL )
+	{
+		memory_free(
+		 best_free_sizes );
+	}
+	if( leaf_entries != NULL )
+	{
+		memory_free(
+		 leaf_entries );
+	}
+	return( result );
+}
+
+/* Writes the allocation group headers, free space and inode B+ trees
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_allocation_group(
+     fsxfs_generate_image_t *image,
+     uint32_t allocation_group_index,
+     uint64_t *number_of_inodes,
+     uint64_t *number_of_free_inodes,
+     uint64_t *number_of_free_blocks,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ 4 * FSXFS_GENERATE_SECTOR_SIZE ];
+	uint8_t free_space_record[ 8 ];
+
+	uint8_t *inode_records              = NULL;
+	uint8_t *free_inode_records         = NULL;
+	static char *function               = "fsxfs_generate_write_allocation_group";
+	uint64_t free_mask                  = 0;
+	uint32_t chunk_index                = 0;
+	uint32_t free_blocks                = 0;
+	uint32_t last_chunk_inode_number    = 0;
+	uint32_t number_of_allocated        = 0;
+	uint32_t number_of_free_records     = 0;
+	uint32_t number_of_unused           = 0;
+	uint32_t object_index               = 0;
+	uint32_t relative_block_number      = 0;
+	uint32_t slot_index                 = 0;
+	uint32_t start_inode_number         = 0;
+	uint32_t unused_in_allocation_group = 0;
+	uint16_t free_inode_btree_levels    = 0;
+	uint16_t inode_btree_levels         = 0;
+	uint16_t number_of_free_levels      = 0;
+	uint8_t superblock_flags_offset     = 0;
+	int result                          = -1;
+
+	if( image->number_of_chunks[ allocation_group_index ] > 0 )
+	{
+		inode_records = (uint8_t *) memory_allocate(
+		                             16 * image->number_of_chunks[ allocation_group_index ] );
+
+		free_inode_records = (uint8_t *) memory_allocate(
+		                                  16 * image->number_of_chunks[ allocation_group_index ] );
+
+		if( ( inode_records == NULL )
+		 || ( free_inode_records == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inode records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Write the inode records and unused inodes of the chunks
+	 */
+	for( chunk_index = 0;
+	     chunk_index < image->number_of_chunks[ allocation_group_index ];
+	     chunk_index++ )
+	{
+		relative_block_number = image->first_chunk_block_number + ( chunk_index * image->blocks_per_chunk );
+		start_inode_number    = relative_block_number << image->inodes_per_block_log2;
+		object_index          = ( ( chunk_index * image->number_of_allocation_groups ) + allocation_group_index ) * FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK;
+		free_mask             = 0;
+		number_of_unused      = 0;
+
+		for( slot_index = 0;
+		     slot_index < FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK;
+		     slot_index++ )
+		{
+			if( ( object_index + slot_index ) < image->number_of_objects )
+			{
+				continue;
+			}
+			free_mask |= (uint64_t) 1 << slot_index;
+
+			number_of_unused++;
+
+			fsxfs_generate_initialize_inode(
+			 image,
+			 fsxfs_generate_get_inode_number(
+			  image,
+			  object_index + slot_index ),
+			 0,
+			 0 );
+
+			if( fsxfs_generate_write_inode(
+			     image,
+			     fsxfs_generate_get_inode_number(
+			      image,
+			      object_index + slot_index ),
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		byte_stream_copy_from_uint32_big_endian(
+		 &( inode_records[ chunk_index * 16 ] ),
+		 start_inode_number );
+
+		byte_stream_copy_from_uint32_big_endian(
+		 &( inode_records[ ( chunk_index * 16 ) + 4 ] ),
+		 number_of_unused );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( inode_records[ ( chunk_index * 16 ) + 8 ] ),
+		 free_mask );
+
+		if( number_of_unused > 0 )
+		{
+			memory_copy(
+			 &( free_inode_records[ number_of_free_records * 16 ] ),
+			 &( inode_records[ chunk_index * 16 ] ),
+			 16 );
+
+			number_of_free_records++;
+		}
+		number_of_allocated        += FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK;
+		unused_in_allocation_group += number_of_unused;
+		last_chunk_inode_number     = start_inode_number;
+	}
+	if( fsxfs_generate_write_short_btree(
+	     image,
+	     ( image->format_version < 5 ) ? "IABT" : "IAB3",
+	     allocation_group_index,
+	     image->number_of_header_blocks + 2,
+	     inode_records,
+	     image->number_of_chunks[ allocation_group_index ],
+	     16,
+	     4,
+	     &inode_btree_levels,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( image->format_version >= 5 )
+	{
+		if( fsxfs_generate_write_short_btree(
+		     image,
+		     "FIB3",
+		     allocation_group_index,
+		     image->number_of_header_blocks + 3,
+		     free_inode_records,
+		     number_of_free_records,
+		     16,
+		     4,
+		     &free_inode_btree_levels,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* All blocks after the last allocated block are free
+	 */
+	free_blocks = image->allocation_group_size - image->next_free_block_number[ allocation_group_index ];
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( free_space_record[ 0 ] ),
+	 image->next_free_block_number[ allocation_group_index ] );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( free_space_record[ 4 ] ),
+	 free_blocks );
+
+	if( fsxfs_generate_write_short_btree(
+	     image,
+	     ( image->format_version < 5 ) ? "ABTB" : "AB3B",
+	     allocation_group_index,
+	     image->number_of_header_blocks,
+	     free_space_record,
+	     ( free_blocks > 0 ) ? 1 : 0,
+	     8,
+	     8,
+	     &number_of_free_levels,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( fsxfs_generate_write_short_btree(
+	     image,
+	     ( image->format_version < 5 ) ? "ABTC" : "AB3C",
+	     allocation_group_index,
+	     image->number_of_header_blocks + 1,
+	     free_space_record,
+	     ( free_blocks > 0 ) ? 1 : 0,
+	     8,
+	     8,
+	     &number_of_free_levels,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Write the allocation group header sectors
+	 */
+	memory_set(
+	 header_data,
+	 0,
+	 4 * FSXFS_GENERATE_SECTOR_SIZE );
+
+	/* Allocation group free space information (AGF) in sector 1
+	 */
+	memory_copy(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE ] ),
+	 "XAGF",
+	 4 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 4 ] ),
+	 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 8 ] ),
+	 allocation_group_index );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 12 ] ),
+	 image->allocation_group_size );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 16 ] ),
+	 image->number_of_header_blocks );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 20 ] ),
+	 image->number_of_header_blocks + 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 28 ] ),
+	 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 32 ] ),
+	 1 );
+	/* The free list is empty
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 40 ] ),
+	 0 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 44 ] ),
+	 ( image->format_version < 5 ) ? ( FSXFS_GENERATE_SECTOR_SIZE / 4 ) - 1 : ( ( FSXFS_GENERATE_SECTOR_SIZE - FSXFS_GENERATE_ALLOCATION_GROUP_FREE_LIST_V5_HEADER_SIZE ) / 4 ) - 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 52 ] ),
+	 free_blocks );
+	byte_stream_copy_from_uint32_big_endian(
+	 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 56 ] ),
+	 free_blocks );
+
+	if( image->format_version >= 5 )
+	{
+		memory_copy(
+		 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE + 64 ] ),
+		 image->file_system_identifier,
+		 16 );
+
+		fsxfs_generate_set_checksum(
+		 &( header_data[ FSXFS_GENERATE_SECTOR_SIZE ] ),
+		 FSXFS_GENERATE_SECTOR_SIZE,
+		 216 );
+	}
+	/* Allocation group inode information (AGI) in sector 2
+	 */
+	memory_copy(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->signature,
+	 "XAGI",
+	 4 );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->format_version,
+	 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->sequence_number,
+	 allocation_group_index );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->unknown1,
+	 image->allocation_group_size );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->number_of_inodes,
+	 number_of_allocated );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->inode_btree_root_block_number,
+	 image->number_of_header_blocks + 2 );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->inode_btree_depth,
+	 inode_btree_levels );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->number_of_unused_inodes,
+	 unused_in_allocation_group );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->last_allocated_chunk,
+	 ( number_of_allocated > 0 ) ? last_chunk_inode_number : FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT );
+	byte_stream_copy_from_uint32_big_endian(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->unknown2,
+	 FSXFS_GENERATE_NULL_BLOCK_NUMBER_32BIT );
+
+	memory_set(
+	 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->unlinked_hash_table,
+	 0xff,
+	 64 * 4 );
+
+	if( image->format_version >= 5 )
+	{
+		memory_copy(
+		 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->block_type_identifier,
+		 image->file_system_identifier,
+		 16 );
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->free_inode_btree_root_block_number,
+		 image->number_of_header_blocks + 3 );
+		byte_stream_copy_from_uint32_big_endian(
+		 ( (fsxfs_inode_information_v5_t *) &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ) )->free_inode_btree_depth,
+		 free_inode_btree_levels );
+
+		fsxfs_generate_set_checksum(
+		 &( header_data[ 2 * FSXFS_GENERATE_SECTOR_SIZE ] ),
+		 FSXFS_GENERATE_SECTOR_SIZE,
+		 312 );
+	}
+	/* Allocation group free list (AGFL) in sector 3
+	 */
+	if( image->format_version < 5 )
+	{
+		memory_set(
+		 &( header_data[ 3 * FSXFS_GENERATE_SECTOR_SIZE ] ),
+		 0xff,
+		 FSXFS_GENERATE_SECTOR_SIZE );
+	}
+	else
+	{
+		memory_copy(
+		 &( header_data[ 3 * FSXFS_GENERATE_SECTOR_SIZE ] ),
+		 "XAFL",
+		 4 );
+		byte_stream_copy_from_uint32_big_endian(
+		 &( header_data[ ( 3 * FSXFS_GENERATE_SECTOR_SIZE ) + 4 ] ),
+		 allocation_group_index );
+		memory_copy(
+		 &( header_data[ ( 3 * FSXFS_GENERATE_SECTOR_SIZE ) + 8 ] ),
+		 image->file_system_identifier,
+		 16 );
+		memory_set(
+		 &( header_data[ ( 3 * FSXFS_GENERATE_SECTOR_SIZE ) + FSXFS_GENERATE_ALLOCATION_GROUP_FREE_LIST_V5_HEADER_SIZE ] ),
+		 0xff,
+		 FSXFS_GENERATE_SECTOR_SIZE - FSXFS_GENERATE_ALLOCATION_GROUP_FREE_LIST_V5_HEADER_SIZE );
+
+		fsxfs_generate_set_checksum(
+		 &( header_data[ 3 * FSXFS_GENERATE_SECTOR_SIZE ] ),
+		 FSXFS_GENERATE_SECTOR_SIZE,
+		 32 );
+	}
+	if( fsxfs_generate_write_at_offset(
+	     image,
+	     &( header_data[ FSXFS_GENERATE_SECTOR_SIZE ] ),
+	     3 * FSXFS_GENERATE_SECTOR_SIZE,
+	     fsxfs_generate_get_block_offset(
+	      image,
+	      allocation_group_index,
+	      0 ) + FSXFS_GENERATE_SECTOR_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	*number_of_inodes      += number_of_allocated;
+	*number_of_free_inodes += unused_in_allocation_group;
+	*number_of_free_blocks += free_blocks;
+
+	result = 1;
+
+on_error:
+	if( free_inode_records != NULL )
+	{
+		memory_free(
+		 free_inode_records );
+	}
+	if( inode_records != NULL )
+	{
+		memory_free(
+		 inode_records );
+	}
+	return( result );
+}
+
+/* Writes the superblock of an allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_superblock(
+     fsxfs_generate_image_t *image,
+     uint32_t allocation_group_index,
+     uint64_t number_of_inodes,
+     uint64_t number_of_free_inodes,
+     uint64_t number_of_free_blocks,
+     libcerror_error_t **error )
+{
+	uint8_t data[ FSXFS_GENERATE_SECTOR_SIZE ];
+
+	fsxfs_superblock_t *superblock    = NULL;
+	uint32_t secondary_feature_flags  = 0;
+	uint16_t version_and_feature_flags = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 FSXFS_GENERATE_SECTOR_SIZE );
+
+	superblock = (fsxfs_superblock_t *) data;
+
+	/* Version with the attributes, link count, alignment, extent flag,
+	 * directory version 2 and more bits feature flags
+	 */
+	version_and_feature_flags = image->format_version | 0x0010 | 0x0020 | 0x0080 | 0x1000 | 0x2000 | 0x8000;
+
+	/* Lazy superblock counters and extended attributes version 2
+	 */
+	secondary_feature_flags = 0x00000002UL | 0x00000008UL;
+
+	if( image->format_version >= 5 )
+	{
+		/* Metadata checksums and directory entry file type
+		 */
+		secondary_feature_flags |= 0x00000100UL | 0x00000200UL;
+	}
+	memory_copy(
+	 superblock->signature,
+	 "XFSB",
+	 4 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->block_size,
+	 image->block_size );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->number_of_blocks,
+	 (uint64_t) image->number_of_allocation_groups * image->allocation_group_size );
+	memory_copy(
+	 superblock->file_system_identifier,
+	 image->file_system_identifier,
+	 16 );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->journal_block_number,
+	 fsxfs_generate_get_file_system_block_number( image, 0, image->journal_block_number ) );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->root_directory_inode_number,
+	 fsxfs_generate_get_inode_number( image, 0 ) );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->realtime_bitmap_extents_inode_number,
+	 FSXFS_GENERATE_NULL_INODE_NUMBER );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->realtime_bitmap_summary_inode_number,
+	 FSXFS_GENERATE_NULL_INODE_NUMBER );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->realtime_extents_size,
+	 1 );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->allocation_group_size,
+	 image->allocation_group_size );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->number_of_allocation_groups,
+	 image->number_of_allocation_groups );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->journal_size,
+	 image->journal_size );
+	byte_stream_copy_from_uint16_big_endian(
+	 superblock->version_and_feature_flags,
+	 version_and_feature_flags );
+	byte_stream_copy_from_uint16_big_endian(
+	 superblock->sector_size,
+	 FSXFS_GENERATE_SECTOR_SIZE );
+	byte_stream_copy_from_uint16_big_endian(
+	 superblock->inode_size,
+	 image->inode_size );
+	byte_stream_copy_from_uint16_big_endian(
+	 superblock->number_of_inodes_per_block,
+	 (uint16_t) ( 1 << image->inodes_per_block_log2 ) );
+
+	narrow_string_snprintf(
+	 (char *) superblock->volume_label,
+	 12,
+	 "synthetic" );
+
+	superblock->block_size_log2                 = image->block_size_log2;
+	superblock->sector_size_log2                = 9;
+	superblock->inode_size_log2                 = image->inode_size_log2;
+	superblock->number_of_inodes_per_block_log2 = image->inodes_per_block_log2;
+	superblock->allocation_group_size_log2      = image->allocation_group_size_log2;
+	superblock->inodes_percentage               = 25;
+
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->number_of_inodes,
+	 number_of_inodes );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->number_of_free_inodes,
+	 number_of_free_inodes );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->number_of_free_data_blocks,
+	 number_of_free_blocks );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->user_quota_inode_number,
+	 FSXFS_GENERATE_NULL_INODE_NUMBER );
+	byte_stream_copy_from_uint64_big_endian(
+	 superblock->group_quota_inode_number,
+	 FSXFS_GENERATE_NULL_INODE_NUMBER );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->inode_chunk_alignment_size,
+	 image->blocks_per_chunk );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->secondary_feature_flags,
+	 secondary_feature_flags );
+	byte_stream_copy_from_uint32_big_endian(
+	 superblock->secondary_feature_flags_copy,
+	 secondary_feature_flags );
+
+	if( image->format_version >= 5 )
+	{
+		/* Free inode B+ tree read-only compatible feature
+		 */
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ FSXFS_GENERATE_SUPERBLOCK_V5_FEATURE_FLAGS_READ_ONLY ] ),
+		 0x00000001UL );
+
+		/* Directory entry file type incompatible feature
+		 */
+		byte_stream_copy_from_uint32_big_endian(
+		 &( data[ FSXFS_GENERATE_SUPERBLOCK_V5_FEATURE_FLAGS_INCOMPATIBLE ] ),
+		 0x00000001UL );
+
+		byte_stream_copy_from_uint64_big_endian(
+		 &( data[ FSXFS_GENERATE_SUPERBLOCK_V5_PROJECT_QUOTA_INODE_NUMBER ] ),
+		 FSXFS_GENERATE_NULL_INODE_NUMBER );
+
+		fsxfs_generate_set_checksum(
+		 data,
+		 FSXFS_GENERATE_SECTOR_SIZE,
+		 FSXFS_GENERATE_SUPERBLOCK_V5_CHECKSUM );
+	}
+	return( fsxfs_generate_write_at_offset(
+	         image,
+	         data,
+	         FSXFS_GENERATE_SECTOR_SIZE,
+	         fsxfs_generate_get_block_offset(
+	          image,
+	          allocation_group_index,
+	          0 ),
+	         error ) );
+}
+
+/* Writes the image
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_write_image(
+     fsxfs_generate_image_t *image,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_image[ 1 ]       = { 0 };
+	static char *function           = "fsxfs_generate_write_image";
+	uint64_t number_of_free_blocks  = 0;
+	uint64_t number_of_free_inodes  = 0;
+	uint64_t number_of_inodes       = 0;
+	uint64_t random_value           = 0;
+	uint32_t allocation_group_index = 0;
+	uint32_t chunk_index            = 0;
+	uint32_t first_file_index       = 0;
+	uint32_t number_of_chunks       = 0;
+	uint32_t object_index           = 0;
+	uint8_t byte_index              = 0;
+
+	random_value = fsxfs_generate_mix(
+	                image->seed );
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( ( byte_index % 8 ) == 0 )
+		{
+			random_value = fsxfs_generate_mix(
+			                random_value );
+		}
+		image->file_system_identifier[ byte_index ] = (uint8_t) ( random_value >> ( ( byte_index % 8 ) * 8 ) );
+	}
+	/* The image is sized before any data is written so that unwritten blocks read as zero
+	 */
+	if( fsxfs_generate_write_at_offset(
+	     image,
+	     end_of_image,
+	     1,
+	     fsxfs_generate_get_block_offset(
+	      image,
+	      image->number_of_allocation_groups,
+	      0 ) - 1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Reserve the inode chunks, these are distributed round-robin over the allocation groups
+	 */
+	number_of_chunks = ( image->number_of_objects + FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK - 1 ) / FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		image->number_of_chunks[ chunk_index % image->number_of_allocation_groups ] += 1;
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < image->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( (uint64_t) image->number_of_chunks[ allocation_group_index ] * image->blocks_per_chunk > (uint64_t) ( image->allocation_group_size - image->first_chunk_block_number ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: allocation group: %" PRIu32 " too small for inode chunks.",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+		image->next_free_block_number[ allocation_group_index ] = image->first_chunk_block_number
+		                                                        + ( image->number_of_chunks[ allocation_group_index ] * image->blocks_per_chunk );
+	}
+	/* The journal is stored in the first allocation group and left zero
+	 */
+	if( fsxfs_generate_allocate_blocks(
+	     image,
+	     0,
+	     image->journal_size,
+	     &allocation_group_index,
+	     &( image->journal_block_number ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( allocation_group_index != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: allocation group: 0 too small for journal.",
+		 function );
+
+		goto on_error;
+	}
+	first_file_index = fsxfs_generate_get_first_file_index(
+	                    image );
+
+	for( object_index = 0;
+	     object_index < image->number_of_objects;
+	     object_index++ )
+	{
+		if( object_index < first_file_index )
+		{
+			if( fsxfs_generate_write_directory(
+			     image,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write directory: %" PRIu32 ".",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( fsxfs_generate_write_file(
+			     image,
+			     object_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write file: %" PRIu32 ".",
+				 function,
+				 object_index );
+
+				goto on_error;
+			}
+		}
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < image->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( fsxfs_generate_write_allocation_group(
+		     image,
+		     allocation_group_index,
+		     &number_of_inodes,
+		     &number_of_free_inodes,
+		     &number_of_free_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write allocation group: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+	for( allocation_group_index = 0;
+	     allocation_group_index < image->number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		if( fsxfs_generate_write_superblock(
+		     image,
+		     allocation_group_index,
+		     number_of_inodes,
+		     number_of_free_inodes,
+		     number_of_free_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write superblock: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Parses a numeric option
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_generate_get_option_value(
+     const system_character_t *option_value,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_generate_get_option_value";
+
+	if( fsxfs_test_system_string_copy_from_64_bit_in_decimal(
+	     option_value,
+	     system_string_length(
+	      option_value ) + 1,
+	     value,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( ( *value < minimum_value )
+	 || ( *value > maximum_value ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: option value: %" PRIu64 " out of bounds.",
+		 function,
+		 *value );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	char target[ 1024 ];
+
+	fsxfs_generate_image_t image;
+
+	libcerror_error_t *error  = NULL;
+	system_integer_t option   = 0;
+	uint64_t value_64bit      = 0;
+	uint64_t inode_size       = 0;
+	uint64_t number_of_blocks = 0;
+
+	memory_set(
+	 &image,
+	 0,
+	 sizeof( fsxfs_generate_image_t ) );
+
+	image.seed                        = 1;
+	image.format_version              = 5;
+	image.block_size                  = 4096;
+	image.allocation_group_size       = 16384;
+	image.number_of_allocation_groups = 4;
+	image.number_of_files             = 1000;
+	image.entries_per_directory       = 100;
+	image.extents_per_file            = 1;
+	image.blocks_per_extent           = 1;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "a:b:d:e:f:g:hi:l:ms:Sv:x:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				fsxfs_generate_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'a':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     1,
+				     65536,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of allocation groups.\n" );
+
+					goto on_error;
+				}
+				image.number_of_allocation_groups = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'b':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     512,
+				     65536,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported block size.\n" );
+
+					goto on_error;
+				}
+				image.block_size = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'd':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     1,
+				     UINT32_MAX,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of files per directory.\n" );
+
+					goto on_error;
+				}
+				image.entries_per_directory = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'e':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     0,
+				     16777216,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of extents per file.\n" );
+
+					goto on_error;
+				}
+				image.extents_per_file = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'f':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     0,
+				     UINT32_MAX / 2,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of files.\n" );
+
+					goto on_error;
+				}
+				image.number_of_files = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'g':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     64,
+				     0x7fffffffUL,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported allocation group size.\n" );
+
+					goto on_error;
+				}
+				image.allocation_group_size = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'h':
+				fsxfs_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     256,
+				     2048,
+				     &inode_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported inode size.\n" );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'l':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     0,
+				     1024,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported directory depth.\n" );
+
+					goto on_error;
+				}
+				image.directory_depth = (uint32_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'm':
+				image.metadata_only = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     0,
+				     UINT64_MAX,
+				     &( image.seed ),
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported seed.\n" );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'S':
+				image.sparse = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     4,
+				     5,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported format version.\n" );
+
+					goto on_error;
+				}
+				image.format_version = (uint8_t) value_64bit;
+
+				break;
+
+			case (system_integer_t) 'x':
+				if( fsxfs_generate_get_option_value(
+				     optarg,
+				     1,
+				     0x001fffffUL,
+				     &value_64bit,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of blocks per extent.\n" );
+
+					goto on_error;
+				}
+				image.blocks_per_extent = (uint32_t) value_64bit;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		fsxfs_generate_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	if( fsxfs_test_get_narrow_source(
+	     argv[ optind ],
+	     target,
+	     1024,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported target.\n" );
+
+		goto on_error;
+	}
+	if( inode_size == 0 )
+	{
+		inode_size = ( image.format_version < 5 ) ? 256 : 512;
+	}
+	image.inode_size                 = (uint16_t) inode_size;
+	image.inode_size_log2            = fsxfs_generate_get_log2( inode_size );
+	image.block_size_log2            = fsxfs_generate_get_log2( image.block_size );
+	image.allocation_group_size_log2 = fsxfs_generate_get_log2( image.allocation_group_size );
+	image.has_file_type              = (uint8_t) ( image.format_version >= 5 );
+
+	if( image.allocation_group_size_log2 == 0 )
+	{
+		/* The allocation group size log2 is rounded up for sizes that are not a power of 2
+		 */
+		image.allocation_group_size_log2 = 1;
+
+		while( ( (uint64_t) 1 << image.allocation_group_size_log2 ) < image.allocation_group_size )
+		{
+			image.allocation_group_size_log2++;
+		}
+	}
+	if( ( image.block_size_log2 == 0 )
+	 || ( image.inode_size_log2 == 0 )
+	 || ( image.inode_size > image.block_size )
+	 || ( ( (uint32_t) image.inode_size * FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK ) < image.block_size ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported combination of block and inode size.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( image.format_version >= 5 )
+	 && ( image.block_size < 1024 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Format version 5 requires a block size of 1024 or more.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	image.inodes_per_block_log2 = image.block_size_log2 - image.inode_size_log2;
+
+	if( ( image.allocation_group_size_log2 + image.inodes_per_block_log2 ) >= 32 )
+	{
+		fprintf(
+		 stderr,
+		 "Allocation group size too large for block and inode size.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( image.format_version < 5 )
+	{
+		image.inode_core_size = (uint16_t) sizeof( fsxfs_inode_v2_t );
+	}
+	else
+	{
+		image.inode_core_size = (uint16_t) sizeof( fsxfs_inode_v3_t );
+	}
+	image.blocks_per_chunk        = ( (uint32_t) image.inode_size * FSXFS_GENERATE_NUMBER_OF_INODES_PER_CHUNK ) / image.block_size;
+	image.number_of_header_blocks = ( ( 4 * FSXFS_GENERATE_SECTOR_SIZE ) + image.block_size - 1 ) / image.block_size;
+
+	/* The header blocks are followed by the free space B+ tree root blocks
+	 * and the (free) inode B+ tree root blocks
+	 */
+	number_of_blocks = image.number_of_header_blocks + 4;
+
+	image.first_chunk_block_number = (uint32_t) ( ( ( number_of_blocks + image.blocks_per_chunk - 1 ) / image.blocks_per_chunk ) * image.blocks_per_chunk );
+
+	image.journal_size = image.allocation_group_size / 8;
+
+	if( image.journal_size > 2048 )
+	{
+		image.journal_size = 2048;
+	}
+	if( image.number_of_files > 0 )
+	{
+		image.number_of_directories = ( image.number_of_files + image.entries_per_directory - 1 ) / image.entries_per_directory;
+	}
+	image.number_of_objects = 1 + image.number_of_directories + image.directory_depth + image.number_of_files;
+
+	image.next_free_block_number = (uint32_t *) memory_allocate(
+	                                             sizeof( uint32_t ) * image.number_of_allocation_groups );
+
+	image.number_of_chunks = (uint32_t *) memory_allocate(
+	                                       sizeof( uint32_t ) * image.number_of_allocation_groups );
+
+	image.block_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * image.block_size );
+
+	image.inode_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * image.inode_size );
+
+	if( ( image.next_free_block_number == NULL )
+	 || ( image.number_of_chunks == NULL )
+	 || ( image.block_data == NULL )
+	 || ( image.inode_data == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	memory_set(
+	 image.number_of_chunks,
+	 0,
+	 sizeof( uint32_t ) * image.number_of_allocation_groups );
+
+	fsxfs_generate_crc32c_initialize();
+
+	image.stream = file_stream_open(
+	                target,
+	                "wb+" );
+
+	if( image.stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target: %s.\n",
+		 target );
+
+		goto on_error;
+	}
+	if( fsxfs_generate_write_image(
+	     &image,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write image.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     image.stream ) != 0 )
+	{
+		image.stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target.\n" );
+
+		goto on_error;
+	}
+	image.stream = NULL;
+
+	fprintf(
+	 stdout,
+	 "Wrote format version %" PRIu8 " image with %" PRIu32 " inodes, %" PRIu32 " allocation groups of %" PRIu32 " blocks of %" PRIu32 " bytes.\n",
+	 image.format_version,
+	 image.number_of_objects,
+	 image.number_of_allocation_groups,
+	 image.allocation_group_size,
+	 image.block_size );
+
+	memory_free(
+	 image.inode_data );
+	memory_free(
+	 image.block_data );
+	memory_free(
+	 image.number_of_chunks );
+	memory_free(
+	 image.next_free_block_number );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( image.stream != NULL )
+	{
+		file_stream_close(
+		 image.stream );
+	}
+	if( image.inode_data != NULL )
+	{
+		memory_free(
+		 image.inode_data );
+	}
+	if( image.block_data != NULL )
+	{
+		memory_free(
+		 image.block_data );
+	}
+	if( image.number_of_chunks != NULL )
+	{
+		memory_free(
+		 image.number_of_chunks );
+	}
+	if( image.next_free_block_number != NULL )
+	{
+		memory_free(
+		 image.next_free_block_number );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1168 @@
+/*
+ * Library block_data_handle type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_block_data_handle.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_block_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_data_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsxfs_io_handle_t *io_handle                 = NULL;
+	libfsxfs_block_data_handle_t *data_handle = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->read_ahead_data_size",
+	 data_handle->read_ahead_data_size,
+	 (size_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the read-ahead data size is derived from the stripe geometry
+	 */
+	io_handle->stripe_unit_size = 65536;
+	io_handle->stripe_width     = 262144;
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->read_ahead_data_size",
+	 data_handle->read_ahead_data_size,
+	 (size_t) 262144 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->stripe_width = 65536;
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->read_ahead_data_size",
+	 data_handle->read_ahead_data_size,
+	 (size_t) 131072 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->stripe_unit_size = 0;
+	io_handle->stripe_width     = 0;
+
+	result = libfsxfs_block_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_block_data_handle_initialize(
+	          NULL,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_handle = (libfsxfs_block_data_handle_t *) 0x12345678UL;
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	data_handle = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          NULL,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_block_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_block_data_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_data_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_block_data_handle_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_block_data_handle_read_segment_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_data_handle_read_segment_data(
+     void )
+{
+	uint8_t data[ 4096 ];
+	uint8_t segment_data[ 2048 ];
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_block_data_handle_t *data_handle = NULL;
+	libfsxfs_io_handle_t *io_handle           = NULL;
+	ssize_t read_count                        = 0;
+	off64_t offset                            = 0;
+	size_t data_index                         = 0;
+	int result                                = 0;
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size       = 512;
+	io_handle->stripe_unit_size = 512;
+	io_handle->stripe_width     = 1024;
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a small read that is served from the stripe aligned read-ahead data
+	 */
+	offset = libfsxfs_block_data_handle_seek_segment_offset(
+	          data_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          700,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 700 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              100,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 700 ] ),
+	          100 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->read_ahead_data_offset",
+	 (int64_t) data_handle->read_ahead_data_offset,
+	 (int64_t) 512 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->read_ahead_data_count",
+	 data_handle->read_ahead_data_count,
+	 (size_t) 1024 );
+
+	/* Test a subsequent small read that is served from the read-ahead data
+	 */
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              200,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 800 ] ),
+	          200 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->read_ahead_data_offset",
+	 (int64_t) data_handle->read_ahead_data_offset,
+	 (int64_t) 512 );
+
+	/* Test a large read that bypasses the read-ahead data
+	 */
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              2048,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 1000 ] ),
+	          2048 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_handle->read_ahead_data_offset",
+	 (int64_t) data_handle->read_ahead_data_offset,
+	 (int64_t) 512 );
+
+	/* Test a small read at the end of the data
+	 */
+	offset = libfsxfs_block_data_handle_seek_segment_offset(
+	          data_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          4000,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4000 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              96,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 96 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data[ 4000 ] ),
+	          96 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_handle->read_ahead_data_count",
+	 data_handle->read_ahead_data_count,
+	 (size_t) 512 );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              100,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_block_data_handle_read_segment_data(
+	              data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              NULL,
+	              100,
+	              0,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_block_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_block_data_handle_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_block_data_handle_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 2048 ];
+	uint8_t data[ 4096 ];
+	uint8_t zero_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_block_data_handle_t *data_handle = NULL;
+	libfsxfs_io_handle_t *io_handle           = NULL;
+	void *memset_result                       = NULL;
+	ssize_t read_count                        = 0;
+	size_t data_index                         = 0;
+	int result                                = 0;
+
+	memset_result = memory_set(
+	                 zero_data,
+	                 0,
+	                 sizeof( uint8_t ) * 512 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	for( data_index = 0;
+	     data_index < 4096;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 512;
+
+	result = libfsxfs_block_data_handle_initialize(
+	          &data_handle,
+	          io_handle,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The segments are not stored in logical order and contain a sparse segment
+	 */
+	result = libfsxfs_block_data_handle_append_segment(
+	          data_handle,
+	          2048,
+	          1024,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_append_segment(
+	          data_handle,
+	          0,
+	          512,
+	          LIBFDATA_RANGE_FLAG_IS_SPARSE,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_append_segment(
+	          data_handle,
+	          0,
+	          1024,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that spans multiple segments
+	 */
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              data_handle,
+	              file_io_handle,
+	              buffer,
+	              1200,
+	              1000,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1200 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 3048 ] ),
+	          24 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 24 ] ),
+	          zero_data,
+	          512 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 536 ] ),
+	          data,
+	          664 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that is truncated at the end of the segments
+	 */
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              data_handle,
+	              file_io_handle,
+	              buffer,
+	              100,
+	              2500,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 60 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 964 ] ),
+	          60 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              data_handle,
+	              file_io_handle,
+	              buffer,
+	              100,
+	              2560,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              100,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              data_handle,
+	              file_io_handle,
+	              NULL,
+	              100,
+	              0,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_block_data_handle_read_buffer_at_offset(
+	              data_handle,
+	              file_io_handle,
+	              buffer,
+	              100,
+	              -1,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_block_data_handle_free(
+	          &data_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "data_handle",
+	 data_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_handle != NULL )
+	{
+		libfsxfs_block_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_data_handle_initialize",
+	 fsxfs_test_block_data_handle_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_data_handle_free",
+	 fsxfs_test_block_data_handle_free );
+
+	/* TODO: add tests for libfsxfs_block_data_handle_read_at_offset */
+
+	/* TODO: add tests for libfsxfs_block_data_handle_append_segment */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_data_handle_read_buffer_at_offset",
+	 fsxfs_test_block_data_handle_read_buffer_at_offset );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_block_data_handle_read_segment_data",
+	 fsxfs_test_block_data_handle_read_segment_data );
+
+	/* TODO: add tests for libfsxfs_block_data_handle_seek_segment_offset */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -37,6 +37,7 @@
 
 #include "../libfsxfs/libfsxfs_btree_block.h"
 #include "../libfsxfs/libfsxfs_io_handle.h"
+#include "../libfsxfs/libfsxfs_statistics.h"
 
 uint8_t fsxfs_test_btree_block_data1[ 512 ] = {
 	0x49, 0x41, 0x42, 0x33, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
@@ -575,9 +576,10 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	 "error",
 	 error );
 
-	io_handle->format_version = 5;
-	io_handle->block_size     = 1024;
-	io_handle->inode_size     = 128;
+	io_handle->format_version     = 5;
+	io_handle->block_size         = 1024;
+	io_handle->inode_size         = 128;
+	io_handle->collect_statistics = 1;
 
 	result = libfsxfs_btree_block_initialize(
 	          &btree_block,
@@ -626,6 +628,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          io_handle,
 	          file_io_handle,
 	          0,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -637,6 +641,18 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	 "error",
 	 error );
 
+	/* The read is accounted to the read category of the caller
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE_BTREE ]",
+	 io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE_BTREE ],
+	 (uint64_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_FREE_SPACE_BTREE ]",
+	 io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_FREE_SPACE_BTREE ],
+	 (uint64_t) 0 );
+
 	/* Test error cases
 	 */
 	result = libfsxfs_btree_block_read_file_io_handle(
@@ -644,6 +660,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          io_handle,
 	          file_io_handle,
 	          0,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -663,6 +681,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          NULL,
 	          file_io_handle,
 	          0,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -682,6 +702,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          io_handle,
 	          NULL,
 	          0,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -701,6 +723,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          io_handle,
 	          file_io_handle,
 	          -1,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -756,6 +780,8 @@ int fsxfs_test_btree_block_read_file_io_handle(
 	          io_handle,
 	          file_io_handle,
 	          0,
+	          LIBFSXFS_READ_CATEGORY_INODE_BTREE,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -270,6 +270,194 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_directory_entry_get_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_directory_entry_get_file_type(
+     void )
+{
+	uint16_t expected_file_types[ 8 ] = {
+		0,
+		LIBFSXFS_FILE_TYPE_REGULAR_FILE,
+		LIBFSXFS_FILE_TYPE_DIRECTORY,
+		LIBFSXFS_FILE_TYPE_CHARACTER_DEVICE,
+		LIBFSXFS_FILE_TYPE_BLOCK_DEVICE,
+		LIBFSXFS_FILE_TYPE_FIFO,
+		LIBFSXFS_FILE_TYPE_SOCKET,
+		LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK };
+
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	uint16_t file_type                          = 0;
+	uint8_t directory_entry_file_type           = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( directory_entry_file_type = 1;
+	     directory_entry_file_type < 8;
+	     directory_entry_file_type++ )
+	{
+		directory_entry->file_type = directory_entry_file_type;
+
+		file_type = 0;
+
+		result = libfsxfs_directory_entry_get_file_type(
+		          directory_entry,
+		          &file_type,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT16(
+		 "file_type",
+		 file_type,
+		 expected_file_types[ directory_entry_file_type ] );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test unsupported file types
+	 */
+	directory_entry->file_type = 0;
+
+	file_type = 0;
+
+	result = libfsxfs_directory_entry_get_file_type(
+	          directory_entry,
+	          &file_type,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "file_type",
+	 file_type,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry->file_type = 8;
+
+	result = libfsxfs_directory_entry_get_file_type(
+	          directory_entry,
+	          &file_type,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "file_type",
+	 file_type,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_directory_entry_get_file_type(
+	          NULL,
+	          &file_type,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_directory_entry_get_file_type(
+	          directory_entry,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +485,10 @@ int main(
 	 "libfsxfs_directory_entry_free",
 	 fsxfs_test_directory_entry_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_directory_entry_get_file_type",
+	 fsxfs_test_directory_entry_get_file_type );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,45 +34,20 @@
 #include "fsxfs_test_memory.h"
 #include "fsxfs_test_unused.h"
 
-#include "../libfsxfs/libfsxfs_extent.h"
 #include "../libfsxfs/libfsxfs_inode.h"
 #include "../libfsxfs/libfsxfs_io_handle.h"
 
-/* ext3 inode */
-uint8_t fsxfs_test_inode_data1[ 128 ] = {
-	0x00, 0x04, 0x00, 0x00, 0x3d, 0x13, 0xc1, 0x3f, 0x44, 0x13, 0xc1, 0x3f, 0x44, 0x13, 0xc1, 0x3f,
-	0x00, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-
-/* ext4 inode without EXT4_EXTENTS_FL */
-uint8_t fsxfs_test_inode_data2[ 128 ] = {
-	0xed, 0x41, 0xe8, 0x03, 0x00, 0x04, 0x00, 0x00, 0xdf, 0xc3, 0xd7, 0x49, 0xdf, 0xc3, 0xd7, 0x49,
-	0xdf, 0xc3, 0xd7, 0x49, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-
-/* ext4 inode with EXT4_EXTENTS_FL */
-uint8_t fsxfs_test_inode_data3[ 128 ] = {
-	0xed, 0x41, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb4, 0x69, 0x47, 0x55, 0xb4, 0x69, 0x47, 0x55,
-	0xb4, 0x69, 0x47, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+/* Format version 2 directory inode with inline data
+ */
+uint8_t fsxfs_test_inode_data1[ 256 ] = {
+	0x49, 0x4e, 0x41, 0xed, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe9, 0x00, 0x00, 0x03, 0xea,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x5b, 0x91, 0xf1, 0x17, 0x02, 0x29, 0xc2, 0x15, 0x5b, 0x91, 0xf1, 0x16, 0x00, 0x00, 0x00, 0x00,
+	0x5b, 0x91, 0xf1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-
-/* empty inode */
-uint8_t fsxfs_test_inode_data4[ 128 ] = {
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x91, 0x8b, 0xdb,
+	0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x09, 0x00, 0x30, 0x64, 0x69, 0x72,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -94,7 +70,7 @@ int fsxfs_test_inode_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_FSXFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 2;
+	int number_of_malloc_fail_tests = 1;
 	int number_of_memset_fail_tests = 1;
 	int test_number                 = 0;
 #endif
@@ -103,6 +79,7 @@ int fsxfs_test_inode_initialize(
 	 */
 	result = libfsxfs_inode_initialize(
 	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -139,6 +116,7 @@ int fsxfs_test_inode_initialize(
 	 */
 	result = libfsxfs_inode_initialize(
 	          NULL,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -157,6 +135,7 @@ int fsxfs_test_inode_initialize(
 
 	result = libfsxfs_inode_initialize(
 	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -173,6 +152,23 @@ int fsxfs_test_inode_initialize(
 
 	inode = NULL;
 
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          100,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_FSXFS_TEST_MEMORY )
 
 	for( test_number = 0;
@@ -185,6 +181,7 @@ int fsxfs_test_inode_initialize(
 
 		result = libfsxfs_inode_initialize(
 		          &inode,
+		          256,
 		          &error );
 
 		if( fsxfs_test_malloc_attempts_before_fail != -1 )
@@ -227,6 +224,7 @@ int fsxfs_test_inode_initialize(
 
 		result = libfsxfs_inode_initialize(
 		          &inode,
+		          256,
 		          &error );
 
 		if( fsxfs_test_memset_attempts_before_fail != -1 )
@@ -316,30 +314,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_clone function
+/* Tests the libfsxfs_inode_read_data function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_clone(
+int fsxfs_test_inode_read_data(
      void )
 {
-	libcerror_error_t *error            = NULL;
-	libfsxfs_inode_t *destination_inode = NULL;
-	libfsxfs_inode_t *source_inode      = NULL;
-	int result                          = 0;
-
-#if defined( HAVE_FSXFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 2;
-	int test_number                 = 0;
+	uint8_t inode_data[ 256 ];
 
-#if defined( OPTIMIZATION_DISABLED )
-	int number_of_memcpy_fail_tests = 1;
-#endif
-#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+	libcerror_error_t *error = NULL;
+	libfsxfs_inode_t *inode  = NULL;
+	void *memcpy_result      = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
 	result = libfsxfs_inode_initialize(
-	          &source_inode,
+	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -348,8 +340,8 @@ int fsxfs_test_inode_clone(
 	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "source_inode",
-	 source_inode );
+	 "inode",
+	 inode );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -357,9 +349,10 @@ int fsxfs_test_inode_clone(
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_clone(
-	          &destination_inode,
-	          source_inode,
+	result = libfsxfs_inode_read_data(
+	          inode,
+	          fsxfs_test_inode_data1,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -367,54 +360,54 @@ int fsxfs_test_inode_clone(
 	 result,
 	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "destination_inode",
-	 destination_inode );
-
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfsxfs_inode_free(
-	          &destination_inode,
-	          &error );
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "inode->format_version",
+	 inode->format_version,
+	 2 );
 
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "inode->fork_type",
+	 inode->fork_type,
+	 LIBFSXFS_FORK_TYPE_INLINE_DATA );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "destination_inode",
-	 destination_inode );
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "inode->data_fork_offset",
+	 inode->data_fork_offset,
+	 100 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "inode->data_fork_size",
+	 inode->data_fork_size,
+	 156 );
 
-	result = libfsxfs_inode_clone(
-	          &destination_inode,
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_read_data(
 	          NULL,
+	          fsxfs_test_inode_data1,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "destination_inode",
-	 destination_inode );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsxfs_inode_clone(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_read_data(
+	          inode,
 	          NULL,
-	          source_inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -429,11 +422,10 @@ int fsxfs_test_inode_clone(
 	libcerror_error_free(
 	 &error );
 
-	destination_inode = (libfsxfs_inode_t *) 0x12345678UL;
-
-	result = libfsxfs_inode_clone(
-	          &destination_inode,
-	          source_inode,
+	result = libfsxfs_inode_read_data(
+	          inode,
+	          fsxfs_test_inode_data1,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -448,105 +440,59 @@ int fsxfs_test_inode_clone(
 	libcerror_error_free(
 	 &error );
 
-	destination_inode = NULL;
-
-#if defined( HAVE_FSXFS_TEST_MEMORY )
-
-	for( test_number = 0;
-	     test_number < number_of_malloc_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsxfs_inode_clone with malloc failing
-		 */
-		fsxfs_test_malloc_attempts_before_fail = test_number;
-
-		result = libfsxfs_inode_clone(
-		          &destination_inode,
-		          source_inode,
-		          &error );
-
-		if( fsxfs_test_malloc_attempts_before_fail != -1 )
-		{
-			fsxfs_test_malloc_attempts_before_fail = -1;
-
-			if( destination_inode != NULL )
-			{
-				libfsxfs_inode_free(
-				 &destination_inode,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSXFS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+	result = libfsxfs_inode_read_data(
+	          inode,
+	          fsxfs_test_inode_data1,
+	          0,
+	          &error );
 
-			FSXFS_TEST_ASSERT_IS_NULL(
-			 "destination_inode",
-			 destination_inode );
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-			FSXFS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#if defined( OPTIMIZATION_DISABLED )
+	libcerror_error_free(
+	 &error );
 
-	for( test_number = 0;
-	     test_number < number_of_memcpy_fail_tests;
-	     test_number++ )
-	{
-		/* Test libfsxfs_inode_clone with memcpy failing
-		 */
-		fsxfs_test_memcpy_attempts_before_fail = 0;
+	/* Test error case where signature is invalid
+	 */
+	memcpy_result = memory_copy(
+	                 inode_data,
+	                 fsxfs_test_inode_data1,
+	                 256 );
 
-		result = libfsxfs_inode_clone(
-		          &destination_inode,
-		          source_inode,
-		          &error );
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
 
-		if( fsxfs_test_memcpy_attempts_before_fail != -1 )
-		{
-			fsxfs_test_memcpy_attempts_before_fail = -1;
+	inode_data[ 0 ] = 0xff;
 
-			if( destination_inode != NULL )
-			{
-				libfsxfs_inode_free(
-				 &destination_inode,
-				 NULL );
-			}
-		}
-		else
-		{
-			FSXFS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+	result = libfsxfs_inode_read_data(
+	          inode,
+	          inode_data,
+	          256,
+	          &error );
 
-			FSXFS_TEST_ASSERT_IS_NULL(
-			 "destination_inode",
-			 destination_inode );
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-			FSXFS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#endif /* defined( OPTIMIZATION_DISABLED ) */
-#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
 	result = libfsxfs_inode_free(
-	          &source_inode,
+	          &inode,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -555,8 +501,8 @@ int fsxfs_test_inode_clone(
 	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
-	 "source_inode",
-	 source_inode );
+	 "inode",
+	 inode );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -570,30 +516,27 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( destination_inode != NULL )
-	{
-		libfsxfs_inode_free(
-		 &destination_inode,
-		 NULL );
-	}
-	if( source_inode != NULL )
+	if( inode != NULL )
 	{
 		libfsxfs_inode_free(
-		 &source_inode,
+		 &inode,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_read_data function
+/* Tests the libfsxfs_inode_read_buffer function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_read_data(
+int fsxfs_test_inode_read_buffer(
      void )
 {
 	libcerror_error_t *error        = NULL;
 	libfsxfs_inode_t *inode         = NULL;
 	libfsxfs_io_handle_t *io_handle = NULL;
+	uint8_t *inode_data             = NULL;
+	void *memcpy_result             = NULL;
+	void *memset_result             = NULL;
 	int result                      = 0;
 
 	/* Initialize test
@@ -615,12 +558,11 @@ int fsxfs_test_inode_read_data(
 	 "error",
 	 error );
 
-	io_handle->format_version = 4;
-	io_handle->block_size     = 1024;
-	io_handle->inode_size     = 128;
+	io_handle->block_size = 4096;
 
 	result = libfsxfs_inode_initialize(
 	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -636,16 +578,33 @@ int fsxfs_test_inode_read_data(
 	 "error",
 	 error );
 
+	inode_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 256 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_data",
+	 inode_data );
+
+	memcpy_result = memory_copy(
+	                 inode_data,
+	                 fsxfs_test_inode_data1,
+	                 256 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
 	/* Test regular cases
 	 */
-	io_handle->format_version = 3;
-	io_handle->inode_size     = 0;
-
-	result = libfsxfs_inode_read_data(
+	result = libfsxfs_inode_read_buffer(
 	          inode,
 	          io_handle,
-	          fsxfs_test_inode_data1,
+	          NULL,
+	          inode_data,
+	          256,
+	          32768,
 	          128,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -657,57 +616,104 @@ int fsxfs_test_inode_read_data(
 	 "error",
 	 error );
 
-	io_handle->format_version = 4;
-	io_handle->inode_size     = 128;
+	/* The inline data must remain valid after the inode data has been freed
+	 */
+	memset_result = memory_set(
+	                 inode_data,
+	                 0,
+	                 256 );
 
-	result = libfsxfs_inode_read_data(
-	          inode,
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memory_free(
+	 inode_data );
+
+	inode_data = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode->inode_number",
+	 inode->inode_number,
+	 (uint64_t) 128 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode->size",
+	 inode->size,
+	 (uint64_t) 22 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode->inline_data",
+	 inode->inline_data );
+
+	result = memory_compare(
+	          inode->inline_data,
+	          &( fsxfs_test_inode_data1[ 100 ] ),
+	          22 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode->data_extents_array",
+	 inode->data_extents_array );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_read_buffer(
+	          NULL,
 	          io_handle,
-	          fsxfs_test_inode_data2,
+	          NULL,
+	          fsxfs_test_inode_data1,
+	          256,
+	          32768,
 	          128,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	io_handle->format_version = 4;
-	io_handle->inode_size     = 128;
+	libcerror_error_free(
+	 &error );
 
-	result = libfsxfs_inode_read_data(
+	/* Test error case where inline data is already set
+	 */
+	result = libfsxfs_inode_read_buffer(
 	          inode,
 	          io_handle,
-	          fsxfs_test_inode_data3,
+	          NULL,
+	          fsxfs_test_inode_data1,
+	          256,
+	          32768,
 	          128,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "inode->is_empty",
-	 inode->is_empty,
-	 0 );
-
-	io_handle->format_version = 2;
-	io_handle->inode_size     = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libfsxfs_inode_read_data(
-	          inode,
-	          io_handle,
-	          fsxfs_test_inode_data4,
-	          128,
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -715,100 +721,153 @@ int fsxfs_test_inode_read_data(
 	 result,
 	 1 );
 
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "inode->is_empty",
-	 inode->is_empty,
-	 1 );
-
-	/* Test error cases
+	/* Test regular cases with empty inline data
 	 */
-	io_handle->format_version = 3;
-	io_handle->inode_size     = 0;
-
-	result = libfsxfs_inode_read_data(
-	          NULL,
-	          io_handle,
-	          fsxfs_test_inode_data1,
-	          128,
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	inode_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 256 );
 
-	result = libfsxfs_inode_read_data(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_data",
+	 inode_data );
+
+	memcpy_result = memory_copy(
+	                 inode_data,
+	                 fsxfs_test_inode_data1,
+	                 256 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Set the data size to 0
+	 */
+	inode_data[ 63 ] = 0;
+
+	result = libfsxfs_inode_read_buffer(
 	          inode,
+	          io_handle,
 	          NULL,
-	          fsxfs_test_inode_data1,
+	          inode_data,
+	          256,
+	          32768,
 	          128,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_free(
+	 inode_data );
 
-	result = libfsxfs_inode_read_data(
-	          inode,
-	          io_handle,
-	          NULL,
-	          128,
+	inode_data = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode->size",
+	 inode->size,
+	 (uint64_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode->inline_data",
+	 inode->inline_data );
+
+	result = libfsxfs_inode_free(
+	          &inode,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_inode_read_data(
-	          inode,
-	          io_handle,
-	          fsxfs_test_inode_data1,
-	          (size_t) SSIZE_MAX + 1,
+	/* Test error case where inline data size exceeds the data fork size
+	 */
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 256 );
 
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 "inode_data",
+	 inode_data );
 
-	libcerror_error_free(
-	 &error );
+	memcpy_result = memory_copy(
+	                 inode_data,
+	                 fsxfs_test_inode_data1,
+	                 256 );
 
-	result = libfsxfs_inode_read_data(
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Set the data size to 157
+	 */
+	inode_data[ 63 ] = 157;
+
+	result = libfsxfs_inode_read_buffer(
 	          inode,
 	          io_handle,
-	          fsxfs_test_inode_data1,
+	          NULL,
+	          inode_data,
+	          256,
+	          32768,
+	          128,
 	          0,
 	          &error );
 
@@ -824,6 +883,15 @@ int fsxfs_test_inode_read_data(
 	libcerror_error_free(
 	 &error );
 
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode->inline_data",
+	 inode->inline_data );
+
+	memory_free(
+	 inode_data );
+
+	inode_data = NULL;
+
 	/* Clean up
 	 */
 	result = libfsxfs_inode_free(
@@ -868,6 +936,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( inode_data != NULL )
+	{
+		memory_free(
+		 inode_data );
+	}
 	if( inode != NULL )
 	{
 		libfsxfs_inode_free(
@@ -883,27 +956,28 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_number_of_extents function
+/* Tests the libfsxfs_inode_get_creation_time function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_number_of_extents(
+int fsxfs_test_inode_get_creation_time(
      libfsxfs_inode_t *inode )
 {
 	libcerror_error_t *error = NULL;
-	int number_of_extents    = 0;
+	int64_t posix_time       = 0;
 	int result               = 0;
 
 	/* Test regular cases
+	 * The creation time is only stored in format version 3 inodes
 	 */
-	result = libfsxfs_inode_get_number_of_extents(
+	result = libfsxfs_inode_get_creation_time(
 	          inode,
-	          &number_of_extents,
+	          &posix_time,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -911,9 +985,9 @@ int fsxfs_test_inode_get_number_of_extents(
 
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_number_of_extents(
+	result = libfsxfs_inode_get_creation_time(
 	          NULL,
-	          &number_of_extents,
+	          &posix_time,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -928,7 +1002,7 @@ int fsxfs_test_inode_get_number_of_extents(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_inode_get_number_of_extents(
+	result = libfsxfs_inode_get_creation_time(
 	          inode,
 	          NULL,
 	          &error );
@@ -956,22 +1030,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_extent_by_index function
+/* Tests the libfsxfs_inode_get_modification_time function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_extent_by_index(
+int fsxfs_test_inode_get_modification_time(
      libfsxfs_inode_t *inode )
 {
-	libcerror_error_t *error  = NULL;
-	libfsxfs_extent_t *extent = NULL;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_get_extent_by_index(
+	result = libfsxfs_inode_get_modification_time(
 	          inode,
-	          0,
-	          &extent,
+	          &posix_time,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -983,12 +1056,16 @@ int fsxfs_test_inode_get_extent_by_index(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1536291094000000000LL );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_extent_by_index(
+	result = libfsxfs_inode_get_modification_time(
 	          NULL,
-	          0,
-	          &extent,
+	          &posix_time,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1003,9 +1080,8 @@ int fsxfs_test_inode_get_extent_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_inode_get_extent_by_index(
+	result = libfsxfs_inode_get_modification_time(
 	          inode,
-	          0,
 	          NULL,
 	          &error );
 
@@ -1058,6 +1134,11 @@ int fsxfs_test_inode_get_access_time(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1536291095036291093LL );
+
 	/* Test error cases
 	 */
 	result = libfsxfs_inode_get_access_time(
@@ -1105,38 +1186,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_creation_time function
+/* Tests the libfsxfs_inode_get_inode_change_time function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_creation_time(
+int fsxfs_test_inode_get_inode_change_time(
      libfsxfs_inode_t *inode )
 {
 	libcerror_error_t *error = NULL;
 	int64_t posix_time       = 0;
-	int creation_time_is_set = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_get_creation_time(
+	result = libfsxfs_inode_get_inode_change_time(
 	          inode,
 	          &posix_time,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	creation_time_is_set = result;
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 1536291094000000000LL );
 
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_creation_time(
+	result = libfsxfs_inode_get_inode_change_time(
 	          NULL,
 	          &posix_time,
 	          &error );
@@ -1153,25 +1236,179 @@ int fsxfs_test_inode_get_creation_time(
 	libcerror_error_free(
 	 &error );
 
-	if( creation_time_is_set != 0 )
+	result = libfsxfs_inode_get_inode_change_time(
+	          inode,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		result = libfsxfs_inode_get_creation_time(
-		          inode,
-		          NULL,
-		          &error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_get_owner_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_get_owner_identifier(
+     libfsxfs_inode_t *inode )
+{
+	libcerror_error_t *error  = NULL;
+	uint32_t owner_identifier = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_get_owner_identifier(
+	          inode,
+	          &owner_identifier,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "owner_identifier",
+	 owner_identifier,
+	 1001 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_get_owner_identifier(
+	          NULL,
+	          &owner_identifier,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_get_owner_identifier(
+	          inode,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		FSXFS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	libcerror_error_free(
+	 &error );
 
-		FSXFS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_get_group_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_get_group_identifier(
+     libfsxfs_inode_t *inode )
+{
+	libcerror_error_t *error  = NULL;
+	uint32_t group_identifier = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_get_group_identifier(
+	          inode,
+	          &group_identifier,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "group_identifier",
+	 group_identifier,
+	 1002 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_get_group_identifier(
+	          NULL,
+	          &group_identifier,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_get_group_identifier(
+	          inode,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1183,21 +1420,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_inode_change_time function
+/* Tests the libfsxfs_inode_get_number_of_links function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_inode_change_time(
+int fsxfs_test_inode_get_number_of_links(
      libfsxfs_inode_t *inode )
 {
 	libcerror_error_t *error = NULL;
-	int64_t posix_time       = 0;
+	uint32_t number_of_links = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_get_inode_change_time(
+	result = libfsxfs_inode_get_number_of_links(
 	          inode,
-	          &posix_time,
+	          &number_of_links,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1211,9 +1448,9 @@ int fsxfs_test_inode_get_inode_change_time(
 
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_inode_change_time(
+	result = libfsxfs_inode_get_number_of_links(
 	          NULL,
-	          &posix_time,
+	          &number_of_links,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1228,7 +1465,7 @@ int fsxfs_test_inode_get_inode_change_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_inode_get_inode_change_time(
+	result = libfsxfs_inode_get_number_of_links(
 	          inode,
 	          NULL,
 	          &error );
@@ -1256,21 +1493,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_modification_time function
+/* Tests the libfsxfs_inode_get_file_mode function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_modification_time(
+int fsxfs_test_inode_get_file_mode(
      libfsxfs_inode_t *inode )
 {
 	libcerror_error_t *error = NULL;
-	int64_t posix_time       = 0;
+	uint16_t file_mode       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_get_modification_time(
+	result = libfsxfs_inode_get_file_mode(
 	          inode,
-	          &posix_time,
+	          &file_mode,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1282,11 +1519,16 @@ int fsxfs_test_inode_get_modification_time(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "file_mode",
+	 file_mode,
+	 0x41ed );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_modification_time(
+	result = libfsxfs_inode_get_file_mode(
 	          NULL,
-	          &posix_time,
+	          &file_mode,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1301,7 +1543,7 @@ int fsxfs_test_inode_get_modification_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_inode_get_modification_time(
+	result = libfsxfs_inode_get_file_mode(
 	          inode,
 	          NULL,
 	          &error );
@@ -1329,21 +1571,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_inode_get_deletion_time function
+/* Tests the libfsxfs_inode_get_data_size function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_inode_get_deletion_time(
+int fsxfs_test_inode_get_data_size(
      libfsxfs_inode_t *inode )
 {
 	libcerror_error_t *error = NULL;
-	int32_t posix_time       = 0;
+	uint64_t data_size       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_inode_get_deletion_time(
+	result = libfsxfs_inode_get_data_size(
 	          inode,
-	          &posix_time,
+	          &data_size,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1355,11 +1597,16 @@ int fsxfs_test_inode_get_deletion_time(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 22 );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_inode_get_deletion_time(
+	result = libfsxfs_inode_get_data_size(
 	          NULL,
-	          &posix_time,
+	          &data_size,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1374,7 +1621,7 @@ int fsxfs_test_inode_get_deletion_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_inode_get_deletion_time(
+	result = libfsxfs_inode_get_data_size(
 	          inode,
 	          NULL,
 	          &error );
@@ -1436,15 +1683,15 @@ int main(
 	 "libfsxfs_inode_free",
 	 fsxfs_test_inode_free );
 
-	FSXFS_TEST_RUN(
-	 "libfsxfs_inode_clone",
-	 fsxfs_test_inode_clone );
-
 	FSXFS_TEST_RUN(
 	 "libfsxfs_inode_read_data",
 	 fsxfs_test_inode_read_data );
 
-	/* TODO: add tests for libfsxfs_inode_read_element_data */
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_read_buffer",
+	 fsxfs_test_inode_read_buffer );
+
+	/* TODO: add tests for libfsxfs_inode_read_file_io_handle */
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
@@ -1467,12 +1714,11 @@ int main(
 	 "error",
 	 error );
 
-	io_handle->format_version = 4;
-	io_handle->block_size     = 1024;
-	io_handle->inode_size     = 128;
+	io_handle->block_size = 4096;
 
 	result = libfsxfs_inode_initialize(
 	          &inode,
+	          256,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1488,26 +1734,15 @@ int main(
 	 "error",
 	 error );
 
-	result = libfsxfs_inode_read_data(
-	          inode,
-	          io_handle,
-	          fsxfs_test_inode_data3,
-	          128,
-	          &error );
-
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libfsxfs_inode_read_data_reference(
+	result = libfsxfs_inode_read_buffer(
 	          inode,
 	          io_handle,
 	          NULL,
+	          fsxfs_test_inode_data1,
+	          256,
+	          32768,
+	          128,
+	          0,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1520,13 +1755,13 @@ int main(
 	 error );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_number_of_extents",
-	 fsxfs_test_inode_get_number_of_extents,
+	 "libfsxfs_inode_get_creation_time",
+	 fsxfs_test_inode_get_creation_time,
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_extent_by_index",
-	 fsxfs_test_inode_get_extent_by_index,
+	 "libfsxfs_inode_get_modification_time",
+	 fsxfs_test_inode_get_modification_time,
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
@@ -1535,32 +1770,38 @@ int main(
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_access_time",
-	 fsxfs_test_inode_get_access_time,
+	 "libfsxfs_inode_get_inode_change_time",
+	 fsxfs_test_inode_get_inode_change_time,
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_creation_time",
-	 fsxfs_test_inode_get_creation_time,
+	 "libfsxfs_inode_get_owner_identifier",
+	 fsxfs_test_inode_get_owner_identifier,
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_modification_time",
-	 fsxfs_test_inode_get_modification_time,
+	 "libfsxfs_inode_get_group_identifier",
+	 fsxfs_test_inode_get_group_identifier,
 	 inode );
 
 	FSXFS_TEST_RUN_WITH_ARGS(
-	 "libfsxfs_inode_get_deletion_time",
-	 fsxfs_test_inode_get_deletion_time,
+	 "libfsxfs_inode_get_number_of_links",
+	 fsxfs_test_inode_get_number_of_links,
 	 inode );
 
-/* TODO add test for libfsxfs_inode_get_file_mode */
+	FSXFS_TEST_RUN_WITH_ARGS(
+	 "libfsxfs_inode_get_file_mode",
+	 fsxfs_test_inode_get_file_mode,
+	 inode );
 
-/* TODO add test for libfsxfs_inode_get_user_identifier */
+	FSXFS_TEST_RUN_WITH_ARGS(
+	 "libfsxfs_inode_get_data_size",
+	 fsxfs_test_inode_get_data_size,
+	 inode );
 
-/* TODO add test for libfsxfs_inode_get_group_identifier */
+	/* TODO: add tests for libfsxfs_inode_get_number_of_extents */
 
-/* TODO add test for libfsxfs_inode_read_element_data */
+	/* TODO: add tests for libfsxfs_inode_get_extent_by_index */
 
 	/* Clean up
 	 */
@@ -1628,4 +1869,3 @@ on_error:
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 }
-
@@ -0,0 +1,1438 @@
+/*
+ * Library inode_allocation_map type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_inode_allocation_map.h"
+#include "../libfsxfs/libfsxfs_superblock.h"
+#include "../libfsxfs/libfsxfs_volume.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_inode_allocation_map_open_source(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     const system_character_t *index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_inode_allocation_map_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfsxfs_volume_set_index_file_wide(
+		          *volume,
+		          index_file,
+		          error );
+#else
+		result = libfsxfs_volume_set_index_file(
+		          *volume,
+		          index_file,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#else
+	result = libfsxfs_volume_open(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_inode_allocation_map_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_inode_allocation_map_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_inode_allocation_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_initialize(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	int result                                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_allocation_map = (libfsxfs_inode_allocation_map_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	inode_allocation_map = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_allocation_map_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_allocation_map_initialize(
+		          &inode_allocation_map,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( inode_allocation_map != NULL )
+			{
+				libfsxfs_inode_allocation_map_free(
+				 &inode_allocation_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_allocation_map",
+			 inode_allocation_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_allocation_map_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_allocation_map_initialize(
+		          &inode_allocation_map,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( inode_allocation_map != NULL )
+			{
+				libfsxfs_inode_allocation_map_free(
+				 &inode_allocation_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode_allocation_map",
+			 inode_allocation_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_append_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_append_chunk(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          inode_allocation_map,
+	          128,
+	          0xfffffffffffffff8ULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          inode_allocation_map,
+	          192,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "inode_allocation_map->number_of_chunks",
+	 inode_allocation_map->number_of_chunks,
+	 (size_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          NULL,
+	          256,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an inode chunk that overlaps with the last inode chunk
+	 */
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          inode_allocation_map,
+	          224,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_is_inode_allocated function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_is_inode_allocated(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          inode_allocation_map,
+	          128,
+	          0xfffffffffffffff8ULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_append_chunk(
+	          inode_allocation_map,
+	          1024,
+	          0x8000000000000000ULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          130,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          1086,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test free inodes of an inode chunk
+	 */
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          131,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          1087,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inodes outside the inode chunks
+	 */
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          127,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          192,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          1088,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          NULL,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_allocation_map",
+	 inode_allocation_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_get_chunk_by_inode_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_get_chunk_by_inode_number(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_chunk_t *chunk          = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	libfsxfs_internal_volume_t *internal_volume           = NULL;
+	uint64_t inode_number                                 = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_allocation_map_read_file_system(
+	          inode_allocation_map,
+	          internal_volume->file_system->inode_btree,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	inode_number = internal_volume->file_system->root_directory_inode_number;
+
+	result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+	          inode_allocation_map,
+	          inode_number,
+	          &chunk,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk",
+	 chunk );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Since the values are unsigned this also fails if the chunk starts after the inode
+	 */
+	FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "inode_number - chunk->first_inode_number",
+	 inode_number - chunk->first_inode_number,
+	 (uint64_t) 64 );
+
+	/* The root directory inode is allocated
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk->free_inodes_bitmap",
+	 chunk->free_inodes_bitmap & ( (uint64_t) 1 << ( inode_number - chunk->first_inode_number ) ),
+	 (uint64_t) 0 );
+
+	/* The first inode of an allocation group is never part of an inode chunk
+	 * since the first block of an allocation group contains the superblock
+	 */
+	chunk = NULL;
+
+	result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+	          inode_allocation_map,
+	          0,
+	          &chunk,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "chunk",
+	 chunk );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+	          NULL,
+	          inode_number,
+	          &chunk,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_allocation_map_get_chunk_by_inode_number(
+	          inode_allocation_map,
+	          inode_number,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_read_allocation_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_read_allocation_group(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	libfsxfs_internal_volume_t *internal_volume           = NULL;
+	size_t chunk_index                                    = 0;
+	uint32_t allocation_group_index                       = 0;
+	uint32_t number_of_allocation_groups                  = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	internal_volume             = (libfsxfs_internal_volume_t *) volume;
+	number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
+
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		result = libfsxfs_inode_allocation_map_read_allocation_group(
+		          inode_allocation_map,
+		          internal_volume->file_system->inode_btree,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          allocation_group_index,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 (uint64_t) inode_allocation_map->number_of_chunks * 64,
+	 internal_volume->superblock->number_of_inodes );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_free_inodes",
+	 inode_allocation_map->number_of_free_inodes,
+	 internal_volume->superblock->number_of_free_inodes );
+
+	for( chunk_index = 1;
+	     chunk_index < inode_allocation_map->number_of_chunks;
+	     chunk_index++ )
+	{
+		FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+		 "chunks[ chunk_index - 1 ].first_inode_number",
+		 inode_allocation_map->chunks[ chunk_index - 1 ].first_inode_number,
+		 inode_allocation_map->chunks[ chunk_index ].first_inode_number );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_read_allocation_group(
+	          NULL,
+	          internal_volume->file_system->inode_btree,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_allocation_map_read_allocation_group(
+	          inode_allocation_map,
+	          internal_volume->file_system->inode_btree,
+	          NULL,
+	          internal_volume->file_io_handle,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_allocation_map_read_allocation_group(
+	          inode_allocation_map,
+	          internal_volume->file_system->inode_btree,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_allocation_map_read_file_system function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_allocation_map_read_file_system(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                              = NULL;
+	libfsxfs_inode_allocation_map_t *inode_allocation_map = NULL;
+	libfsxfs_internal_volume_t *internal_volume           = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_inode_allocation_map_initialize(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_allocation_map_read_file_system(
+	          inode_allocation_map,
+	          internal_volume->file_system->inode_btree,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_chunks",
+	 (uint64_t) inode_allocation_map->number_of_chunks * 64,
+	 internal_volume->superblock->number_of_inodes );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_free_inodes",
+	 inode_allocation_map->number_of_free_inodes,
+	 internal_volume->superblock->number_of_free_inodes );
+
+	result = libfsxfs_inode_allocation_map_is_inode_allocated(
+	          inode_allocation_map,
+	          internal_volume->file_system->root_directory_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_allocation_map_read_file_system(
+	          NULL,
+	          internal_volume->file_system->inode_btree,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_allocation_map_free(
+	          &inode_allocation_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_allocation_map != NULL )
+	{
+		libfsxfs_inode_allocation_map_free(
+		 &inode_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	libcerror_error_t *error       = NULL;
+	libfsxfs_volume_t *volume      = NULL;
+	system_character_t *index_file = NULL;
+	system_character_t *source     = NULL;
+	system_integer_t option        = 0;
+	int result                     = 0;
+#endif
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				index_file = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_allocation_map_initialize",
+	 fsxfs_test_inode_allocation_map_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_allocation_map_free",
+	 fsxfs_test_inode_allocation_map_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_allocation_map_append_chunk",
+	 fsxfs_test_inode_allocation_map_append_chunk );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_allocation_map_is_inode_allocated",
+	 fsxfs_test_inode_allocation_map_is_inode_allocated );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize volume for tests
+		 */
+		result = fsxfs_test_inode_allocation_map_open_source(
+		          &volume,
+		          source,
+		          index_file,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_inode_allocation_map_get_chunk_by_inode_number",
+		 fsxfs_test_inode_allocation_map_get_chunk_by_inode_number,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_inode_allocation_map_read_allocation_group",
+		 fsxfs_test_inode_allocation_map_read_allocation_group,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_inode_allocation_map_read_file_system",
+		 fsxfs_test_inode_allocation_map_read_file_system,
+		 volume );
+
+		/* Clean up
+		 */
+		result = fsxfs_test_inode_allocation_map_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -374,6 +374,21 @@ int fsxfs_test_inode_information_read_data(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_information->free_inode_btree_root_block_number",
+	 inode_information->free_inode_btree_root_block_number,
+	 4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_information->free_inode_btree_depth",
+	 inode_information->free_inode_btree_depth,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_information->unlinked_buckets[ 0 ]",
+	 inode_information->unlinked_buckets[ 0 ],
+	 0xffffffffUL );
+
 	/* Test error cases
 	 */
 	result = libfsxfs_inode_information_read_data(
@@ -34,6 +34,7 @@
 #include "fsxfs_test_unused.h"
 
 #include "../libfsxfs/libfsxfs_io_handle.h"
+#include "../libfsxfs/libfsxfs_statistics.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
@@ -398,6 +399,538 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_io_handle_get_timestamp function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_handle_get_timestamp(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_io_handle_t *io_handle = NULL;
+	uint64_t timestamp              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	timestamp = libfsxfs_io_handle_get_timestamp(
+	             io_handle );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	timestamp = libfsxfs_io_handle_get_timestamp(
+	             NULL );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "timestamp",
+	 timestamp,
+	 (uint64_t) 0 );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_handle_add_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_handle_add_read(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_handle_add_read(
+	          io_handle,
+	          LIBFSXFS_READ_CATEGORY_INODE,
+	          0,
+	          512,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read is not accounted when statistics are not collected
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE ]",
+	 io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE ],
+	 (uint64_t) 0 );
+
+	io_handle->collect_statistics = 1;
+
+	result = libfsxfs_io_handle_add_read(
+	          io_handle,
+	          LIBFSXFS_READ_CATEGORY_INODE,
+	          0,
+	          512,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE ]",
+	 io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_INODE ],
+	 (uint64_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_bytes_read[ LIBFSXFS_READ_CATEGORY_INODE ]",
+	 io_handle->statistics->number_of_bytes_read[ LIBFSXFS_READ_CATEGORY_INODE ],
+	 (uint64_t) 512 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_handle_add_read(
+	          NULL,
+	          LIBFSXFS_READ_CATEGORY_INODE,
+	          0,
+	          512,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_handle_add_read(
+	          io_handle,
+	          -1,
+	          0,
+	          512,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_handle_add_cache_lookup function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_handle_add_cache_lookup(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_handle_add_cache_lookup(
+	          io_handle,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache lookup is not accounted when statistics are not collected
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_cache_hits",
+	 io_handle->statistics->number_of_cache_hits,
+	 (uint64_t) 0 );
+
+	io_handle->collect_statistics = 1;
+
+	result = libfsxfs_io_handle_add_cache_lookup(
+	          io_handle,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_add_cache_lookup(
+	          io_handle,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_cache_hits",
+	 io_handle->statistics->number_of_cache_hits,
+	 (uint64_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->statistics->number_of_cache_misses",
+	 io_handle->statistics->number_of_cache_misses,
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_handle_add_cache_lookup(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_handle_update_progress function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_handle_update_progress(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_handle_update_progress(
+	          io_handle,
+	          LIBFSXFS_PROGRESS_TYPE_DATA,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_handle_update_progress(
+	          NULL,
+	          LIBFSXFS_PROGRESS_TYPE_DATA,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfsxfs_io_handle_update_progress with abort signalled
+	 */
+	io_handle->abort = 1;
+
+	result = libfsxfs_io_handle_update_progress(
+	          io_handle,
+	          LIBFSXFS_PROGRESS_TYPE_DATA,
+	          0,
+	          0,
+	          &error );
+
+	io_handle->abort = 0;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +962,22 @@ int main(
 	 "libfsxfs_io_handle_clear",
 	 fsxfs_test_io_handle_clear );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_handle_get_timestamp",
+	 fsxfs_test_io_handle_get_timestamp );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_handle_add_read",
+	 fsxfs_test_io_handle_add_read );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_handle_add_cache_lookup",
+	 fsxfs_test_io_handle_add_cache_lookup );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_handle_update_progress",
+	 fsxfs_test_io_handle_update_progress );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,498 @@
+/*
+ * Library io_uring type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_io_uring.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING )
+
+/* Tests the libfsxfs_io_uring_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_uring_initialize(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfsxfs_io_uring_t *io_uring = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 * The kernel can lack support for io_uring or not permit its use
+	 */
+	result = libfsxfs_io_uring_initialize(
+	          &io_uring,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "io_uring",
+		 io_uring );
+	}
+	else
+	{
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "io_uring",
+		 io_uring );
+
+		result = libfsxfs_io_uring_free(
+		          &io_uring,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "io_uring",
+		 io_uring );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_io_uring_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_uring = (libfsxfs_io_uring_t *) 0x12345678UL;
+
+	result = libfsxfs_io_uring_initialize(
+	          &io_uring,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_uring = NULL;
+
+	result = libfsxfs_io_uring_initialize(
+	          &io_uring,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_uring_initialize(
+	          &io_uring,
+	          LIBFSXFS_IO_URING_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_uring != NULL )
+	{
+		libfsxfs_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_uring_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_uring_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_uring_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_io_uring_read_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_uring_read_requests(
+     void )
+{
+	libfsxfs_io_request_t requests[ 1 ];
+	uint8_t request_data[ 512 ];
+
+	libcerror_error_t *error                      = NULL;
+	libfsxfs_direct_io_handle_t *direct_io_handle = NULL;
+	libfsxfs_io_uring_t *io_uring                 = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_uring_initialize(
+	          &io_uring,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = libfsxfs_direct_io_handle_initialize(
+	          &direct_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "direct_io_handle",
+	 direct_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	requests[ 0 ].offset    = 0;
+	requests[ 0 ].data      = request_data;
+	requests[ 0 ].data_size = 512;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_uring_read_requests(
+	          io_uring,
+	          direct_io_handle,
+	          requests,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_uring_read_requests(
+	          NULL,
+	          direct_io_handle,
+	          requests,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_uring_read_requests(
+	          io_uring,
+	          NULL,
+	          requests,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_uring_read_requests(
+	          io_uring,
+	          direct_io_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_uring_read_requests(
+	          io_uring,
+	          direct_io_handle,
+	          requests,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	requests[ 0 ].offset = -1;
+
+	result = libfsxfs_io_uring_read_requests(
+	          io_uring,
+	          direct_io_handle,
+	          requests,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_direct_io_handle_free(
+	          &direct_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "direct_io_handle",
+	 direct_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_uring_free(
+	          &io_uring,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_uring",
+	 io_uring );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( direct_io_handle != NULL )
+	{
+		libfsxfs_direct_io_handle_free(
+		 &direct_io_handle,
+		 NULL );
+	}
+	if( io_uring != NULL )
+	{
+		libfsxfs_io_uring_free(
+		 &io_uring,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_uring_initialize",
+	 fsxfs_test_io_uring_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_uring_free",
+	 fsxfs_test_io_uring_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_uring_read_requests",
+	 fsxfs_test_io_uring_read_requests );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) && defined( HAVE_LIBFSXFS_IO_URING ) */
+}
+
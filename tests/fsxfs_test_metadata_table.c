@@ -0,0 +1,655 @@
+/*
+ * Library metadata_table type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_metadata_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_metadata_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_metadata_table_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_metadata_table_t *metadata_table = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_metadata_table_initialize(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_free(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_metadata_table_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_table = (libfsxfs_metadata_table_t *) 0x12345678UL;
+
+	result = libfsxfs_metadata_table_initialize(
+	          &metadata_table,
+	          &error );
+
+	metadata_table = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_metadata_table_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_metadata_table_initialize(
+		          &metadata_table,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_table != NULL )
+			{
+				libfsxfs_metadata_table_free(
+				 &metadata_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "metadata_table",
+			 metadata_table );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_metadata_table_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_metadata_table_initialize(
+		          &metadata_table,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( metadata_table != NULL )
+			{
+				libfsxfs_metadata_table_free(
+				 &metadata_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "metadata_table",
+			 metadata_table );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_table != NULL )
+	{
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_metadata_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_metadata_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_metadata_table_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_metadata_table_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_metadata_table_resize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_metadata_table_t *metadata_table = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_metadata_table_initialize(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_metadata_table_resize(
+	          metadata_table,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_table->rows",
+	 metadata_table->rows );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "metadata_table->number_of_allocated_rows",
+	 metadata_table->number_of_allocated_rows,
+	 LIBFSXFS_METADATA_TABLE_INITIAL_NUMBER_OF_ROWS );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_table->string_heap",
+	 metadata_table->string_heap );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_table->allocated_string_heap_size",
+	 metadata_table->allocated_string_heap_size,
+	 (size_t) LIBFSXFS_METADATA_TABLE_INITIAL_STRING_HEAP_SIZE );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_metadata_table_resize(
+	          NULL,
+	          16,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_metadata_table_resize(
+	          metadata_table,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_metadata_table_free(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_table != NULL )
+	{
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_metadata_table_has_ancestor function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_metadata_table_has_ancestor(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsxfs_metadata_table_t *metadata_table = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_metadata_table_initialize(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_resize(
+	          metadata_table,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Build a root directory with a single sub directory
+	 */
+	metadata_table->rows[ 0 ].inode_number     = 128;
+	metadata_table->rows[ 0 ].parent_row_index = -1;
+	metadata_table->rows[ 1 ].inode_number     = 131;
+	metadata_table->rows[ 1 ].parent_row_index = 0;
+	metadata_table->number_of_rows             = 2;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_metadata_table_has_ancestor(
+	          metadata_table,
+	          1,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_has_ancestor(
+	          metadata_table,
+	          1,
+	          132,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_has_ancestor(
+	          metadata_table,
+	          -1,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_metadata_table_has_ancestor(
+	          NULL,
+	          1,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_metadata_table_has_ancestor(
+	          metadata_table,
+	          2,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a parent row index loop
+	 */
+	metadata_table->rows[ 0 ].parent_row_index = 1;
+
+	result = libfsxfs_metadata_table_has_ancestor(
+	          metadata_table,
+	          1,
+	          132,
+	          &error );
+
+	metadata_table->rows[ 0 ].parent_row_index = -1;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_metadata_table_free(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "metadata_table",
+	 metadata_table );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_table != NULL )
+	{
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_metadata_table_initialize",
+	 fsxfs_test_metadata_table_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_metadata_table_free",
+	 fsxfs_test_metadata_table_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_metadata_table_resize",
+	 fsxfs_test_metadata_table_resize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_metadata_table_has_ancestor",
+	 fsxfs_test_metadata_table_has_ancestor );
+
+	/* TODO: add tests for libfsxfs_metadata_table_append_row */
+
+	/* TODO: add tests for libfsxfs_metadata_table_write_file_io_handle */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,764 @@
+/*
+ * Library offset_index type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_offset_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_offset_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_offset_index_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_offset_index_t *offset_index = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_offset_index_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset_index = (libfsxfs_offset_index_t *) 0x12345678UL;
+
+	result = libfsxfs_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	offset_index = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_offset_index_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_offset_index_initialize(
+		          &offset_index,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( offset_index != NULL )
+			{
+				libfsxfs_offset_index_free(
+				 &offset_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "offset_index",
+			 offset_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_offset_index_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_offset_index_initialize(
+		          &offset_index,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( offset_index != NULL )
+			{
+				libfsxfs_offset_index_free(
+				 &offset_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "offset_index",
+			 offset_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_index != NULL )
+	{
+		libfsxfs_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_offset_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_offset_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_offset_index_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_offset_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_offset_index_append_entry(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_offset_index_t *offset_index = NULL;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < ( LIBFSXFS_OFFSET_INDEX_INITIAL_NUMBER_OF_ENTRIES + 1 );
+	     entry_index++ )
+	{
+		result = libfsxfs_offset_index_append_entry(
+		          offset_index,
+		          (off64_t) entry_index * 8192,
+		          4096,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->number_of_entries",
+	 offset_index->number_of_entries,
+	 LIBFSXFS_OFFSET_INDEX_INITIAL_NUMBER_OF_ENTRIES + 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "offset_index->size",
+	 offset_index->size,
+	 (uint64_t) ( LIBFSXFS_OFFSET_INDEX_INITIAL_NUMBER_OF_ENTRIES + 1 ) * 4096 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset_index->entries[ 1 ].logical_offset",
+	 (int64_t) offset_index->entries[ 1 ].logical_offset,
+	 (int64_t) 4096 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset_index->entries[ 1 ].physical_offset",
+	 (int64_t) offset_index->entries[ 1 ].physical_offset,
+	 (int64_t) 8192 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_offset_index_append_entry(
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_offset_index_append_entry(
+	          offset_index,
+	          -1,
+	          4096,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_offset_index_append_entry(
+	          offset_index,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_index != NULL )
+	{
+		libfsxfs_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_offset_index_get_entry_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_offset_index_get_entry_at_offset(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_offset_index_entry_t *entry  = NULL;
+	libfsxfs_offset_index_t *offset_index = NULL;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_offset_index_initialize(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The entries have different sizes so that the logical offsets
+	 * are not a multiple of the entry index
+	 */
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		result = libfsxfs_offset_index_append_entry(
+		          offset_index,
+		          (off64_t) ( 99 - entry_index ) * 1048576,
+		          (size64_t) ( ( entry_index % 3 ) + 1 ) * 4096,
+		          0,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 100;
+	     entry_index++ )
+	{
+		result = libfsxfs_offset_index_get_entry_at_offset(
+		          offset_index,
+		          offset_index->entries[ entry_index ].logical_offset + 4095,
+		          &entry,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "entry",
+		 entry );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT64(
+		 "entry->physical_offset",
+		 (int64_t) entry->physical_offset,
+		 (int64_t) ( 99 - entry_index ) * 1048576 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a lookup that requires a search
+	 */
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          12288,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 (int) ( entry - offset_index->entries ),
+	 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->last_entry_index",
+	 offset_index->last_entry_index,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          0,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 (int) ( entry - offset_index->entries ),
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->last_entry_index",
+	 offset_index->last_entry_index,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a lookup of the entry that follows the entry of the last lookup
+	 */
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          4096,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 (int) ( entry - offset_index->entries ),
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "offset_index->last_entry_index",
+	 offset_index->last_entry_index,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offsets beyond the end of the index
+	 */
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          (off64_t) offset_index->size,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          -1,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          NULL,
+	          0,
+	          &entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_offset_index_get_entry_at_offset(
+	          offset_index,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_offset_index_free(
+	          &offset_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "offset_index",
+	 offset_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_index != NULL )
+	{
+		libfsxfs_offset_index_free(
+		 &offset_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_offset_index_initialize",
+	 fsxfs_test_offset_index_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_offset_index_free",
+	 fsxfs_test_offset_index_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_offset_index_append_entry",
+	 fsxfs_test_offset_index_append_entry );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_offset_index_get_entry_at_offset",
+	 fsxfs_test_offset_index_get_entry_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1400 @@
+/*
+ * Library owner_map type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_owner_map.h"
+#include "../libfsxfs/libfsxfs_superblock.h"
+#include "../libfsxfs/libfsxfs_volume.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_owner_map_open_source(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     const system_character_t *index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_owner_map_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfsxfs_volume_set_index_file_wide(
+		          *volume,
+		          index_file,
+		          error );
+#else
+		result = libfsxfs_volume_set_index_file(
+		          *volume,
+		          index_file,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#else
+	result = libfsxfs_volume_open(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_owner_map_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_owner_map_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_owner_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_owner_map_t *owner_map = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_free(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	owner_map = (libfsxfs_owner_map_t *) 0x12345678UL;
+
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	owner_map = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_owner_map_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_owner_map_initialize(
+		          &owner_map,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( owner_map != NULL )
+			{
+				libfsxfs_owner_map_free(
+				 &owner_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "owner_map",
+			 owner_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_owner_map_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_owner_map_initialize(
+		          &owner_map,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( owner_map != NULL )
+			{
+				libfsxfs_owner_map_free(
+				 &owner_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "owner_map",
+			 owner_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &owner_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_owner_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_owner_map_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_append_entry(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_owner_map_t *owner_map = NULL;
+	int entry_index                 = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < ( LIBFSXFS_OWNER_MAP_INITIAL_NUMBER_OF_ENTRIES + 1 );
+	     entry_index++ )
+	{
+		result = libfsxfs_owner_map_append_entry(
+		          owner_map,
+		          (off64_t) entry_index * 4096,
+		          4096,
+		          (uint64_t) entry_index + 128,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "owner_map->number_of_entries",
+	 owner_map->number_of_entries,
+	 LIBFSXFS_OWNER_MAP_INITIAL_NUMBER_OF_ENTRIES + 1 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_append_entry(
+	          NULL,
+	          0,
+	          4096,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_append_entry(
+	          owner_map,
+	          -1,
+	          4096,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_append_entry(
+	          owner_map,
+	          0,
+	          0,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_owner_map_free(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &owner_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_owner_map_get_inode_number_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_get_inode_number_by_offset(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_owner_map_t *owner_map = NULL;
+	uint64_t inode_number           = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Entries are appended out of order to test the sort
+	 */
+	result = libfsxfs_owner_map_append_entry(
+	          owner_map,
+	          65536,
+	          8192,
+	          131,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_append_entry(
+	          owner_map,
+	          16384,
+	          4096,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the entries are not sorted
+	 */
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          16384,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_sort(
+	          owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          16384,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 (uint64_t) 128 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          73727,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 (uint64_t) 131 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offsets that are not owned
+	 */
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          0,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          20480,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          73728,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          NULL,
+	          16384,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_get_inode_number_by_offset(
+	          owner_map,
+	          16384,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_owner_map_free(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &owner_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_owner_map_read_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_read_inode(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_owner_map_t *owner_map             = NULL;
+	uint64_t inode_number                       = 0;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+	inode_number    = internal_volume->file_system->root_directory_inode_number;
+
+	result = libfsxfs_file_system_get_inode_by_number(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          inode_number,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_owner_map_read_inode(
+	          owner_map,
+	          internal_volume->io_handle,
+	          inode,
+	          inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < owner_map->number_of_entries;
+	     entry_index++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "owner_map->entries[ entry_index ].inode_number",
+		 owner_map->entries[ entry_index ].inode_number,
+		 inode_number );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_read_inode(
+	          NULL,
+	          internal_volume->io_handle,
+	          inode,
+	          inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_read_inode(
+	          owner_map,
+	          NULL,
+	          inode,
+	          inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_read_inode(
+	          owner_map,
+	          internal_volume->io_handle,
+	          NULL,
+	          inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_owner_map_free(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &owner_map,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_owner_map_read_file_system function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_owner_map_read_file_system(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_owner_map_entry_t *entry           = NULL;
+	libfsxfs_owner_map_t *owner_map             = NULL;
+	uint64_t inode_number                       = 0;
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_owner_map_initialize(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_owner_map_read_file_system(
+	          owner_map,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "owner_map->number_of_entries",
+	 owner_map->number_of_entries,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "owner_map->is_sorted",
+	 owner_map->is_sorted,
+	 1 );
+
+	/* Every entry must be owned by an allocated inode, must not overlap
+	 * with the next entry and must be found by its first and last offset
+	 */
+	for( entry_index = 0;
+	     entry_index < owner_map->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( owner_map->entries[ entry_index ] );
+
+		result = libfsxfs_volume_is_inode_allocated(
+		          volume,
+		          entry->inode_number,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( entry_index + 1 ) < owner_map->number_of_entries )
+		{
+			FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+			 "entry->offset + entry->size",
+			 (uint64_t) entry->offset + entry->size,
+			 (uint64_t) owner_map->entries[ entry_index + 1 ].offset + 1 );
+		}
+		result = libfsxfs_owner_map_get_inode_number_by_offset(
+		          owner_map,
+		          entry->offset,
+		          &inode_number,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_number",
+		 inode_number,
+		 entry->inode_number );
+
+		result = libfsxfs_owner_map_get_inode_number_by_offset(
+		          owner_map,
+		          entry->offset + entry->size - 1,
+		          &inode_number,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "inode_number",
+		 inode_number,
+		 entry->inode_number );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_owner_map_read_file_system(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_owner_map_read_file_system(
+	          owner_map,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          NULL,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_owner_map_free(
+	          &owner_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "owner_map",
+	 owner_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner_map != NULL )
+	{
+		libfsxfs_owner_map_free(
+		 &owner_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	libcerror_error_t *error       = NULL;
+	libfsxfs_volume_t *volume      = NULL;
+	system_character_t *index_file = NULL;
+	system_character_t *source     = NULL;
+	system_integer_t option        = 0;
+	int result                     = 0;
+#endif
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				index_file = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	FSXFS_TEST_RUN(
+	 "libfsxfs_owner_map_initialize",
+	 fsxfs_test_owner_map_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_owner_map_free",
+	 fsxfs_test_owner_map_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_owner_map_append_entry",
+	 fsxfs_test_owner_map_append_entry );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_owner_map_get_inode_number_by_offset",
+	 fsxfs_test_owner_map_get_inode_number_by_offset );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize volume for tests
+		 */
+		result = fsxfs_test_owner_map_open_source(
+		          &volume,
+		          source,
+		          index_file,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_owner_map_read_inode",
+		 fsxfs_test_owner_map_read_inode,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_owner_map_read_file_system",
+		 fsxfs_test_owner_map_read_file_system,
+		 volume );
+
+		/* Clean up
+		 */
+		result = fsxfs_test_owner_map_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
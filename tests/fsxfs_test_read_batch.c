@@ -0,0 +1,1436 @@
+/*
+ * Library read_batch type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+#include "../libfsxfs/libfsxfs_libcdata.h"
+#include "../libfsxfs/libfsxfs_read_batch.h"
+#include "../libfsxfs/libfsxfs_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates an inode with the data extents used by the tests
+ * The inode has the blocks: 0-1 stored in blocks 2-3, 2 sparse, 3 not covered by an extent
+ * and 4 stored in block 1
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_read_batch_create_inode(
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	uint64_t logical_block_numbers[ 3 ]  = { 0, 2, 4 };
+	uint64_t physical_block_numbers[ 3 ] = { 2, 0, 1 };
+	uint32_t numbers_of_blocks[ 3 ]      = { 2, 1, 1 };
+	uint32_t range_flags[ 3 ]            = { 0, LIBFSXFS_EXTENT_FLAG_IS_SPARSE, 0 };
+
+	libfsxfs_extent_t *extent            = NULL;
+	int entry_index                      = 0;
+	int extent_index                     = 0;
+
+	if( libfsxfs_inode_initialize(
+	     inode,
+	     512,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *inode )->inode_number = 5;
+	( *inode )->fork_type    = LIBFSXFS_FORK_TYPE_EXTENTS;
+	( *inode )->size         = 2560;
+
+	if( libcdata_array_initialize(
+	     &( ( *inode )->data_extents_array ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < 3;
+	     extent_index++ )
+	{
+		if( libfsxfs_extent_initialize(
+		     &extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent->logical_block_number  = logical_block_numbers[ extent_index ];
+		extent->physical_block_number = physical_block_numbers[ extent_index ];
+		extent->number_of_blocks      = numbers_of_blocks[ extent_index ];
+		extent->range_flags           = range_flags[ extent_index ];
+
+		if( libcdata_array_append_entry(
+		     ( *inode )->data_extents_array,
+		     &entry_index,
+		     (intptr_t *) extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		extent = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &extent,
+		 NULL );
+	}
+	if( *inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_read_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_batch_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_io_handle_t *io_handle   = NULL;
+	libfsxfs_read_batch_t *read_batch = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_batch_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_batch = (libfsxfs_read_batch_t *) 0x12345678UL;
+
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	read_batch = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	/* Test libfsxfs_read_batch_initialize with malloc failing
+	 */
+	fsxfs_test_malloc_attempts_before_fail = 0;
+
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          io_handle,
+	          NULL,
+	          &error );
+
+	if( fsxfs_test_malloc_attempts_before_fail != -1 )
+	{
+		fsxfs_test_malloc_attempts_before_fail = -1;
+
+		if( read_batch != NULL )
+		{
+			libfsxfs_read_batch_free(
+			 &read_batch,
+			 NULL );
+		}
+	}
+	else
+	{
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "read_batch",
+		 read_batch );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libfsxfs_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_batch_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_batch_get_extent_index_at_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_batch_get_extent_index_at_block(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfsxfs_inode_t *inode  = NULL;
+	int extent_index         = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_read_batch_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          inode,
+	          1,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          inode,
+	          4,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a block that is not covered by an extent
+	 */
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          inode,
+	          3,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          inode,
+	          8,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          NULL,
+	          1,
+	          &extent_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_get_extent_index_at_block(
+	          inode,
+	          1,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_batch_add_range and libfsxfs_read_batch_flush functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_batch_add_range_and_flush(
+     void )
+{
+	uint8_t buffer[ 3072 ];
+	uint8_t data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_inode_t *inode           = NULL;
+	libfsxfs_io_handle_t *io_handle   = NULL;
+	libfsxfs_read_batch_t *read_batch = NULL;
+	size_t buffer_offset              = 0;
+	ssize_t range_read_count          = 0;
+	uint8_t expected_byte             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 4096;
+	     buffer_offset++ )
+	{
+		data[ buffer_offset ] = (uint8_t) ( ( buffer_offset % 251 ) + 1 );
+	}
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size                           = 512;
+	io_handle->allocation_group_size                = 8;
+	io_handle->number_of_relative_block_number_bits = 3;
+
+	result = fsxfs_test_read_batch_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          buffer,
+	          3072,
+	          256,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_count",
+	 range_read_count,
+	 (ssize_t) 2304 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_entries",
+	 read_batch->number_of_entries,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_flush(
+	          read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_count",
+	 range_read_count,
+	 (ssize_t) 2304 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_entries",
+	 read_batch->number_of_entries,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Offset 256 of the data is stored in block 2, logical block 2 is sparse,
+	 * logical block 3 is not covered by an extent and logical block 4 is stored in block 1
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 2304;
+	     buffer_offset++ )
+	{
+		if( buffer_offset < 768 )
+		{
+			expected_byte = data[ 1280 + buffer_offset ];
+		}
+		else if( buffer_offset < 1792 )
+		{
+			expected_byte = 0;
+		}
+		else
+		{
+			expected_byte = data[ buffer_offset - 1280 ];
+		}
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 expected_byte );
+	}
+	/* Test a range beyond the data size
+	 */
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          buffer,
+	          3072,
+	          4096,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_count",
+	 range_read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a failed read
+	 */
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          4000,
+	          buffer,
+	          512,
+	          5,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_flush(
+	          read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_count",
+	 range_read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_batch_add_range(
+	          NULL,
+	          inode,
+	          2560,
+	          buffer,
+	          3072,
+	          0,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          NULL,
+	          2560,
+	          buffer,
+	          3072,
+	          0,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          NULL,
+	          3072,
+	          0,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          buffer,
+	          3072,
+	          -1,
+	          &range_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_add_range(
+	          read_batch,
+	          inode,
+	          2560,
+	          buffer,
+	          3072,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_batch_flush(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libfsxfs_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_batch_flush function with entries that are merged
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_batch_flush_merged(
+     void )
+{
+	uint8_t first_buffer[ 1024 ];
+	uint8_t second_buffer[ 512 ];
+	uint8_t third_buffer[ 1024 ];
+	uint8_t data[ 4096 ];
+	ssize_t range_read_counts[ 4 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libfsxfs_io_handle_t *io_handle   = NULL;
+	libfsxfs_read_batch_t *read_batch = NULL;
+	size_t buffer_offset              = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	for( buffer_offset = 0;
+	     buffer_offset < 4096;
+	     buffer_offset++ )
+	{
+		data[ buffer_offset ] = (uint8_t) ( ( buffer_offset % 251 ) + 1 );
+	}
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->collect_statistics = 1;
+
+	result = libfsxfs_read_batch_initialize(
+	          &read_batch,
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The entries at offsets 512, 1024 and 1536 are adjacent and read as one read
+	 * using a merge buffer, the entries at offsets 3584 and 4096 are adjacent but
+	 * the read is short
+	 */
+	range_read_counts[ 0 ] = 1024;
+	range_read_counts[ 1 ] = 512;
+	range_read_counts[ 2 ] = 1024;
+	range_read_counts[ 3 ] = 512;
+
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          1024,
+	          first_buffer,
+	          512,
+	          5,
+	          &( range_read_counts[ 0 ] ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          512,
+	          second_buffer,
+	          512,
+	          5,
+	          &( range_read_counts[ 1 ] ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          3584,
+	          third_buffer,
+	          512,
+	          5,
+	          &( range_read_counts[ 2 ] ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          1536,
+	          &( first_buffer[ 512 ] ),
+	          512,
+	          5,
+	          &( range_read_counts[ 0 ] ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_append_entry(
+	          read_batch,
+	          4096,
+	          &( third_buffer[ 512 ] ),
+	          512,
+	          5,
+	          &( range_read_counts[ 3 ] ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_batch_flush(
+	          read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 io_handle->statistics->number_of_reads[ LIBFSXFS_READ_CATEGORY_FILE_DATA ],
+	 (uint64_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_counts[ 0 ]",
+	 range_read_counts[ 0 ],
+	 (ssize_t) 1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_counts[ 1 ]",
+	 range_read_counts[ 1 ],
+	 (ssize_t) 512 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_counts[ 2 ]",
+	 range_read_counts[ 2 ],
+	 (ssize_t) 1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "range_read_counts[ 3 ]",
+	 range_read_counts[ 3 ],
+	 (ssize_t) -1 );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 1024;
+	     buffer_offset++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "first_buffer[ buffer_offset ]",
+		 first_buffer[ buffer_offset ],
+		 data[ 1024 + buffer_offset ] );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < 512;
+	     buffer_offset++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "second_buffer[ buffer_offset ]",
+		 second_buffer[ buffer_offset ],
+		 data[ 512 + buffer_offset ] );
+	}
+	for( buffer_offset = 0;
+	     buffer_offset < 512;
+	     buffer_offset++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "third_buffer[ buffer_offset ]",
+		 third_buffer[ buffer_offset ],
+		 data[ 3584 + buffer_offset ] );
+	}
+	/* Clean up
+	 */
+	result = libfsxfs_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libfsxfs_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_batch_initialize",
+	 fsxfs_test_read_batch_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_batch_free",
+	 fsxfs_test_read_batch_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_batch_get_extent_index_at_block",
+	 fsxfs_test_read_batch_get_extent_index_at_block );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_batch_add_range",
+	 fsxfs_test_read_batch_add_range_and_flush );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_batch_flush",
+	 fsxfs_test_read_batch_flush_merged );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,819 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_read_queue.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* The read queue test callback
+ * Adds the read count to the callback data
+ */
+void fsxfs_test_read_queue_callback(
+      intptr_t *callback_data,
+      libfsxfs_file_entry_t *file_entry FSXFS_TEST_ATTRIBUTE_UNUSED,
+      void *buffer FSXFS_TEST_ATTRIBUTE_UNUSED,
+      ssize_t read_count )
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( file_entry )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( buffer )
+
+	*( (ssize_t *) callback_data ) += read_count;
+}
+
+/* Tests the libfsxfs_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfsxfs_read_queue_t *read_queue = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libfsxfs_read_queue_t *) 0x12345678UL;
+
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          &error );
+
+	read_queue = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_read_queue_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_read_queue_initialize(
+		          &read_queue,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( read_queue != NULL )
+			{
+				libfsxfs_read_queue_free(
+				 &read_queue,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "read_queue",
+			 read_queue );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_push_request and libfsxfs_read_queue_pop_requests functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_push_and_pop_requests(
+     void )
+{
+	libfsxfs_read_queue_request_t *requests[ 4 ];
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error          = NULL;
+	libfsxfs_read_queue_t *read_queue = NULL;
+	ssize_t callback_read_count       = 0;
+	int number_of_requests            = 0;
+	int request_index                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( request_index = 0;
+	     request_index < 3;
+	     request_index++ )
+	{
+		result = libfsxfs_read_queue_push_request(
+		          read_queue,
+		          (libfsxfs_file_entry_t *) 0x12345678UL,
+		          buffer,
+		          16,
+		          (off64_t) request_index * 16,
+		          &fsxfs_test_read_queue_callback,
+		          (intptr_t *) &callback_read_count,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_read_queue_get_number_of_requests(
+	          read_queue,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_read_queue_pop_requests(
+	          read_queue,
+	          requests,
+	          2,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "requests[ 0 ]->offset",
+	 (int64_t) requests[ 0 ]->offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "requests[ 1 ]->offset",
+	 (int64_t) requests[ 1 ]->offset,
+	 (int64_t) 16 );
+
+	for( request_index = 0;
+	     request_index < 2;
+	     request_index++ )
+	{
+		requests[ request_index ]->read_count = 16;
+
+		result = libfsxfs_read_queue_complete_request(
+		          &( requests[ request_index ] ),
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "requests[ request_index ]",
+		 requests[ request_index ] );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "callback_read_count",
+	 callback_read_count,
+	 (ssize_t) 32 );
+
+	result = libfsxfs_read_queue_get_number_of_requests(
+	          read_queue,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_push_request(
+	          NULL,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          0,
+	          &fsxfs_test_read_queue_callback,
+	          (intptr_t *) &callback_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          NULL,
+	          buffer,
+	          16,
+	          0,
+	          &fsxfs_test_read_queue_callback,
+	          (intptr_t *) &callback_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          NULL,
+	          16,
+	          0,
+	          &fsxfs_test_read_queue_callback,
+	          (intptr_t *) &callback_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &fsxfs_test_read_queue_callback,
+	          (intptr_t *) &callback_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_push_request(
+	          read_queue,
+	          (libfsxfs_file_entry_t *) 0x12345678UL,
+	          buffer,
+	          16,
+	          -1,
+	          &fsxfs_test_read_queue_callback,
+	          (intptr_t *) &callback_read_count,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_pop_requests(
+	          NULL,
+	          requests,
+	          4,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_pop_requests(
+	          read_queue,
+	          NULL,
+	          4,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_pop_requests(
+	          read_queue,
+	          requests,
+	          -1,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_read_queue_pop_requests(
+	          read_queue,
+	          requests,
+	          4,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_read_queue_cancel_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_read_queue_cancel_requests(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error          = NULL;
+	libfsxfs_read_queue_t *read_queue = NULL;
+	ssize_t callback_read_count       = 0;
+	int number_of_requests            = 0;
+	int request_index                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_read_queue_initialize(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( request_index = 0;
+	     request_index < 3;
+	     request_index++ )
+	{
+		result = libfsxfs_read_queue_push_request(
+		          read_queue,
+		          (libfsxfs_file_entry_t *) 0x12345678UL,
+		          buffer,
+		          16,
+		          0,
+		          &fsxfs_test_read_queue_callback,
+		          (intptr_t *) &callback_read_count,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfsxfs_read_queue_cancel_requests(
+	          read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "callback_read_count",
+	 callback_read_count,
+	 (ssize_t) -3 );
+
+	result = libfsxfs_read_queue_get_number_of_requests(
+	          read_queue,
+	          &number_of_requests,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_requests",
+	 number_of_requests,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_read_queue_cancel_requests(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfsxfs_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_initialize",
+	 fsxfs_test_read_queue_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_free",
+	 fsxfs_test_read_queue_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_push_request",
+	 fsxfs_test_read_queue_push_and_pop_requests );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_read_queue_cancel_requests",
+	 fsxfs_test_read_queue_cancel_requests );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2281 @@
+/*
+ * Library sidecar_index type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_directory_entry.h"
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_metadata_table.h"
+#include "../libfsxfs/libfsxfs_sidecar_index.h"
+#include "../libfsxfs/libfsxfs_superblock.h"
+#include "../libfsxfs/libfsxfs_volume.h"
+
+uint8_t fsxfs_test_sidecar_index_data1[ 224 ] = {
+	0x46, 0x53, 0x58, 0x46, 0x53, 0x49, 0x44, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_sidecar_index_open_source(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     const system_character_t *index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_sidecar_index_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfsxfs_volume_set_index_file_wide(
+		          *volume,
+		          index_file,
+		          error );
+#else
+		result = libfsxfs_volume_set_index_file(
+		          *volume,
+		          index_file,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#else
+	result = libfsxfs_volume_open(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_sidecar_index_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_sidecar_index_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates a sidecar index with a copy of the test data
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_sidecar_index_initialize_with_data(
+     libfsxfs_sidecar_index_t **sidecar_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_sidecar_index_initialize_with_data";
+
+	if( libfsxfs_sidecar_index_initialize(
+	     sidecar_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sidecar index.",
+		 function );
+
+		return( -1 );
+	}
+	( *sidecar_index )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * data_size );
+
+	if( ( *sidecar_index )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		libfsxfs_sidecar_index_free(
+		 sidecar_index,
+		 NULL );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *sidecar_index )->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		libfsxfs_sidecar_index_free(
+		 sidecar_index,
+		 NULL );
+
+		return( -1 );
+	}
+	( *sidecar_index )->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Tests the libfsxfs_sidecar_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sidecar_index = (libfsxfs_sidecar_index_t *) 0x12345678UL;
+
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	sidecar_index = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_sidecar_index_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_sidecar_index_initialize(
+		          &sidecar_index,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( sidecar_index != NULL )
+			{
+				libfsxfs_sidecar_index_free(
+				 &sidecar_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "sidecar_index",
+			 sidecar_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_sidecar_index_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_sidecar_index_initialize(
+		          &sidecar_index,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( sidecar_index != NULL )
+			{
+				libfsxfs_sidecar_index_free(
+				 &sidecar_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "sidecar_index",
+			 sidecar_index );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_calculate_hash(
+     void )
+{
+	uint32_t hash = 0;
+
+	/* Test regular cases
+	 */
+	hash = libfsxfs_sidecar_index_calculate_hash(
+	        0,
+	        (uint8_t *) "",
+	        0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x9be17165UL );
+
+	hash = libfsxfs_sidecar_index_calculate_hash(
+	        128,
+	        (uint8_t *) "file",
+	        4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xf5fea963UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_read_header function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_read_header(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_sidecar_index_initialize_with_data(
+	          &sidecar_index,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "sidecar_index->media_size",
+	 sidecar_index->media_size,
+	 (uint64_t) 1048576 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "sidecar_index->number_of_blocks",
+	 sidecar_index->number_of_blocks,
+	 (uint64_t) 256 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar_index->number_of_inode_chunks",
+	 sidecar_index->number_of_inode_chunks,
+	 (size_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar_index->number_of_directory_entries",
+	 sidecar_index->number_of_directory_entries,
+	 (size_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar_index->string_heap_offset",
+	 sidecar_index->string_heap_offset,
+	 (size_t) 216 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_read_header(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small
+	 */
+	sidecar_index->data_size = 96;
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the string heap exceeds the data
+	 */
+	sidecar_index->data_size = 220;
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	sidecar_index->data_size = 224;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	sidecar_index->data[ 0 ] = 0xff;
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	sidecar_index->data[ 0 ] = 0x46;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of hash table slots is not a power of 2
+	 */
+	sidecar_index->data[ 88 ] = 0x0f;
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	sidecar_index->data[ 88 ] = 0x10;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_read_file_io_handle(
+	          sidecar_index,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar_index->data_size",
+	 sidecar_index->data_size,
+	 (size_t) 224 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "sidecar_index->media_size",
+	 sidecar_index->media_size,
+	 (uint64_t) 1048576 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "sidecar_index->number_of_inode_chunks",
+	 sidecar_index->number_of_inode_chunks,
+	 (size_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is already set
+	 */
+	result = libfsxfs_sidecar_index_read_file_io_handle(
+	          sidecar_index,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the data is too small to contain a header
+	 */
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_sidecar_index_data1,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_read_file_io_handle(
+	          sidecar_index,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index->data",
+	 sidecar_index->data );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_write_file_io_handle(
+     void )
+{
+	uint8_t data[ 224 ];
+
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	void *memset_result                     = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 data,
+	                 0,
+	                 224 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = fsxfs_test_sidecar_index_initialize_with_data(
+	          &sidecar_index,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_write_file_io_handle(
+	          sidecar_index,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          fsxfs_test_sidecar_index_data1,
+	          224 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the sidecar index has no data
+	 */
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_write_file_io_handle(
+	          sidecar_index,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_build function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_build(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsxfs_internal_volume_t *internal_volume   = NULL;
+	libfsxfs_metadata_table_t *metadata_table     = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index       = NULL;
+	size64_t media_size                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libbfio_handle_get_size(
+	          internal_volume->file_io_handle,
+	          &media_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_initialize(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_internal_volume_read_metadata_table(
+	          internal_volume,
+	          internal_volume->file_io_handle,
+	          metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_initialize(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_build(
+	          sidecar_index,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock,
+	          media_size,
+	          internal_volume->file_system->inode_btree,
+	          metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          internal_volume->superblock,
+	          media_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          internal_volume->file_system->root_directory_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A sidecar index read when the volume was opened must match
+	 * the one built from the volume
+	 */
+	if( internal_volume->file_system->sidecar_index != NULL )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_SIZE(
+		 "sidecar_index->data_size",
+		 sidecar_index->data_size,
+		 internal_volume->file_system->sidecar_index->data_size );
+
+		result = memory_compare(
+		          sidecar_index->data,
+		          internal_volume->file_system->sidecar_index->data,
+		          sidecar_index->data_size );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_build(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock,
+	          media_size,
+	          internal_volume->file_system->inode_btree,
+	          metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is already set
+	 */
+	result = libfsxfs_sidecar_index_build(
+	          sidecar_index,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock,
+	          media_size,
+	          internal_volume->file_system->inode_btree,
+	          metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_metadata_table_free(
+	          &metadata_table,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	if( metadata_table != NULL )
+	{
+		libfsxfs_metadata_table_free(
+		 &metadata_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_matches function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_matches(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	libfsxfs_superblock_t *superblock       = NULL;
+	void *memcpy_result                     = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_sidecar_index_initialize_with_data(
+	          &sidecar_index,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_superblock_initialize(
+	          &superblock,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memcpy_result = memory_copy(
+	                 superblock->file_system_identifier,
+	                 &( fsxfs_test_sidecar_index_data1[ 16 ] ),
+	                 16 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	superblock->number_of_blocks           = 256;
+	superblock->number_of_inodes           = 64;
+	superblock->number_of_free_inodes      = 61;
+	superblock->number_of_free_data_blocks = 200;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          superblock,
+	          1048576,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          superblock,
+	          2097152,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->number_of_free_inodes = 60;
+
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          superblock,
+	          1048576,
+	          &error );
+
+	superblock->number_of_free_inodes = 61;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	superblock->file_system_identifier[ 0 ] = 0xff;
+
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          superblock,
+	          1048576,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_matches(
+	          NULL,
+	          superblock,
+	          1048576,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_sidecar_index_matches(
+	          sidecar_index,
+	          NULL,
+	          1048576,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_superblock_free(
+	          &superblock,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "sidecar_index",
+	 sidecar_index );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( superblock != NULL )
+	{
+		libfsxfs_superblock_free(
+		 &superblock,
+		 NULL );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_has_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_has_inode(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = fsxfs_test_sidecar_index_initialize_with_data(
+	          &sidecar_index,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          130,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an unallocated inode of an inode chunk
+	 */
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          191,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          127,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_has_inode(
+	          sidecar_index,
+	          192,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_has_inode(
+	          NULL,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_sidecar_index_get_directory_entry_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_sidecar_index_get_directory_entry_by_utf8_name(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_directory_entry_t *directory_entry = NULL;
+	libfsxfs_sidecar_index_t *sidecar_index     = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_sidecar_index_initialize_with_data(
+	          &sidecar_index,
+	          fsxfs_test_sidecar_index_data1,
+	          224,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_read_header(
+	          sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          sidecar_index,
+	          128,
+	          (uint8_t *) "file",
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "directory_entry->inode_number",
+	 directory_entry->inode_number,
+	 (uint64_t) 131 );
+
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          sidecar_index,
+	          129,
+	          (uint8_t *) "file",
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          sidecar_index,
+	          128,
+	          (uint8_t *) "bogus",
+	          5,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          NULL,
+	          128,
+	          (uint8_t *) "file",
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          sidecar_index,
+	          128,
+	          NULL,
+	          4,
+	          directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_sidecar_index_get_directory_entry_by_utf8_name(
+	          sidecar_index,
+	          128,
+	          (uint8_t *) "file",
+	          4,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_sidecar_index_free(
+	          &sidecar_index,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sidecar_index != NULL )
+	{
+		libfsxfs_sidecar_index_free(
+		 &sidecar_index,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	libcerror_error_t *error       = NULL;
+	libfsxfs_volume_t *volume      = NULL;
+	system_character_t *index_file = NULL;
+	system_character_t *source     = NULL;
+	system_integer_t option        = 0;
+	int result                     = 0;
+#endif
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				index_file = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_initialize",
+	 fsxfs_test_sidecar_index_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_free",
+	 fsxfs_test_sidecar_index_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_calculate_hash",
+	 fsxfs_test_sidecar_index_calculate_hash );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_read_header",
+	 fsxfs_test_sidecar_index_read_header );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_read_file_io_handle",
+	 fsxfs_test_sidecar_index_read_file_io_handle );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_write_file_io_handle",
+	 fsxfs_test_sidecar_index_write_file_io_handle );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_matches",
+	 fsxfs_test_sidecar_index_matches );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_has_inode",
+	 fsxfs_test_sidecar_index_has_inode );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_sidecar_index_get_directory_entry_by_utf8_name",
+	 fsxfs_test_sidecar_index_get_directory_entry_by_utf8_name );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize volume for tests
+		 */
+		result = fsxfs_test_sidecar_index_open_source(
+		          &volume,
+		          source,
+		          index_file,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_sidecar_index_build",
+		 fsxfs_test_sidecar_index_build,
+		 volume );
+
+		/* Clean up
+		 */
+		result = fsxfs_test_sidecar_index_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
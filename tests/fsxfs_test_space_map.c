@@ -0,0 +1,749 @@
+/*
+ * Library space_map type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_space_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_space_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_map_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_space_map_t *space_map = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_map_initialize(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "space_map",
+	 space_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_map_free(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "space_map",
+	 space_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_map_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	space_map = (libfsxfs_space_map_t *) 0x12345678UL;
+
+	result = libfsxfs_space_map_initialize(
+	          &space_map,
+	          &error );
+
+	space_map = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_space_map_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_space_map_initialize(
+		          &space_map,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( space_map != NULL )
+			{
+				libfsxfs_space_map_free(
+				 &space_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "space_map",
+			 space_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_space_map_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_space_map_initialize(
+		          &space_map,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( space_map != NULL )
+			{
+				libfsxfs_space_map_free(
+				 &space_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "space_map",
+			 space_map );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_map != NULL )
+	{
+		libfsxfs_space_map_free(
+		 &space_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_map_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_map_append_free_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_map_append_free_extent(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfsxfs_space_map_t *space_map = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_space_map_initialize(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "space_map",
+	 space_map );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          4096,
+	          8192,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an adjacent free extent is merged
+	 */
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          12288,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "space_map->number_of_free_extents",
+	 space_map->number_of_free_extents,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "space_map->number_of_allocated_extents",
+	 space_map->number_of_allocated_extents,
+	 1 );
+
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          24576,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "space_map->number_of_free_extents",
+	 space_map->number_of_free_extents,
+	 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "space_map->number_of_allocated_extents",
+	 space_map->number_of_allocated_extents,
+	 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "space_map->free_extents[ 0 ].size",
+	 space_map->free_extents[ 0 ].size,
+	 (size64_t) 12288 );
+
+	result = libfsxfs_space_map_extend(
+	          space_map,
+	          40960,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "space_map->number_of_allocated_extents",
+	 space_map->number_of_allocated_extents,
+	 3 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "space_map->end_offset",
+	 space_map->end_offset,
+	 (off64_t) 40960 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_map_append_free_extent(
+	          NULL,
+	          49152,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          0,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_map_extend(
+	          NULL,
+	          49152,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_map_extend(
+	          space_map,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_map_free(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "space_map",
+	 space_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_map != NULL )
+	{
+		libfsxfs_space_map_free(
+		 &space_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_map_get_allocation_bitmap function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_map_get_allocation_bitmap(
+     void )
+{
+	uint8_t bitmap[ 2 ];
+
+	libcerror_error_t *error        = NULL;
+	libfsxfs_space_map_t *space_map = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_space_map_initialize(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "space_map",
+	 space_map );
+
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          4096,
+	          12288,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_map_append_free_extent(
+	          space_map,
+	          24576,
+	          4096,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_map_get_allocation_bitmap(
+	          space_map,
+	          0,
+	          10,
+	          4096,
+	          bitmap,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "bitmap[ 0 ]",
+	 bitmap[ 0 ],
+	 0xb1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "bitmap[ 1 ]",
+	 bitmap[ 1 ],
+	 0x03 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_map_get_allocation_bitmap(
+	          NULL,
+	          0,
+	          10,
+	          4096,
+	          bitmap,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_map_get_allocation_bitmap(
+	          space_map,
+	          0,
+	          10,
+	          4096,
+	          NULL,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_map_get_allocation_bitmap(
+	          space_map,
+	          0,
+	          10,
+	          4096,
+	          bitmap,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_map_free(
+	          &space_map,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "space_map",
+	 space_map );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_map != NULL )
+	{
+		libfsxfs_space_map_free(
+		 &space_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_map_initialize",
+	 fsxfs_test_space_map_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_map_free",
+	 fsxfs_test_space_map_free );
+
+	/* TODO: add tests for libfsxfs_space_map_append_extent */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_map_append_free_extent",
+	 fsxfs_test_space_map_append_free_extent );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_map_get_allocation_bitmap",
+	 fsxfs_test_space_map_get_allocation_bitmap );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
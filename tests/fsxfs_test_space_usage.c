@@ -0,0 +1,1751 @@
+/*
+ * Library space_usage type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_space_usage.h"
+#include "../libfsxfs/libfsxfs_superblock.h"
+#include "../libfsxfs/libfsxfs_volume.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_space_usage_open_source(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     const system_character_t *index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_space_usage_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfsxfs_volume_set_index_file_wide(
+		          *volume,
+		          index_file,
+		          error );
+#else
+		result = libfsxfs_volume_set_index_file(
+		          *volume,
+		          index_file,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#else
+	result = libfsxfs_volume_open(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_space_usage_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_space_usage_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_space_usage_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_space_usage_t *space_usage = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "space_usage",
+	 space_usage );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "space_usage",
+	 space_usage );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	space_usage = (libfsxfs_space_usage_t *) 0x12345678UL;
+
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	space_usage = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_space_usage_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_space_usage_initialize(
+		          &space_usage,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( space_usage != NULL )
+			{
+				libfsxfs_space_usage_free(
+				 &space_usage,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "space_usage",
+			 space_usage );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_space_usage_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_space_usage_initialize(
+		          &space_usage,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( space_usage != NULL )
+			{
+				libfsxfs_space_usage_free(
+				 &space_usage,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "space_usage",
+			 space_usage );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_get_size_bucket function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_get_size_bucket(
+     void )
+{
+	uint32_t size_bucket = 0;
+
+	size_bucket = libfsxfs_space_usage_get_size_bucket(
+	               0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "size_bucket",
+	 size_bucket,
+	 0 );
+
+	size_bucket = libfsxfs_space_usage_get_size_bucket(
+	               1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "size_bucket",
+	 size_bucket,
+	 1 );
+
+	size_bucket = libfsxfs_space_usage_get_size_bucket(
+	               4095 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "size_bucket",
+	 size_bucket,
+	 12 );
+
+	size_bucket = libfsxfs_space_usage_get_size_bucket(
+	               4096 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "size_bucket",
+	 size_bucket,
+	 13 );
+
+	size_bucket = libfsxfs_space_usage_get_size_bucket(
+	               0xffffffffffffffffULL );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "size_bucket",
+	 size_bucket,
+	 64 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_add_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_add_value(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_space_usage_t *space_usage = NULL;
+	uint64_t number_of_blocks           = 0;
+	uint64_t number_of_inodes           = 0;
+	uint32_t key                        = 0;
+	int number_of_entries               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "space_usage",
+	 space_usage );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_usage_add_value(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          1000,
+	          1,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_add_value(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          0,
+	          1,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the values of an existing key are summed
+	 */
+	result = libfsxfs_space_usage_add_value(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          1000,
+	          1,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_get_number_of_entries(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the entries are sorted by key
+	 */
+	result = libfsxfs_space_usage_get_entry_by_index(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          1,
+	          &key,
+	          &number_of_inodes,
+	          &number_of_blocks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "key",
+	 key,
+	 1000 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 (uint64_t) 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 12 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_get_number_of_entries(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_GROUP,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_add_value(
+	          NULL,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          1000,
+	          1,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_usage_add_value(
+	          space_usage,
+	          0,
+	          1000,
+	          1,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_usage_get_entry_by_index(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          2,
+	          &key,
+	          &number_of_inodes,
+	          &number_of_blocks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "space_usage",
+	 space_usage );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_merge function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_merge(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsxfs_space_usage_t *source_space_usage = NULL;
+	libfsxfs_space_usage_t *space_usage        = NULL;
+	uint64_t number_of_blocks                  = 0;
+	uint64_t number_of_inodes                  = 0;
+	uint32_t key                               = 0;
+	int number_of_entries                      = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_initialize(
+	          &source_space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_add_value(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	          0x8000,
+	          3,
+	          24,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_add_value(
+	          source_space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	          0x8000,
+	          1,
+	          8,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_add_value(
+	          source_space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	          0x4000,
+	          1,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_usage_merge(
+	          space_usage,
+	          source_space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_get_number_of_entries(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_get_entry_by_index(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_FILE_TYPE,
+	          1,
+	          &key,
+	          &number_of_inodes,
+	          &number_of_blocks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "key",
+	 key,
+	 0x8000 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 (uint64_t) 4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 (uint64_t) 32 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_merge(
+	          space_usage,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_usage_free(
+	          &source_space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &source_space_usage,
+		 NULL );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Retrieves the total number of inodes and blocks of a specific space usage type
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_space_usage_get_totals(
+     libfsxfs_space_usage_t *space_usage,
+     int usage_type,
+     uint64_t *total_number_of_inodes,
+     uint64_t *total_number_of_blocks,
+     libcerror_error_t **error )
+{
+	static char *function     = "fsxfs_test_space_usage_get_totals";
+	uint64_t number_of_blocks = 0;
+	uint64_t number_of_inodes = 0;
+	uint32_t key              = 0;
+	int entry_index           = 0;
+	int number_of_entries     = 0;
+
+	if( total_number_of_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total number of inodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_space_usage_get_number_of_entries(
+	     space_usage,
+	     usage_type,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*total_number_of_inodes = 0;
+	*total_number_of_blocks = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfsxfs_space_usage_get_entry_by_index(
+		     space_usage,
+		     usage_type,
+		     entry_index,
+		     &key,
+		     &number_of_inodes,
+		     &number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		*total_number_of_inodes += number_of_inodes;
+		*total_number_of_blocks += number_of_blocks;
+	}
+	return( 1 );
+}
+
+/* Tests the libfsxfs_space_usage_add_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_add_inode(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_inode_t *inode                     = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_space_usage_t *space_usage         = NULL;
+	uint64_t number_of_blocks                   = 0;
+	uint64_t number_of_inodes                   = 0;
+	uint32_t key                                = 0;
+	uint32_t owner_identifier                   = 0;
+	int number_of_entries                       = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_file_system_get_inode_by_number(
+	          internal_volume->file_system,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system->root_directory_inode_number,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_get_owner_identifier(
+	          inode,
+	          &owner_identifier,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_usage_add_inode(
+	          space_usage,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_space_usage_get_number_of_entries(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          &number_of_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libfsxfs_space_usage_get_entry_by_index(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          0,
+	          &key,
+	          &number_of_inodes,
+	          &number_of_blocks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "key",
+	 key,
+	 owner_identifier );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_add_inode(
+	          NULL,
+	          inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_usage_add_inode(
+	          space_usage,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_read_allocation_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_read_allocation_group(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_space_usage_t *space_usage         = NULL;
+	uint64_t number_of_blocks                   = 0;
+	uint64_t number_of_inodes                   = 0;
+	uint32_t allocation_group_index             = 0;
+	uint32_t number_of_allocation_groups        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume             = (libfsxfs_internal_volume_t *) volume;
+	number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
+
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		result = libfsxfs_space_usage_read_allocation_group(
+		          space_usage,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          internal_volume->file_system,
+		          allocation_group_index,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The inodes of all allocation groups must add up to the inodes in use
+	 */
+	result = fsxfs_test_space_usage_get_totals(
+	          space_usage,
+	          LIBFSXFS_SPACE_USAGE_TYPE_OWNER,
+	          &number_of_inodes,
+	          &number_of_blocks,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 internal_volume->superblock->number_of_inodes - internal_volume->superblock->number_of_free_inodes );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_read_allocation_group(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_space_usage_read_allocation_group(
+	          space_usage,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_space_usage_read_file_system function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_space_usage_read_file_system(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_space_usage_t *space_usage         = NULL;
+	uint64_t expected_number_of_blocks          = 0;
+	uint64_t expected_number_of_inodes          = 0;
+	uint64_t number_of_blocks                   = 0;
+	uint64_t number_of_inodes                   = 0;
+	int result                                  = 0;
+	int usage_type                              = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_space_usage_initialize(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_space_usage_read_file_system(
+	          space_usage,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every space usage type must account for every inode in use and its blocks
+	 */
+	expected_number_of_inodes = internal_volume->superblock->number_of_inodes - internal_volume->superblock->number_of_free_inodes;
+
+	for( usage_type = LIBFSXFS_SPACE_USAGE_TYPE_OWNER;
+	     usage_type <= LIBFSXFS_SPACE_USAGE_TYPE_SIZE;
+	     usage_type++ )
+	{
+		result = fsxfs_test_space_usage_get_totals(
+		          space_usage,
+		          usage_type,
+		          &number_of_inodes,
+		          &number_of_blocks,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_inodes",
+		 number_of_inodes,
+		 expected_number_of_inodes );
+
+		if( usage_type == LIBFSXFS_SPACE_USAGE_TYPE_OWNER )
+		{
+			expected_number_of_blocks = number_of_blocks;
+		}
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_blocks",
+		 number_of_blocks,
+		 expected_number_of_blocks );
+	}
+	/* Test error cases
+	 */
+	result = libfsxfs_space_usage_read_file_system(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_space_usage_free(
+	          &space_usage,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( space_usage != NULL )
+	{
+		libfsxfs_space_usage_free(
+		 &space_usage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	libcerror_error_t *error       = NULL;
+	libfsxfs_volume_t *volume      = NULL;
+	system_character_t *index_file = NULL;
+	system_character_t *source     = NULL;
+	system_integer_t option        = 0;
+	int result                     = 0;
+#endif
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				index_file = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_usage_initialize",
+	 fsxfs_test_space_usage_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_usage_free",
+	 fsxfs_test_space_usage_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_usage_get_size_bucket",
+	 fsxfs_test_space_usage_get_size_bucket );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_usage_add_value",
+	 fsxfs_test_space_usage_add_value );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_space_usage_merge",
+	 fsxfs_test_space_usage_merge );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize volume for tests
+		 */
+		result = fsxfs_test_space_usage_open_source(
+		          &volume,
+		          source,
+		          index_file,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_space_usage_add_inode",
+		 fsxfs_test_space_usage_add_inode,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_space_usage_read_allocation_group",
+		 fsxfs_test_space_usage_read_allocation_group,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_space_usage_read_file_system",
+		 fsxfs_test_space_usage_read_file_system,
+		 volume );
+
+		/* Clean up
+		 */
+		result = fsxfs_test_space_usage_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1323 @@
+/*
+ * Library unlinked_list type test program
+ *
+ * Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libbfio.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+#include "../libfsxfs/libfsxfs_superblock.h"
+#include "../libfsxfs/libfsxfs_unlinked_list.h"
+#include "../libfsxfs/libfsxfs_volume.h"
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates and opens a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_unlinked_list_open_source(
+     libfsxfs_volume_t **volume,
+     const system_character_t *source,
+     const system_character_t *index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_unlinked_list_open_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfsxfs_volume_set_index_file_wide(
+		          *volume,
+		          index_file,
+		          error );
+#else
+		result = libfsxfs_volume_set_index_file(
+		          *volume,
+		          index_file,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsxfs_volume_open_wide(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#else
+	result = libfsxfs_volume_open(
+	          *volume,
+	          source,
+	          LIBFSXFS_OPEN_READ,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_unlinked_list_close_source(
+     libfsxfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_unlinked_list_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfsxfs_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_unlinked_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_unlinked_list_t *unlinked_list = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unlinked_list",
+	 unlinked_list );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_unlinked_list_free(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unlinked_list",
+	 unlinked_list );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unlinked_list = (libfsxfs_unlinked_list_t *) 0x12345678UL;
+
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	unlinked_list = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_unlinked_list_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_unlinked_list_initialize(
+		          &unlinked_list,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( unlinked_list != NULL )
+			{
+				libfsxfs_unlinked_list_free(
+				 &unlinked_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "unlinked_list",
+			 unlinked_list );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_unlinked_list_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_unlinked_list_initialize(
+		          &unlinked_list,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( unlinked_list != NULL )
+			{
+				libfsxfs_unlinked_list_free(
+				 &unlinked_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "unlinked_list",
+			 unlinked_list );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &unlinked_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_unlinked_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_unlinked_list_append_inode_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_append_inode_number(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_unlinked_list_t *unlinked_list = NULL;
+	uint64_t inode_number                   = 0;
+	int inode_index                         = 0;
+	int number_of_inodes                    = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "unlinked_list",
+	 unlinked_list );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( inode_index = 0;
+	     inode_index < 40;
+	     inode_index++ )
+	{
+		result = libfsxfs_unlinked_list_append_inode_number(
+		          unlinked_list,
+		          (uint64_t) 128 + inode_index,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          unlinked_list,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 40 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_unlinked_list_get_inode_number_by_index(
+	          unlinked_list,
+	          39,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 (uint64_t) 167 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_append_inode_number(
+	          NULL,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          NULL,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          unlinked_list,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_get_inode_number_by_index(
+	          unlinked_list,
+	          40,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_get_inode_number_by_index(
+	          unlinked_list,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_unlinked_list_free(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "unlinked_list",
+	 unlinked_list );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &unlinked_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_unlinked_list_read_bucket function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_read_bucket(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_unlinked_list_t *unlinked_list     = NULL;
+	uint64_t inode_number                       = 0;
+	uint64_t root_directory_inode_number        = 0;
+	uint32_t allocation_group_index             = 0;
+	uint32_t relative_inode_number              = 0;
+	int number_of_inodes                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	root_directory_inode_number = internal_volume->file_system->root_directory_inode_number;
+
+	allocation_group_index = (uint32_t) ( root_directory_inode_number >> internal_volume->io_handle->number_of_relative_inode_number_bits );
+	relative_inode_number  = (uint32_t) ( root_directory_inode_number & ( ( (uint64_t) 1 << internal_volume->io_handle->number_of_relative_inode_number_bits ) - 1 ) );
+
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_unlinked_list_read_bucket(
+	          unlinked_list,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          allocation_group_index,
+	          LIBFSXFS_UNLINKED_LIST_END_OF_CHAIN,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "unlinked_list->number_of_inodes",
+	 unlinked_list->number_of_inodes,
+	 0 );
+
+	/* The root directory inode is linked and therefore ends the chain
+	 */
+	result = libfsxfs_unlinked_list_read_bucket(
+	          unlinked_list,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          allocation_group_index,
+	          relative_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          unlinked_list,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 1 );
+
+	result = libfsxfs_unlinked_list_get_inode_number_by_index(
+	          unlinked_list,
+	          0,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_number",
+	 inode_number,
+	 root_directory_inode_number );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_read_bucket(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          allocation_group_index,
+	          relative_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_read_bucket(
+	          unlinked_list,
+	          NULL,
+	          internal_volume->file_io_handle,
+	          allocation_group_index,
+	          relative_inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the relative inode number exceeds the allocation group
+	 */
+	result = libfsxfs_unlinked_list_read_bucket(
+	          unlinked_list,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          allocation_group_index,
+	          LIBFSXFS_UNLINKED_LIST_END_OF_CHAIN - 1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_unlinked_list_free(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &unlinked_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_unlinked_list_read_allocation_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_read_allocation_group(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_unlinked_list_t *unlinked_list     = NULL;
+	off64_t inode_information_offset            = 0;
+	uint32_t allocation_group_index             = 0;
+	uint32_t number_of_allocation_groups        = 0;
+	int number_of_inodes                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume             = (libfsxfs_internal_volume_t *) volume;
+	number_of_allocation_groups = internal_volume->superblock->number_of_allocation_groups;
+
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( allocation_group_index = 0;
+	     allocation_group_index < number_of_allocation_groups;
+	     allocation_group_index++ )
+	{
+		/* The inode information (AGI) is stored in the third sector of the allocation group
+		 */
+		inode_information_offset = ( (off64_t) allocation_group_index * internal_volume->io_handle->allocation_group_size * internal_volume->io_handle->block_size )
+		                         + ( 2 * (off64_t) internal_volume->superblock->sector_size );
+
+		result = libfsxfs_unlinked_list_read_allocation_group(
+		          unlinked_list,
+		          internal_volume->io_handle,
+		          internal_volume->file_io_handle,
+		          allocation_group_index,
+		          inode_information_offset,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The generated images do not contain unlinked inodes
+	 */
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          unlinked_list,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_read_allocation_group(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          0,
+	          2 * (off64_t) internal_volume->superblock->sector_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the inode information signature does not match
+	 */
+	result = libfsxfs_unlinked_list_read_allocation_group(
+	          unlinked_list,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          0,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_unlinked_list_free(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &unlinked_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_unlinked_list_read_file_system function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_unlinked_list_read_file_system(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	libfsxfs_unlinked_list_t *unlinked_list     = NULL;
+	int number_of_inodes                        = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	result = libfsxfs_unlinked_list_initialize(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_unlinked_list_read_file_system(
+	          unlinked_list,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          internal_volume->superblock->sector_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The generated images do not contain unlinked inodes
+	 */
+	result = libfsxfs_unlinked_list_get_number_of_inodes(
+	          unlinked_list,
+	          &number_of_inodes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_inodes",
+	 number_of_inodes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_unlinked_list_read_file_system(
+	          NULL,
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          internal_volume->superblock->sector_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_unlinked_list_read_file_system(
+	          unlinked_list,
+	          NULL,
+	          internal_volume->file_io_handle,
+	          internal_volume->superblock->number_of_allocation_groups,
+	          internal_volume->superblock->sector_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_unlinked_list_free(
+	          &unlinked_list,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unlinked_list != NULL )
+	{
+		libfsxfs_unlinked_list_free(
+		 &unlinked_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	libcerror_error_t *error       = NULL;
+	libfsxfs_volume_t *volume      = NULL;
+	system_character_t *index_file = NULL;
+	system_character_t *source     = NULL;
+	system_integer_t option        = 0;
+	int result                     = 0;
+#endif
+
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				index_file = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	FSXFS_TEST_RUN(
+	 "libfsxfs_unlinked_list_initialize",
+	 fsxfs_test_unlinked_list_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_unlinked_list_free",
+	 fsxfs_test_unlinked_list_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_unlinked_list_append_inode_number",
+	 fsxfs_test_unlinked_list_append_inode_number );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize volume for tests
+		 */
+		result = fsxfs_test_unlinked_list_open_source(
+		          &volume,
+		          source,
+		          index_file,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_unlinked_list_read_bucket",
+		 fsxfs_test_unlinked_list_read_bucket,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_unlinked_list_read_allocation_group",
+		 fsxfs_test_unlinked_list_read_allocation_group,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_unlinked_list_read_file_system",
+		 fsxfs_test_unlinked_list_read_file_system,
+		 volume );
+
+		/* Clean up
+		 */
+		result = fsxfs_test_unlinked_list_close_source(
+		          &volume,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "volume",
+		 volume );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
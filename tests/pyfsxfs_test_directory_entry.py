@@ -0,0 +1,207 @@
+#!/usr/bin/env python
+#
+# Python-bindings directory entry type test script
+#
+# Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import sys
+import unittest
+
+import pyfsxfs
+
+
+class DirectoryEntryTypeTests(unittest.TestCase):
+  """Tests the directory entry type."""
+
+  def _GetDirectories(self, fsxfs_volume):
+    """Retrieves the directory file entries.
+
+    Args:
+      fsxfs_volume (pyfsxfs.volume): volume.
+
+    Returns:
+      list[pyfsxfs.file_entry]: directory file entries.
+    """
+    directories = []
+
+    file_entries = [fsxfs_volume.get_root_directory()]
+    while file_entries:
+      file_entry = file_entries.pop(0)
+      if file_entry.get_file_mode() & 0o170000 == 0o040000:
+        directories.append(file_entry)
+        file_entries.extend(file_entry.sub_file_entries)
+
+    return directories
+
+  def _OpenVolume(self):
+    """Opens the test source volume.
+
+    Returns:
+      pyfsxfs.volume: volume.
+    """
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if unittest.offset:
+      raise unittest.SkipTest("source defines offset")
+
+    fsxfs_volume = pyfsxfs.volume()
+    fsxfs_volume.open(test_source)
+
+    return fsxfs_volume
+
+  def test_scandir(self):
+    """Tests the scandir function."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      for file_entry in self._GetDirectories(fsxfs_volume):
+        number_of_sub_file_entries = (
+            file_entry.get_number_of_sub_file_entries())
+
+        directory_entries = file_entry.scandir()
+        self.assertIsNotNone(directory_entries)
+        self.assertEqual(len(directory_entries), number_of_sub_file_entries)
+
+        names = [directory_entry.name for directory_entry in directory_entries]
+        expected_names = [
+            sub_file_entry.name for sub_file_entry in file_entry.sub_file_entries]
+        self.assertEqual(names, expected_names)
+
+        with self.assertRaises(ValueError):
+          directory_entries[number_of_sub_file_entries]
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_get_name(self):
+    """Tests the get_name function and name property."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      for file_entry in self._GetDirectories(fsxfs_volume):
+        directory_entries = file_entry.scandir()
+        for index in range(len(directory_entries)):
+          directory_entry = directory_entries[index]
+          sub_file_entry = file_entry.get_sub_file_entry(index)
+
+          name = directory_entry.get_name()
+          self.assertIsNotNone(name)
+          self.assertEqual(name, sub_file_entry.get_name())
+          self.assertEqual(directory_entry.name, name)
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_get_inode_number(self):
+    """Tests the get_inode_number function and inode_number property."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      for file_entry in self._GetDirectories(fsxfs_volume):
+        directory_entries = file_entry.scandir()
+        for index in range(len(directory_entries)):
+          directory_entry = directory_entries[index]
+          sub_file_entry = file_entry.get_sub_file_entry(index)
+
+          inode_number = directory_entry.get_inode_number()
+          self.assertEqual(inode_number, sub_file_entry.get_inode_number())
+          self.assertEqual(directory_entry.inode_number, inode_number)
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_get_file_type(self):
+    """Tests the get_file_type function and file_type property."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      for file_entry in self._GetDirectories(fsxfs_volume):
+        directory_entries = file_entry.scandir()
+        for index in range(len(directory_entries)):
+          directory_entry = directory_entries[index]
+          sub_file_entry = file_entry.get_sub_file_entry(index)
+
+          expected_file_type = sub_file_entry.get_file_mode() & 0o170000
+
+          # The file type is not recorded by directories of format version 4
+          # volumes without the file type feature.
+          file_type = directory_entry.get_file_type()
+          if file_type is not None:
+            self.assertEqual(file_type, expected_file_type)
+
+          self.assertEqual(directory_entry.file_type, file_type)
+
+          self.assertEqual(
+              directory_entry.is_directory(), expected_file_type == 0o040000)
+          self.assertEqual(
+              directory_entry.is_file(), expected_file_type == 0o100000)
+          self.assertEqual(
+              directory_entry.is_symbolic_link(),
+              expected_file_type == 0o120000)
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_get_file_entry(self):
+    """Tests the get_file_entry function."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      for file_entry in self._GetDirectories(fsxfs_volume):
+        directory_entries = file_entry.scandir()
+        for index in range(len(directory_entries)):
+          directory_entry = directory_entries[index]
+          sub_file_entry = file_entry.get_sub_file_entry(index)
+
+          directory_entry_file_entry = directory_entry.get_file_entry()
+          self.assertIsNotNone(directory_entry_file_entry)
+
+          self.assertEqual(
+              directory_entry_file_entry.get_inode_number(),
+              sub_file_entry.get_inode_number())
+          self.assertEqual(
+              directory_entry_file_entry.get_name(), sub_file_entry.get_name())
+          self.assertEqual(
+              directory_entry_file_entry.get_file_mode(),
+              sub_file_entry.get_file_mode())
+
+    finally:
+      fsxfs_volume.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "-o", "--offset", dest="offset", action="store", default=None,
+      type=int, help="offset of the source file.")
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "offset", options.offset)
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
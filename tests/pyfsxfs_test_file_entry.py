@@ -0,0 +1,218 @@
+#!/usr/bin/env python
+#
+# Python-bindings file entry type test script
+#
+# Copyright (C) 2020-2021, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import os
+import sys
+import unittest
+
+import pyfsxfs
+
+
+class FileEntryTypeTests(unittest.TestCase):
+  """Tests the file entry type."""
+
+  def _GetFileEntryWithData(self, fsxfs_volume):
+    """Retrieves the first regular file entry that contains data.
+
+    Args:
+      fsxfs_volume (pyfsxfs.volume): volume.
+
+    Returns:
+      pyfsxfs.file_entry: file entry or None if not available.
+    """
+    file_entries = [fsxfs_volume.get_root_directory()]
+    while file_entries:
+      file_entry = file_entries.pop(0)
+
+      file_mode = file_entry.get_file_mode()
+      if file_mode & 0o170000 == 0o040000:
+        file_entries.extend(file_entry.sub_file_entries)
+
+      elif file_mode & 0o170000 == 0o100000 and file_entry.get_size() > 0:
+        return file_entry
+
+    return None
+
+  def _OpenVolume(self):
+    """Opens the test source volume.
+
+    Returns:
+      pyfsxfs.volume: volume.
+    """
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if unittest.offset:
+      raise unittest.SkipTest("source defines offset")
+
+    fsxfs_volume = pyfsxfs.volume()
+    fsxfs_volume.open(test_source)
+
+    return fsxfs_volume
+
+  def test_read_buffer(self):
+    """Tests the read_buffer function."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      file_entry = self._GetFileEntryWithData(fsxfs_volume)
+      if not file_entry:
+        raise unittest.SkipTest("missing file entry with data")
+
+      size = file_entry.get_size()
+
+      data = file_entry.read_buffer()
+      self.assertIsNotNone(data)
+      self.assertEqual(len(data), size)
+
+      # Test read beyond the end of the data.
+      data = file_entry.read_buffer(size=16)
+      self.assertEqual(data, b"")
+
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      data = file_entry.read_buffer(size=size + 16)
+      self.assertEqual(len(data), size)
+
+      with self.assertRaises(ValueError):
+        file_entry.read_buffer(size=-1)
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_read_buffer_into(self):
+    """Tests the read_buffer_into function."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      file_entry = self._GetFileEntryWithData(fsxfs_volume)
+      if not file_entry:
+        raise unittest.SkipTest("missing file entry with data")
+
+      size = file_entry.get_size()
+
+      expected_data = file_entry.read_buffer_at_offset(size, 0)
+
+      # Test read at the current offset.
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      buffer = bytearray(size)
+      read_count = file_entry.read_buffer_into(buffer)
+      self.assertEqual(read_count, size)
+      self.assertEqual(bytes(buffer), expected_data)
+      self.assertEqual(file_entry.get_offset(), size)
+
+      # Test read at a specific offset.
+      read_offset = size // 2
+
+      buffer = bytearray(size - read_offset)
+      read_count = file_entry.read_buffer_into(buffer, offset=read_offset)
+      self.assertEqual(read_count, size - read_offset)
+      self.assertEqual(bytes(buffer), expected_data[read_offset:])
+
+      # Test read into a memory view.
+      buffer = bytearray(size)
+      read_count = file_entry.read_buffer_into(memoryview(buffer), 0)
+      self.assertEqual(read_count, size)
+      self.assertEqual(bytes(buffer), expected_data)
+
+      # Test read into a buffer larger than the data.
+      buffer = bytearray(size + 16)
+      read_count = file_entry.read_buffer_into(buffer, offset=0)
+      self.assertEqual(read_count, size)
+      self.assertEqual(bytes(buffer[:size]), expected_data)
+
+      with self.assertRaises(ValueError):
+        file_entry.read_buffer_into(bytearray(16), offset=-1)
+
+      with self.assertRaises(BufferError):
+        file_entry.read_buffer_into(b"read-only buffer")
+
+    finally:
+      fsxfs_volume.close()
+
+  def test_readinto(self):
+    """Tests the readinto function."""
+    fsxfs_volume = self._OpenVolume()
+
+    try:
+      file_entry = self._GetFileEntryWithData(fsxfs_volume)
+      if not file_entry:
+        raise unittest.SkipTest("missing file entry with data")
+
+      size = file_entry.get_size()
+
+      file_entry.seek_offset(0, os.SEEK_SET)
+      expected_data = file_entry.read_buffer(size)
+
+      # Test successive reads at the current offset.
+      file_entry.seek_offset(0, os.SEEK_SET)
+
+      first_size = size // 2
+
+      buffer = bytearray(first_size)
+      read_count = file_entry.readinto(buffer)
+      self.assertEqual(read_count, first_size)
+      self.assertEqual(bytes(buffer), expected_data[:first_size])
+
+      buffer = bytearray(size)
+      read_count = file_entry.readinto(buffer)
+      self.assertEqual(read_count, size - first_size)
+      self.assertEqual(bytes(buffer[:read_count]), expected_data[first_size:])
+
+      # Test read at the end of the data.
+      read_count = file_entry.readinto(bytearray(16))
+      self.assertEqual(read_count, 0)
+
+      # The readinto function only takes the buffer.
+      with self.assertRaises(TypeError):
+        file_entry.readinto(bytearray(16), 0)
+
+      with self.assertRaises(TypeError):
+        file_entry.readinto(bytearray(16), offset=0)
+
+      with self.assertRaises(BufferError):
+        file_entry.readinto(b"read-only buffer")
+
+    finally:
+      fsxfs_volume.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "-o", "--offset", dest="offset", action="store", default=None,
+      type=int, help="offset of the source file.")
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "offset", options.offset)
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
@@ -273,6 +273,29 @@ class VolumeTypeTests(unittest.TestCase):
 
       fsxfs_volume.close()
 
+  def test_walk(self):
+    """Tests the walk function."""
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    with DataRangeFileObject(
+        test_source, unittest.offset or 0, None) as file_object:
+
+      fsxfs_volume = pyfsxfs.volume()
+      fsxfs_volume.open_file_object(file_object)
+
+      walked_paths = []
+      for path, directory_names, file_names in fsxfs_volume.walk():
+        self.assertIsInstance(directory_names, list)
+        self.assertIsInstance(file_names, list)
+        walked_paths.append(path)
+
+      self.assertGreater(len(walked_paths), 0)
+      self.assertEqual(walked_paths[0], "/")
+
+      fsxfs_volume.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -0,0 +1,149 @@
+#!/bin/bash
+# Tests library functions and types on generated synthetic images.
+#
+# Version: 20210101
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+LIBRARY_TESTS_WITH_GENERATED_IMAGE="inode_allocation_map owner_map sidecar_index space_usage unlinked_list";
+
+# The generator options of the images, one image per line.
+GENERATED_IMAGES="-a 1 -f 50 -g 4096 -v 4
+-a 4 -f 200 -g 4096 -v 5
+-a 4 -e 4 -f 100 -g 4096 -l 4 -S -v 5";
+
+GENERATE_IMAGE="./fsxfs_generate_image";
+
+run_test_with_generated_image()
+{
+	local TEST_NAME=$1;
+	local IMAGE_FILE=$2;
+	local INDEX_FILE=$3;
+
+	local TEST_EXECUTABLE="./fsxfs_test_${TEST_NAME}";
+
+	if ! test -x "${TEST_EXECUTABLE}";
+	then
+		TEST_EXECUTABLE="${TEST_EXECUTABLE}.exe";
+	fi
+
+	run_test_with_arguments "Testing: ${TEST_NAME} with input: ${IMAGE_FILE}" "${TEST_EXECUTABLE}" "${IMAGE_FILE}";
+	local RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	# The first run with a sidecar index builds the index file and the second run reads it.
+	rm -f "${INDEX_FILE}";
+
+	run_test_with_arguments "Testing: ${TEST_NAME} with input: ${IMAGE_FILE} and new sidecar index" "${TEST_EXECUTABLE}" "-i" "${INDEX_FILE}" "${IMAGE_FILE}";
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+	if ! test -f "${INDEX_FILE}";
+	then
+		echo "Missing sidecar index: ${INDEX_FILE}";
+
+		return ${EXIT_FAILURE};
+	fi
+	run_test_with_arguments "Testing: ${TEST_NAME} with input: ${IMAGE_FILE} and existing sidecar index" "${TEST_EXECUTABLE}" "-i" "${INDEX_FILE}" "${IMAGE_FILE}";
+	RESULT=$?;
+
+	return ${RESULT};
+}
+
+if test -n "${SKIP_LIBRARY_TESTS}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+if ! test -x "${GENERATE_IMAGE}";
+then
+	GENERATE_IMAGE="${GENERATE_IMAGE}.exe";
+fi
+
+if ! test -x "${GENERATE_IMAGE}";
+then
+	echo "Missing image generator: ${GENERATE_IMAGE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+TEST_RUNNER="tests/test_runner.sh";
+
+if ! test -f "${TEST_RUNNER}";
+then
+	TEST_RUNNER="./test_runner.sh";
+fi
+
+if ! test -f "${TEST_RUNNER}";
+then
+	echo "Missing test runner: ${TEST_RUNNER}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+source ${TEST_RUNNER};
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_SUCCESS};
+IMAGE_INDEX=0;
+
+OLDIFS=${IFS};
+
+# IFS="\n" is not supported by all platforms.
+IFS="
+";
+
+for GENERATOR_OPTIONS in ${GENERATED_IMAGES};
+do
+	IFS=${OLDIFS};
+
+	IMAGE_FILE="${TMPDIR}/image${IMAGE_INDEX}.raw";
+	INDEX_FILE="${TMPDIR}/image${IMAGE_INDEX}.idx";
+
+	${GENERATE_IMAGE} -m ${GENERATOR_OPTIONS} "${IMAGE_FILE}" > /dev/null;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate image with options: ${GENERATOR_OPTIONS}";
+
+		break;
+	fi
+	for TEST_NAME in ${LIBRARY_TESTS_WITH_GENERATED_IMAGE};
+	do
+		run_test_with_generated_image "${TEST_NAME}" "${IMAGE_FILE}" "${INDEX_FILE}";
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done
+
+	rm -f "${IMAGE_FILE}" "${INDEX_FILE}";
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+	IMAGE_INDEX=$(( ${IMAGE_INDEX} + 1 ));
+done
+
+IFS=${OLDIFS};
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory_entry directory_table_header error extent inode_btree inode_btree_record inode_information io_handle notify superblock"
+$LibraryTests = "block_data_handle block_directory_footer block_directory_header btree_block btree_header buffer_data_handle direct_io_handle directory_entry directory_table_header error extent free_space_information inode inode_allocation_map inode_btree inode_btree_record inode_information io_engine io_handle io_uring metadata_table notify offset_index owner_map quota_record read_batch read_queue sidecar_index space_map space_usage statistics superblock unallocated_data_handle unlinked_list"
 $LibraryTestsWithInput = "support volume"
 $OptionSets = "offset"
 
@@ -8,7 +8,7 @@ EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
 TEST_FUNCTIONS="support";
-TEST_FUNCTIONS_WITH_INPUT="volume";
+TEST_FUNCTIONS_WITH_INPUT="directory_entry file_entry volume";
 OPTION_SETS="offset";
 
 TEST_TOOL_DIRECTORY=".";